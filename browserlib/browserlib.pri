@@ -12,11 +12,14 @@ HEADERS += ./browserlib_global.h \
     ./browserlib.h \
     ./qpoint3d.h \
     ./qpoint3df.h \
+    ./qpoint3dmath.h \
     ./qrotation3D.h \
     ./qtbuttonpropertybrowser.h \
     ./qteditorfactory.h \
     ./qtgroupboxpropertybrowser.h \
+    ./qtobjectpropertybinder.h \
     ./qtpropertybrowser.h \
+    ./qtpropertybrowserprofiler.h \
     ./qtpropertybrowserutils_p.h \
     ./qtpropertymanager.h \
     ./qttreepropertybrowser.h \
@@ -24,10 +27,13 @@ HEADERS += ./browserlib_global.h \
     ./rangeslider.h
 SOURCES += ./browserlib.cpp \
     ./stdafx.cpp \
+    ./qpoint3dmath.cpp \
     ./qtbuttonpropertybrowser.cpp \
     ./qteditorfactory.cpp \
     ./qtgroupboxpropertybrowser.cpp \
+    ./qtobjectpropertybinder.cpp \
     ./qtpropertybrowser.cpp \
+    ./qtpropertybrowserprofiler.cpp \
     ./qtpropertybrowserutils.cpp \
     ./qtpropertymanager.cpp \
     ./qttreepropertybrowser.cpp \
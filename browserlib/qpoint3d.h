@@ -48,7 +48,7 @@ public:
 
     static inline int dotProduct(const QPoint3D &p1, const QPoint3D &p2)
     {
-        return p1.xp * p2.xp + p1.yp * p2.yp;
+        return p1.xp * p2.xp + p1.yp * p2.yp + p1.zp * p2.zp;
     }
 
     friend inline bool operator==(const QPoint3D &, const QPoint3D &);
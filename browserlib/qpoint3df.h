@@ -48,9 +48,18 @@ public:
 
     static inline double dotProduct(const QPoint3DF &p1, const QPoint3DF &p2)
     {
-        return p1.xp * p2.xp + p1.yp * p2.yp;
+        return p1.xp * p2.xp + p1.yp * p2.yp + p1.zp * p2.zp;
     }
 
+    static inline QPoint3DF crossProduct(const QPoint3DF &p1, const QPoint3DF &p2)
+    {
+        return QPoint3DF(p1.yp * p2.zp - p1.zp * p2.yp,
+                         p1.zp * p2.xp - p1.xp * p2.zp,
+                         p1.xp * p2.yp - p1.yp * p2.xp);
+    }
+
+    inline double length() const;
+
     friend inline bool operator==(const QPoint3DF &, const QPoint3DF &);
 
     friend inline bool operator!=(const QPoint3DF &, const QPoint3DF &);
@@ -176,6 +185,11 @@ inline double QPoint3DF::manhattanLength() const
     return qAbs(x())+qAbs(y())+qAbs(z());
 }
 
+inline double QPoint3DF::length() const
+{
+    return qSqrt(xp*xp + yp*yp + zp*zp);
+}
+
 inline double &QPoint3DF::rx()
 {
     return xp;
@@ -209,17 +223,17 @@ inline QPoint3DF &QPoint3DF::operator-=(const QPoint3DF &p)
 
 inline QPoint3DF &QPoint3DF::operator*=(float factor)
 {
-    xp = qRound(xp*factor);
-    yp = qRound(yp*factor);
-    zp = qRound(zp*factor);
+    xp = xp*factor;
+    yp = yp*factor;
+    zp = zp*factor;
     return *this;
 }
 
 inline QPoint3DF &QPoint3DF::operator*=(double factor)
 {
-    xp = qRound(xp*factor);
-    yp = qRound(yp*factor);
-    zp = qRound(zp*factor);
+    xp = xp*factor;
+    yp = yp*factor;
+    zp = zp*factor;
     return *this;
 }
 
@@ -253,12 +267,12 @@ inline const QPoint3DF operator-(const QPoint3DF &p1, const QPoint3DF &p2)
 
 inline const QPoint3DF operator*(const QPoint3DF &p, float factor)
 {
-    return QPoint3DF(qRound(p.xp*factor), qRound(p.yp*factor), qRound(p.zp*factor));
+    return QPoint3DF(p.xp*factor, p.yp*factor, p.zp*factor);
 }
 
 inline const QPoint3DF operator*(const QPoint3DF &p, double factor)
 {
-    return QPoint3DF(qRound(p.xp*factor), qRound(p.yp*factor), qRound(p.zp*factor));
+    return QPoint3DF(p.xp*factor, p.yp*factor, p.zp*factor);
 }
 
 inline const QPoint3DF operator*(const QPoint3DF &p, int factor)
@@ -268,12 +282,12 @@ inline const QPoint3DF operator*(const QPoint3DF &p, int factor)
 
 inline const QPoint3DF operator*(float factor, const QPoint3DF &p)
 {
-    return QPoint3DF(qRound(p.xp*factor), qRound(p.yp*factor), qRound(p.zp*factor));
+    return QPoint3DF(p.xp*factor, p.yp*factor, p.zp*factor);
 }
 
 inline const QPoint3DF operator*(double factor, const QPoint3DF &p)
 {
-    return QPoint3DF(qRound(p.xp*factor), qRound(p.yp*factor), qRound(p.zp*factor));
+    return QPoint3DF(p.xp*factor, p.yp*factor, p.zp*factor);
 }
 
 inline const QPoint3DF operator*(int factor, const QPoint3DF &p)
@@ -293,15 +307,15 @@ inline const QPoint3DF operator-(const QPoint3DF &p)
 
 inline QPoint3DF &QPoint3DF::operator/=(double c)
 {
-    xp = qRound(xp/c);
-    yp = qRound(yp/c);
-    zp = qRound(zp/c);
+    xp = xp/c;
+    yp = yp/c;
+    zp = zp/c;
     return *this;
 }
 
 inline const QPoint3DF operator/(const QPoint3DF &p, double c)
 {
-    return QPoint3DF(qRound(p.xp/c), qRound(p.yp/c), qRound(p.zp/c));
+    return QPoint3DF(p.xp/c, p.yp/c, p.zp/c);
 }
 
 #endif // QPOINT3DF_H
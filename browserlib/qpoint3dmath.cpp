@@ -0,0 +1,401 @@
+#include "qpoint3dmath.h"
+
+#include <QtCore/qmath.h>
+#include <QtGui/QQuaternion>
+
+#if defined(__AVX__)
+#    include <immintrin.h>
+#    define QPOINT3DMATH_AVX
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define QPOINT3DMATH_SSE2
+#endif
+
+// The kernels below treat arrays of points as flat arrays of coordinates.
+static_assert(sizeof(QPoint3D) == 3 * sizeof(int), "QPoint3D must consist of three packed ints");
+static_assert(sizeof(QRotation3D) == 3 * sizeof(int), "QRotation3D must consist of three packed ints");
+static_assert(sizeof(QPoint3DF) == 3 * sizeof(double), "QPoint3DF must consist of three packed doubles");
+
+namespace {
+
+inline int *coordinates(QPoint3D *points) { return reinterpret_cast<int *>(points); }
+inline int *coordinates(QRotation3D *rotations) { return reinterpret_cast<int *>(rotations); }
+inline double *coordinates(QPoint3DF *points) { return reinterpret_cast<double *>(points); }
+inline const double *coordinates(const QPoint3DF *points) { return reinterpret_cast<const double *>(points); }
+
+// Row-major 3x3 rotation matrix.
+struct Matrix3
+{
+    double m[9];
+};
+
+Matrix3 rotationMatrix(double w, double x, double y, double z)
+{
+    const double len = qSqrt(w * w + x * x + y * y + z * z);
+    if (qFuzzyIsNull(len))
+        return {{1, 0, 0, 0, 1, 0, 0, 0, 1}};
+    w /= len; x /= len; y /= len; z /= len;
+
+    const double xx = x * x, yy = y * y, zz = z * z;
+    const double xy = x * y, xz = x * z, yz = y * z;
+    const double xw = x * w, yw = y * w, zw = z * w;
+    return {{1 - 2 * (yy + zz), 2 * (xy - zw), 2 * (xz + yw),
+             2 * (xy + zw), 1 - 2 * (xx + zz), 2 * (yz - xw),
+             2 * (xz - yw), 2 * (yz + xw), 1 - 2 * (xx + yy)}};
+}
+
+Matrix3 rotationMatrix(const QQuaternion &rotation)
+{
+    return rotationMatrix(rotation.scalar(), rotation.x(), rotation.y(), rotation.z());
+}
+
+// Same convention as QQuaternion::fromEulerAngles(), evaluated in double precision.
+Matrix3 rotationMatrix(const QRotation3D &angles)
+{
+    const double pitch = qDegreesToRadians(double(angles.x())) * 0.5;
+    const double yaw = qDegreesToRadians(double(angles.y())) * 0.5;
+    const double roll = qDegreesToRadians(double(angles.z())) * 0.5;
+
+    const double c1 = qCos(yaw), s1 = qSin(yaw);
+    const double c2 = qCos(roll), s2 = qSin(roll);
+    const double c3 = qCos(pitch), s3 = qSin(pitch);
+    const double c1c2 = c1 * c2, s1s2 = s1 * s2;
+
+    return rotationMatrix(c1c2 * c3 + s1s2 * s3,
+                          c1c2 * s3 + s1s2 * c3,
+                          s1 * c2 * c3 - c1 * s2 * s3,
+                          c1 * s2 * c3 - s1 * c2 * s3);
+}
+
+// Adds (or multiplies by) the repeating pattern k[0], k[1], k[2] to the
+// n coordinates in data. Vector loops consume a whole number of patterns
+// per iteration, so the scalar tail starts on an x coordinate.
+template <bool Multiply>
+void applyPattern(double *data, qsizetype n, const double *k)
+{
+    qsizetype i = 0;
+#if defined(QPOINT3DMATH_AVX)
+    const __m256d k0 = _mm256_setr_pd(k[0], k[1], k[2], k[0]);
+    const __m256d k1 = _mm256_setr_pd(k[1], k[2], k[0], k[1]);
+    const __m256d k2 = _mm256_setr_pd(k[2], k[0], k[1], k[2]);
+    for (; i + 12 <= n; i += 12) {
+        const __m256d a = _mm256_loadu_pd(data + i);
+        const __m256d b = _mm256_loadu_pd(data + i + 4);
+        const __m256d c = _mm256_loadu_pd(data + i + 8);
+        _mm256_storeu_pd(data + i, Multiply ? _mm256_mul_pd(a, k0) : _mm256_add_pd(a, k0));
+        _mm256_storeu_pd(data + i + 4, Multiply ? _mm256_mul_pd(b, k1) : _mm256_add_pd(b, k1));
+        _mm256_storeu_pd(data + i + 8, Multiply ? _mm256_mul_pd(c, k2) : _mm256_add_pd(c, k2));
+    }
+#elif defined(QPOINT3DMATH_SSE2)
+    const __m128d k0 = _mm_setr_pd(k[0], k[1]);
+    const __m128d k1 = _mm_setr_pd(k[2], k[0]);
+    const __m128d k2 = _mm_setr_pd(k[1], k[2]);
+    for (; i + 6 <= n; i += 6) {
+        const __m128d a = _mm_loadu_pd(data + i);
+        const __m128d b = _mm_loadu_pd(data + i + 2);
+        const __m128d c = _mm_loadu_pd(data + i + 4);
+        _mm_storeu_pd(data + i, Multiply ? _mm_mul_pd(a, k0) : _mm_add_pd(a, k0));
+        _mm_storeu_pd(data + i + 2, Multiply ? _mm_mul_pd(b, k1) : _mm_add_pd(b, k1));
+        _mm_storeu_pd(data + i + 4, Multiply ? _mm_mul_pd(c, k2) : _mm_add_pd(c, k2));
+    }
+#endif
+    for (; i < n; ++i)
+        data[i] = Multiply ? data[i] * k[i % 3] : data[i] + k[i % 3];
+}
+
+void addPattern(int *data, qsizetype n, const int *k)
+{
+    qsizetype i = 0;
+#if defined(QPOINT3DMATH_SSE2)
+    const __m128i k0 = _mm_setr_epi32(k[0], k[1], k[2], k[0]);
+    const __m128i k1 = _mm_setr_epi32(k[1], k[2], k[0], k[1]);
+    const __m128i k2 = _mm_setr_epi32(k[2], k[0], k[1], k[2]);
+    for (; i + 12 <= n; i += 12) {
+        __m128i *p = reinterpret_cast<__m128i *>(data + i);
+        _mm_storeu_si128(p, _mm_add_epi32(_mm_loadu_si128(p), k0));
+        _mm_storeu_si128(p + 1, _mm_add_epi32(_mm_loadu_si128(p + 1), k1));
+        _mm_storeu_si128(p + 2, _mm_add_epi32(_mm_loadu_si128(p + 2), k2));
+    }
+#endif
+    for (; i < n; ++i)
+        data[i] += k[i % 3];
+}
+
+#if defined(QPOINT3DMATH_SSE2)
+// Rounds half away from zero like qRound().
+inline __m128i roundToInt(__m128d v)
+{
+    const __m128d sign = _mm_and_pd(v, _mm_set1_pd(-0.0));
+    return _mm_cvttpd_epi32(_mm_add_pd(v, _mm_or_pd(sign, _mm_set1_pd(0.5))));
+}
+
+inline __m128i scalePair(const int *data, __m128d k)
+{
+    const __m128d v = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(data)));
+    return roundToInt(_mm_mul_pd(v, k));
+}
+#endif
+
+void scalePattern(int *data, qsizetype n, const double *k)
+{
+    qsizetype i = 0;
+#if defined(QPOINT3DMATH_SSE2)
+    const __m128d k0 = _mm_setr_pd(k[0], k[1]);
+    const __m128d k1 = _mm_setr_pd(k[2], k[0]);
+    const __m128d k2 = _mm_setr_pd(k[1], k[2]);
+    for (; i + 6 <= n; i += 6) {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(data + i), scalePair(data + i, k0));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(data + i + 2), scalePair(data + i + 2, k1));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(data + i + 4), scalePair(data + i + 4, k2));
+    }
+#endif
+    for (; i < n; ++i)
+        data[i] = qRound(data[i] * k[i % 3]);
+}
+
+#if defined(QPOINT3DMATH_SSE2)
+// Splits two consecutive points (x0 y0 z0 x1 y1 z1) into x, y and z lanes.
+inline void loadPoints(const double *p, __m128d &x, __m128d &y, __m128d &z)
+{
+    const __m128d r0 = _mm_loadu_pd(p);     // x0 y0
+    const __m128d r1 = _mm_loadu_pd(p + 2); // z0 x1
+    const __m128d r2 = _mm_loadu_pd(p + 4); // y1 z1
+    x = _mm_shuffle_pd(r0, r1, 2);
+    y = _mm_shuffle_pd(r0, r2, 1);
+    z = _mm_shuffle_pd(r1, r2, 2);
+}
+
+inline void storePoints(double *p, __m128d x, __m128d y, __m128d z)
+{
+    _mm_storeu_pd(p, _mm_shuffle_pd(x, y, 0));
+    _mm_storeu_pd(p + 2, _mm_shuffle_pd(z, x, 2));
+    _mm_storeu_pd(p + 4, _mm_shuffle_pd(y, z, 3));
+}
+
+inline __m128d dot(__m128d x1, __m128d y1, __m128d z1, __m128d x2, __m128d y2, __m128d z2)
+{
+    return _mm_add_pd(_mm_add_pd(_mm_mul_pd(x1, x2), _mm_mul_pd(y1, y2)), _mm_mul_pd(z1, z2));
+}
+#endif
+
+void transform(double *p, qsizetype count, const Matrix3 &matrix)
+{
+    const double *m = matrix.m;
+    qsizetype i = 0;
+#if defined(QPOINT3DMATH_SSE2)
+    const __m128d m00 = _mm_set1_pd(m[0]), m01 = _mm_set1_pd(m[1]), m02 = _mm_set1_pd(m[2]);
+    const __m128d m10 = _mm_set1_pd(m[3]), m11 = _mm_set1_pd(m[4]), m12 = _mm_set1_pd(m[5]);
+    const __m128d m20 = _mm_set1_pd(m[6]), m21 = _mm_set1_pd(m[7]), m22 = _mm_set1_pd(m[8]);
+    for (; i + 2 <= count; i += 2) {
+        __m128d x, y, z;
+        loadPoints(p + 3 * i, x, y, z);
+        storePoints(p + 3 * i, dot(m00, m01, m02, x, y, z),
+                               dot(m10, m11, m12, x, y, z),
+                               dot(m20, m21, m22, x, y, z));
+    }
+#endif
+    for (; i < count; ++i) {
+        double *v = p + 3 * i;
+        const double x = v[0], y = v[1], z = v[2];
+        v[0] = m[0] * x + m[1] * y + m[2] * z;
+        v[1] = m[3] * x + m[4] * y + m[5] * z;
+        v[2] = m[6] * x + m[7] * y + m[8] * z;
+    }
+}
+
+void transform(int *p, qsizetype count, const Matrix3 &matrix)
+{
+    // Rotate through a small double buffer so the double kernel does the work.
+    enum { BlockSize = 128 };
+    double buffer[3 * BlockSize];
+    for (qsizetype first = 0; first < count; first += BlockSize) {
+        const qsizetype n = 3 * qMin<qsizetype>(BlockSize, count - first);
+        int *block = p + 3 * first;
+        for (qsizetype i = 0; i < n; ++i)
+            buffer[i] = block[i];
+        transform(buffer, n / 3, matrix);
+        for (qsizetype i = 0; i < n; ++i)
+            block[i] = qRound(buffer[i]);
+    }
+}
+
+} // namespace
+
+/*!
+    Adds \a offset to each of the \a count points starting at \a points.
+*/
+void QPoint3DMath::translate(QPoint3D *points, qsizetype count, const QPoint3D &offset)
+{
+    const int k[3] = { offset.x(), offset.y(), offset.z() };
+    addPattern(coordinates(points), 3 * count, k);
+}
+
+/*!
+    \overload
+*/
+void QPoint3DMath::translate(QPoint3DF *points, qsizetype count, const QPoint3DF &offset)
+{
+    const double k[3] = { offset.x(), offset.y(), offset.z() };
+    applyPattern<false>(coordinates(points), 3 * count, k);
+}
+
+/*!
+    Adds the angles of \a offset to each of the \a count rotations starting
+    at \a rotations.
+*/
+void QPoint3DMath::translate(QRotation3D *rotations, qsizetype count, const QRotation3D &offset)
+{
+    const int k[3] = { offset.x(), offset.y(), offset.z() };
+    addPattern(coordinates(rotations), 3 * count, k);
+}
+
+/*!
+    Multiplies each coordinate of the \a count points starting at \a points
+    by \a factor. Integer coordinates are rounded with qRound().
+*/
+void QPoint3DMath::scale(QPoint3D *points, qsizetype count, double factor)
+{
+    const double k[3] = { factor, factor, factor };
+    scalePattern(coordinates(points), 3 * count, k);
+}
+
+/*!
+    \overload
+*/
+void QPoint3DMath::scale(QPoint3DF *points, qsizetype count, double factor)
+{
+    const double k[3] = { factor, factor, factor };
+    applyPattern<true>(coordinates(points), 3 * count, k);
+}
+
+/*!
+    \overload
+
+    Scales each axis by the corresponding coordinate of \a factors.
+*/
+void QPoint3DMath::scale(QPoint3D *points, qsizetype count, const QPoint3DF &factors)
+{
+    const double k[3] = { factors.x(), factors.y(), factors.z() };
+    scalePattern(coordinates(points), 3 * count, k);
+}
+
+/*!
+    \overload
+
+    Scales each axis by the corresponding coordinate of \a factors.
+*/
+void QPoint3DMath::scale(QPoint3DF *points, qsizetype count, const QPoint3DF &factors)
+{
+    const double k[3] = { factors.x(), factors.y(), factors.z() };
+    applyPattern<true>(coordinates(points), 3 * count, k);
+}
+
+/*!
+    Rotates the \a count points starting at \a points around the origin by
+    the Euler \a angles. Integer coordinates are rounded with qRound().
+*/
+void QPoint3DMath::rotate(QPoint3D *points, qsizetype count, const QRotation3D &angles)
+{
+    transform(coordinates(points), count, rotationMatrix(angles));
+}
+
+/*!
+    \overload
+*/
+void QPoint3DMath::rotate(QPoint3DF *points, qsizetype count, const QRotation3D &angles)
+{
+    transform(coordinates(points), count, rotationMatrix(angles));
+}
+
+/*!
+    \overload
+
+    Rotates by the quaternion \a rotation, which does not need to be normalized.
+*/
+void QPoint3DMath::rotate(QPoint3D *points, qsizetype count, const QQuaternion &rotation)
+{
+    transform(coordinates(points), count, rotationMatrix(rotation));
+}
+
+/*!
+    \overload
+
+    Rotates by the quaternion \a rotation, which does not need to be normalized.
+*/
+void QPoint3DMath::rotate(QPoint3DF *points, qsizetype count, const QQuaternion &rotation)
+{
+    transform(coordinates(points), count, rotationMatrix(rotation));
+}
+
+/*!
+    Stores the dot product of \a p1[i] and \a p2[i] in \a results[i] for
+    each of the \a count elements.
+*/
+void QPoint3DMath::dotProduct(const QPoint3DF *p1, const QPoint3DF *p2, double *results, qsizetype count)
+{
+    const double *a = coordinates(p1);
+    const double *b = coordinates(p2);
+    qsizetype i = 0;
+#if defined(QPOINT3DMATH_SSE2)
+    for (; i + 2 <= count; i += 2) {
+        __m128d x1, y1, z1, x2, y2, z2;
+        loadPoints(a + 3 * i, x1, y1, z1);
+        loadPoints(b + 3 * i, x2, y2, z2);
+        _mm_storeu_pd(results + i, dot(x1, y1, z1, x2, y2, z2));
+    }
+#endif
+    for (; i < count; ++i)
+        results[i] = QPoint3DF::dotProduct(p1[i], p2[i]);
+}
+
+/*!
+    Stores the cross product of \a p1[i] and \a p2[i] in \a results[i] for
+    each of the \a count elements. \a results may alias either input.
+*/
+void QPoint3DMath::crossProduct(const QPoint3DF *p1, const QPoint3DF *p2, QPoint3DF *results, qsizetype count)
+{
+    const double *a = coordinates(p1);
+    const double *b = coordinates(p2);
+    double *r = coordinates(results);
+    qsizetype i = 0;
+#if defined(QPOINT3DMATH_SSE2)
+    for (; i + 2 <= count; i += 2) {
+        __m128d x1, y1, z1, x2, y2, z2;
+        loadPoints(a + 3 * i, x1, y1, z1);
+        loadPoints(b + 3 * i, x2, y2, z2);
+        storePoints(r + 3 * i, _mm_sub_pd(_mm_mul_pd(y1, z2), _mm_mul_pd(z1, y2)),
+                               _mm_sub_pd(_mm_mul_pd(z1, x2), _mm_mul_pd(x1, z2)),
+                               _mm_sub_pd(_mm_mul_pd(x1, y2), _mm_mul_pd(y1, x2)));
+    }
+#endif
+    for (; i < count; ++i)
+        results[i] = QPoint3DF::crossProduct(p1[i], p2[i]);
+}
+
+/*!
+    Stores the Euclidean length of \a points[i] in \a results[i] for each
+    of the \a count elements.
+*/
+void QPoint3DMath::length(const QPoint3DF *points, double *results, qsizetype count)
+{
+    const double *p = coordinates(points);
+    qsizetype i = 0;
+#if defined(QPOINT3DMATH_SSE2)
+    for (; i + 2 <= count; i += 2) {
+        __m128d x, y, z;
+        loadPoints(p + 3 * i, x, y, z);
+        _mm_storeu_pd(results + i, _mm_sqrt_pd(dot(x, y, z, x, y, z)));
+    }
+#endif
+    for (; i < count; ++i)
+        results[i] = points[i].length();
+}
+
+/*!
+    Returns the quaternion equivalent of the Euler \a angles.
+*/
+QQuaternion QPoint3DMath::toQuaternion(const QRotation3D &angles)
+{
+    return QQuaternion::fromEulerAngles(float(angles.x()), float(angles.y()), float(angles.z()));
+}
@@ -0,0 +1,41 @@
+#ifndef QPOINT3DMATH_H
+#define QPOINT3DMATH_H
+#include "qpoint3d.h"
+#include "qpoint3df.h"
+#include "qrotation3D.h"
+
+QT_FORWARD_DECLARE_CLASS(QQuaternion)
+
+// Batch operations over contiguous arrays of 3D points and rotations.
+// All functions take a pointer to the first element and an element count;
+// in-place functions modify the given array, the others write one result
+// per input element.
+//
+// Rotations given as QRotation3D are Euler angles in degrees with the same
+// convention as QQuaternion::fromEulerAngles(): x is the pitch, y the yaw
+// and z the roll, applied in the order roll, pitch, yaw.
+namespace QPoint3DMath
+{
+    void translate(QPoint3D *points, qsizetype count, const QPoint3D &offset);
+    void translate(QPoint3DF *points, qsizetype count, const QPoint3DF &offset);
+
+    void scale(QPoint3D *points, qsizetype count, double factor);
+    void scale(QPoint3DF *points, qsizetype count, double factor);
+    void scale(QPoint3D *points, qsizetype count, const QPoint3DF &factors);
+    void scale(QPoint3DF *points, qsizetype count, const QPoint3DF &factors);
+
+    void rotate(QPoint3D *points, qsizetype count, const QRotation3D &angles);
+    void rotate(QPoint3DF *points, qsizetype count, const QRotation3D &angles);
+    void rotate(QPoint3D *points, qsizetype count, const QQuaternion &rotation);
+    void rotate(QPoint3DF *points, qsizetype count, const QQuaternion &rotation);
+
+    void dotProduct(const QPoint3DF *p1, const QPoint3DF *p2, double *results, qsizetype count);
+    void crossProduct(const QPoint3DF *p1, const QPoint3DF *p2, QPoint3DF *results, qsizetype count);
+    void length(const QPoint3DF *points, double *results, qsizetype count);
+
+    void translate(QRotation3D *rotations, qsizetype count, const QRotation3D &offset);
+
+    QQuaternion toQuaternion(const QRotation3D &angles);
+}
+
+#endif // QPOINT3DMATH_H
@@ -48,7 +48,7 @@ public:
 
     static inline int dotProduct(const QRotation3D &p1, const QRotation3D &p2)
     {
-        return p1.xp * p2.xp + p1.yp * p2.yp;
+        return p1.xp * p2.xp + p1.yp * p2.yp + p1.zp * p2.zp;
     }
 
     friend inline bool operator==(const QRotation3D &, const QRotation3D &);
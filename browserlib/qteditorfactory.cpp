@@ -39,6 +39,9 @@
 
 #include "qteditorfactory.h"
 
+#include <cmath>
+#include <limits>
+
 
 #if defined(Q_CC_MSVC)
 #    pragma warning(disable: 4786) /* MS VS 6: truncating debug info after 255 characters */
@@ -46,12 +49,35 @@
 
 QT_BEGIN_NAMESPACE
 
+// Set up a style option for painting the resting state of an editor into
+// the value cell described by option, matching the layout of the real
+// editor (see setupTreeViewEditorMargin()).
+static QStyle *initPaintedEditorOption(QStyleOption *styleOption, const QStyleOptionViewItem &option)
+{
+    const QWidget *widget = option.widget;
+    styleOption->state = option.state & (QStyle::State_Enabled | QStyle::State_Active);
+    styleOption->direction = option.direction;
+    styleOption->rect = option.rect.adjusted(option.direction == Qt::LeftToRight ? 4 : 0, 0,
+                option.direction == Qt::LeftToRight ? 0 : -4, -1);
+    styleOption->palette = option.palette;
+    styleOption->fontMetrics = option.fontMetrics;
+    if (option.state & QStyle::State_Selected) {
+        const QColor text = option.palette.color(QPalette::HighlightedText);
+        styleOption->palette.setColor(QPalette::WindowText, text);
+        styleOption->palette.setColor(QPalette::ButtonText, text);
+    }
+    return widget ? widget->style() : QApplication::style();
+}
+
 // ------------ QtSpinBoxFactory
 void QtSpinBoxFactoryPrivate::slotPropertyChanged(QtProperty *property, int value)
 {
     const auto it = m_createdEditors.constFind(property);
     if (it == m_createdEditors.cend())
         return;
+
+    discardPendingCommits(property);
+
     for (QSpinBox *editor : it.value()) {
         if (editor->value() != value) {
             editor->blockSignals(true);
@@ -93,18 +119,23 @@ void QtSpinBoxFactoryPrivate::slotSingleStepChanged(QtProperty *property, int st
 
 void QtSpinBoxFactoryPrivate::slotSetValue(int value)
 {
-    QObject *object = q_ptr->sender();
-    const QMap<QSpinBox *, QtProperty *>::ConstIterator  ecend = m_editorToProperty.constEnd();
-    for (QMap<QSpinBox *, QtProperty *>::ConstIterator itEditor = m_editorToProperty.constBegin(); itEditor !=  ecend; ++itEditor) {
-        if (itEditor.key() == object) {
-            QtProperty *property = itEditor.value();
-            QtIntPropertyManager *manager = q_ptr->propertyManager(property);
-            if (!manager)
-                return;
-            manager->setValue(property, value);
-            return;
-        }
-    }
+    editorValueChanged(q_ptr, qobject_cast<QSpinBox *>(q_ptr->sender()), value);
+}
+
+void QtSpinBoxFactoryPrivate::slotEditingFinished()
+{
+    editorEditingFinished(qobject_cast<QSpinBox *>(q_ptr->sender()));
+}
+
+void QtSpinBoxFactoryPrivate::slotCommitTimeout()
+{
+    commitTimeout(q_ptr->sender());
+}
+
+void QtSpinBoxFactoryPrivate::commitValue(QtProperty *property, const int &value)
+{
+    if (QtIntPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, value);
 }
 
 /*!
@@ -168,6 +199,7 @@ QWidget *QtSpinBoxFactory::createEditor(QtIntPropertyManager *manager, QtPropert
     editor->setKeyboardTracking(false);
 
     connect(editor, SIGNAL(valueChanged(int)), this, SLOT(slotSetValue(int)));
+    connect(editor, SIGNAL(editingFinished()), this, SLOT(slotEditingFinished()));
     connect(editor, SIGNAL(destroyed(QObject*)),
                 this, SLOT(slotEditorDestroyed(QObject*)));
     return editor;
@@ -194,6 +226,9 @@ void QtSliderFactoryPrivate::slotPropertyChanged(QtProperty *property, int value
     const auto it = m_createdEditors.constFind(property);
     if (it == m_createdEditors.cend())
         return;
+
+    discardPendingCommits(property);
+
     for (QSlider *editor : it.value()) {
         editor->blockSignals(true);
         editor->setValue(value);
@@ -233,18 +268,26 @@ void QtSliderFactoryPrivate::slotSingleStepChanged(QtProperty *property, int ste
 
 void QtSliderFactoryPrivate::slotSetValue(int value)
 {
-    QObject *object = q_ptr->sender();
-    const QMap<QSlider *, QtProperty *>::ConstIterator ecend = m_editorToProperty.constEnd();
-    for (QMap<QSlider *, QtProperty *>::ConstIterator itEditor = m_editorToProperty.constBegin(); itEditor != ecend; ++itEditor ) {
-        if (itEditor.key() == object) {
-            QtProperty *property = itEditor.value();
-            QtIntPropertyManager *manager = q_ptr->propertyManager(property);
-            if (!manager)
-                return;
-            manager->setValue(property, value);
-            return;
-        }
-    }
+    QSlider *editor = qobject_cast<QSlider *>(q_ptr->sender());
+    // Steps made with the keyboard or by clicking the groove are complete
+    // edits, only dragging the handle reports intermediate values.
+    editorValueChanged(q_ptr, editor, value, editor && !editor->isSliderDown());
+}
+
+void QtSliderFactoryPrivate::slotEditingFinished()
+{
+    editorEditingFinished(qobject_cast<QSlider *>(q_ptr->sender()));
+}
+
+void QtSliderFactoryPrivate::slotCommitTimeout()
+{
+    commitTimeout(q_ptr->sender());
+}
+
+void QtSliderFactoryPrivate::commitValue(QtProperty *property, const int &value)
+{
+    if (QtIntPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, value);
 }
 
 /*!
@@ -307,11 +350,35 @@ QWidget *QtSliderFactory::createEditor(QtIntPropertyManager *manager, QtProperty
     editor->setValue(manager->value(property));
 
     connect(editor, SIGNAL(valueChanged(int)), this, SLOT(slotSetValue(int)));
+    connect(editor, SIGNAL(sliderReleased()), this, SLOT(slotEditingFinished()));
     connect(editor, SIGNAL(destroyed(QObject*)),
                 this, SLOT(slotEditorDestroyed(QObject*)));
     return editor;
 }
 
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+bool QtSliderFactory::paintEditor(QtIntPropertyManager *manager, QtProperty *property,
+        QPainter *painter, const QStyleOptionViewItem &option)
+{
+    QStyleOptionSlider opt;
+    QStyle *style = initPaintedEditorOption(&opt, option);
+    opt.orientation = Qt::Horizontal;
+    opt.minimum = manager->minimum(property);
+    opt.maximum = manager->maximum(property);
+    opt.sliderPosition = opt.sliderValue = manager->value(property);
+    opt.singleStep = manager->singleStep(property);
+    opt.pageStep = 10 * opt.singleStep;
+    opt.upsideDown = option.direction == Qt::RightToLeft;
+    opt.subControls = QStyle::SC_SliderGroove | QStyle::SC_SliderHandle;
+    opt.activeSubControls = QStyle::SC_None;
+    style->drawComplexControl(QStyle::CC_Slider, &opt, painter, option.widget);
+    return true;
+}
+
 /*!
     \internal
 
@@ -334,6 +401,8 @@ void QtScrollBarFactoryPrivate::slotPropertyChanged(QtProperty *property, int va
     if (it == m_createdEditors.cend())
         return;
 
+    discardPendingCommits(property);
+
     for (QScrollBar *editor : it.value()) {
         editor->blockSignals(true);
         editor->setValue(value);
@@ -373,17 +442,26 @@ void QtScrollBarFactoryPrivate::slotSingleStepChanged(QtProperty *property, int
 
 void QtScrollBarFactoryPrivate::slotSetValue(int value)
 {
-    QObject *object = q_ptr->sender();
-    const QMap<QScrollBar *, QtProperty *>::ConstIterator ecend = m_editorToProperty.constEnd();
-    for (QMap<QScrollBar *, QtProperty *>::ConstIterator itEditor = m_editorToProperty.constBegin(); itEditor != ecend; ++itEditor)
-        if (itEditor.key() == object) {
-            QtProperty *property = itEditor.value();
-            QtIntPropertyManager *manager = q_ptr->propertyManager(property);
-            if (!manager)
-                return;
-            manager->setValue(property, value);
-            return;
-        }
+    QScrollBar *editor = qobject_cast<QScrollBar *>(q_ptr->sender());
+    // Steps made with the keyboard or by clicking the groove are complete
+    // edits, only dragging the handle reports intermediate values.
+    editorValueChanged(q_ptr, editor, value, editor && !editor->isSliderDown());
+}
+
+void QtScrollBarFactoryPrivate::slotEditingFinished()
+{
+    editorEditingFinished(qobject_cast<QScrollBar *>(q_ptr->sender()));
+}
+
+void QtScrollBarFactoryPrivate::slotCommitTimeout()
+{
+    commitTimeout(q_ptr->sender());
+}
+
+void QtScrollBarFactoryPrivate::commitValue(QtProperty *property, const int &value)
+{
+    if (QtIntPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, value);
 }
 
 /*!
@@ -445,6 +523,110 @@ QWidget *QtScrollBarFactory::createEditor(QtIntPropertyManager *manager, QtPrope
     editor->setRange(manager->minimum(property), manager->maximum(property));
     editor->setValue(manager->value(property));
     connect(editor, SIGNAL(valueChanged(int)), this, SLOT(slotSetValue(int)));
+    connect(editor, SIGNAL(sliderReleased()), this, SLOT(slotEditingFinished()));
+    connect(editor, SIGNAL(destroyed(QObject*)),
+                this, SLOT(slotEditorDestroyed(QObject*)));
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtScrollBarFactory::disconnectPropertyManager(QtIntPropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,int)),
+                this, SLOT(slotPropertyChanged(QtProperty*,int)));
+    disconnect(manager, SIGNAL(rangeChanged(QtProperty*,int,int)),
+                this, SLOT(slotRangeChanged(QtProperty*,int,int)));
+    disconnect(manager, SIGNAL(singleStepChanged(QtProperty*,int)),
+                this, SLOT(slotSingleStepChanged(QtProperty*,int)));
+}
+
+// QtCheckBoxFactory
+void QtCheckBoxFactoryPrivate::slotPropertyChanged(QtProperty *property, bool value)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    for (QtBoolEdit *editor : it.value()) {
+        editor->blockCheckBoxSignals(true);
+        editor->setChecked(value);
+        editor->blockCheckBoxSignals(false);
+    }
+}
+
+void QtCheckBoxFactoryPrivate::slotSetValue(bool value)
+{
+    QObject *object = q_ptr->sender();
+
+    const QMap<QtBoolEdit *, QtProperty *>::ConstIterator ecend = m_editorToProperty.constEnd();
+    for (QMap<QtBoolEdit *, QtProperty *>::ConstIterator itEditor = m_editorToProperty.constBegin(); itEditor != ecend;  ++itEditor)
+        if (itEditor.key() == object) {
+            QtProperty *property = itEditor.value();
+            QtBoolPropertyManager *manager = q_ptr->propertyManager(property);
+            if (!manager)
+                return;
+            manager->setValue(property, value);
+            return;
+        }
+}
+
+/*!
+    \class QtCheckBoxFactory
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtCheckBoxFactory class provides QCheckBox widgets for
+    properties created by QtBoolPropertyManager objects.
+
+    \sa QtAbstractEditorFactory, QtBoolPropertyManager
+*/
+
+/*!
+    Creates a factory with the given \a parent.
+*/
+QtCheckBoxFactory::QtCheckBoxFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtBoolPropertyManager>(parent), d_ptr(new QtCheckBoxFactoryPrivate())
+{
+    d_ptr->q_ptr = this;
+
+}
+
+/*!
+    Destroys this factory, and all the widgets it has created.
+*/
+QtCheckBoxFactory::~QtCheckBoxFactory()
+{
+    qDeleteAll(d_ptr->m_editorToProperty.keys());
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtCheckBoxFactory::connectPropertyManager(QtBoolPropertyManager *manager)
+{
+    connect(manager, SIGNAL(valueChanged(QtProperty*,bool)),
+                this, SLOT(slotPropertyChanged(QtProperty*,bool)));
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+QWidget *QtCheckBoxFactory::createEditor(QtBoolPropertyManager *manager, QtProperty *property,
+        QWidget *parent)
+{
+    QtBoolEdit *editor = d_ptr->createEditor(property, parent);
+    editor->setChecked(manager->value(property));
+
+    connect(editor, SIGNAL(toggled(bool)), this, SLOT(slotSetValue(bool)));
     connect(editor, SIGNAL(destroyed(QObject*)),
                 this, SLOT(slotEditorDestroyed(QObject*)));
     return editor;
@@ -453,74 +635,1098 @@ QWidget *QtScrollBarFactory::createEditor(QtIntPropertyManager *manager, QtPrope
 /*!
     \internal
 
-    Reimplemented from the QtAbstractEditorFactory class.
-*/
-void QtScrollBarFactory::disconnectPropertyManager(QtIntPropertyManager *manager)
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+bool QtCheckBoxFactory::paintEditor(QtBoolPropertyManager *manager, QtProperty *property,
+        QPainter *painter, const QStyleOptionViewItem &option)
+{
+    QStyleOptionButton opt;
+    QStyle *style = initPaintedEditorOption(&opt, option);
+    opt.state |= manager->value(property) ? QStyle::State_On : QStyle::State_Off;
+    opt.text = property->valueText();
+    style->drawControl(QStyle::CE_CheckBox, &opt, painter, option.widget);
+    return true;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtCheckBoxFactory::disconnectPropertyManager(QtBoolPropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,bool)),
+                this, SLOT(slotPropertyChanged(QtProperty*,bool)));
+}
+
+// QtDoubleSpinBoxFactory
+void QtDoubleSpinBoxFactoryPrivate::slotPropertyChanged(QtProperty *property, double value)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    discardPendingCommits(property);
+
+    for (QDoubleSpinBox *editor : it.value()) {
+        if (editor->value() != value) {
+            editor->blockSignals(true);
+            editor->setValue(value);
+            editor->blockSignals(false);
+        }
+    }
+}
+
+void QtDoubleSpinBoxFactoryPrivate::slotRangeChanged(QtProperty *property,
+            double min, double max)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    QtDoublePropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    for (QDoubleSpinBox *editor : it.value()) {
+        editor->blockSignals(true);
+        editor->setRange(min, max);
+        editor->setValue(manager->value(property));
+        editor->blockSignals(false);
+    }
+}
+
+void QtDoubleSpinBoxFactoryPrivate::slotSingleStepChanged(QtProperty *property, double step)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    QtDoublePropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    for (QDoubleSpinBox *editor : it.value()) {
+        editor->blockSignals(true);
+        editor->setSingleStep(step);
+        editor->blockSignals(false);
+    }
+}
+
+void QtDoubleSpinBoxFactoryPrivate::slotDecimalsChanged(QtProperty *property, int prec)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.constEnd())
+        return;
+
+    QtDoublePropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    for (QDoubleSpinBox *editor : it.value()) {
+        editor->blockSignals(true);
+        editor->setDecimals(prec);
+        editor->setValue(manager->value(property));
+        editor->blockSignals(false);
+    }
+}
+
+void QtDoubleSpinBoxFactoryPrivate::slotSetValue(double value)
+{
+    editorValueChanged(q_ptr, qobject_cast<QDoubleSpinBox *>(q_ptr->sender()), value);
+}
+
+void QtDoubleSpinBoxFactoryPrivate::slotEditingFinished()
+{
+    editorEditingFinished(qobject_cast<QDoubleSpinBox *>(q_ptr->sender()));
+}
+
+void QtDoubleSpinBoxFactoryPrivate::slotCommitTimeout()
+{
+    commitTimeout(q_ptr->sender());
+}
+
+void QtDoubleSpinBoxFactoryPrivate::commitValue(QtProperty *property, const double &value)
+{
+    if (QtDoublePropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, value);
+}
+
+/*! \class QtDoubleSpinBoxFactory
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtDoubleSpinBoxFactory class provides QDoubleSpinBox
+    widgets for properties created by QtDoublePropertyManager objects.
+
+    \sa QtAbstractEditorFactory, QtDoublePropertyManager
+*/
+
+/*!
+    Creates a factory with the given \a parent.
+*/
+QtDoubleSpinBoxFactory::QtDoubleSpinBoxFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtDoublePropertyManager>(parent), d_ptr(new QtDoubleSpinBoxFactoryPrivate())
+{
+    d_ptr->q_ptr = this;
+
+}
+
+/*!
+    Destroys this factory, and all the widgets it has created.
+*/
+QtDoubleSpinBoxFactory::~QtDoubleSpinBoxFactory()
+{
+    qDeleteAll(d_ptr->m_editorToProperty.keys());
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtDoubleSpinBoxFactory::connectPropertyManager(QtDoublePropertyManager *manager)
+{
+    connect(manager, SIGNAL(valueChanged(QtProperty*,double)),
+                this, SLOT(slotPropertyChanged(QtProperty*,double)));
+    connect(manager, SIGNAL(rangeChanged(QtProperty*,double,double)),
+                this, SLOT(slotRangeChanged(QtProperty*,double,double)));
+    connect(manager, SIGNAL(singleStepChanged(QtProperty*,double)),
+                this, SLOT(slotSingleStepChanged(QtProperty*,double)));
+    connect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+QWidget *QtDoubleSpinBoxFactory::createEditor(QtDoublePropertyManager *manager,
+        QtProperty *property, QWidget *parent)
+{
+    QDoubleSpinBox *editor = d_ptr->createEditor(property, parent);
+    editor->setStepType(QAbstractSpinBox::AdaptiveDecimalStepType);
+    editor->setSingleStep(manager->singleStep(property));
+    editor->setDecimals(manager->decimals(property));
+    editor->setRange(manager->minimum(property), manager->maximum(property));
+    editor->setValue(manager->value(property));
+    editor->setKeyboardTracking(false);
+
+    connect(editor, SIGNAL(valueChanged(double)), this, SLOT(slotSetValue(double)));
+    connect(editor, SIGNAL(editingFinished()), this, SLOT(slotEditingFinished()));
+    connect(editor, SIGNAL(destroyed(QObject*)),
+                this, SLOT(slotEditorDestroyed(QObject*)));
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtDoubleSpinBoxFactory::disconnectPropertyManager(QtDoublePropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,double)),
+                this, SLOT(slotPropertyChanged(QtProperty*,double)));
+    disconnect(manager, SIGNAL(rangeChanged(QtProperty*,double,double)),
+                this, SLOT(slotRangeChanged(QtProperty*,double,double)));
+    disconnect(manager, SIGNAL(singleStepChanged(QtProperty*,double)),
+                this, SLOT(slotSingleStepChanged(QtProperty*,double)));
+    disconnect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
+}
+
+// QtArrayEditWidget
+QtArrayEditWidget::QtArrayEditWidget(QWidget *parent) :
+    QWidget(parent),
+    m_indexSpinBox(new QSpinBox),
+    m_valueSpinBox(new QDoubleSpinBox)
+{
+    QHBoxLayout *lt = new QHBoxLayout(this);
+    setupTreeViewEditorMargin(lt);
+    lt->setSpacing(2);
+
+    m_indexSpinBox->setPrefix(QLatin1String("["));
+    m_indexSpinBox->setSuffix(QLatin1String("]"));
+    m_indexSpinBox->setRange(0, 0);
+    m_indexSpinBox->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Preferred);
+    m_indexSpinBox->setToolTip(tr("Element"));
+    lt->addWidget(m_indexSpinBox);
+
+    m_valueSpinBox->setStepType(QAbstractSpinBox::AdaptiveDecimalStepType);
+    m_valueSpinBox->setKeyboardTracking(false);
+    m_valueSpinBox->setEnabled(false);
+    lt->addWidget(m_valueSpinBox, 1);
+
+    setFocusProxy(m_valueSpinBox);
+    setFocusPolicy(m_valueSpinBox->focusPolicy());
+
+    connect(m_indexSpinBox, SIGNAL(valueChanged(int)), this, SLOT(slotIndexChanged(int)));
+    connect(m_valueSpinBox, SIGNAL(valueChanged(double)), this, SLOT(slotValueChanged(double)));
+}
+
+int QtArrayEditWidget::currentIndex() const
+{
+    return m_indexSpinBox->value();
+}
+
+void QtArrayEditWidget::setCount(int count)
+{
+    const int oldIndex = m_indexSpinBox->value();
+    m_indexSpinBox->blockSignals(true);
+    m_indexSpinBox->setRange(0, qMax(0, count - 1));
+    m_indexSpinBox->blockSignals(false);
+    m_valueSpinBox->setEnabled(count > 0);
+    if (m_indexSpinBox->value() != oldIndex)
+        emit currentIndexChanged(m_indexSpinBox->value());
+}
+
+void QtArrayEditWidget::setRange(double minVal, double maxVal)
+{
+    m_valueSpinBox->blockSignals(true);
+    m_valueSpinBox->setRange(minVal, maxVal);
+    m_valueSpinBox->blockSignals(false);
+}
+
+void QtArrayEditWidget::setDecimals(int prec)
+{
+    m_valueSpinBox->blockSignals(true);
+    m_valueSpinBox->setDecimals(prec);
+    m_valueSpinBox->blockSignals(false);
+}
+
+void QtArrayEditWidget::setCurrentValue(double value)
+{
+    if (m_valueSpinBox->value() == value)
+        return;
+    m_valueSpinBox->blockSignals(true);
+    m_valueSpinBox->setValue(value);
+    m_valueSpinBox->blockSignals(false);
+}
+
+void QtArrayEditWidget::slotIndexChanged(int index)
+{
+    emit currentIndexChanged(index);
+}
+
+void QtArrayEditWidget::slotValueChanged(double value)
+{
+    emit valueChanged(m_indexSpinBox->value(), value);
+}
+
+// QtVector3DEditWidget
+QtVector3DEditWidget::QtVector3DEditWidget(QWidget *parent) :
+    QWidget(parent)
+{
+    QHBoxLayout *lt = new QHBoxLayout(this);
+    setupTreeViewEditorMargin(lt);
+    lt->setSpacing(2);
+
+    static const char *const toolTips[3] = {
+        QT_TRANSLATE_NOOP("QtVector3DEditWidget", "X"),
+        QT_TRANSLATE_NOOP("QtVector3DEditWidget", "Y"),
+        QT_TRANSLATE_NOOP("QtVector3DEditWidget", "Z")
+    };
+    for (int i = 0; i < 3; ++i) {
+        QDoubleSpinBox *spinBox = new QDoubleSpinBox;
+        spinBox->setToolTip(tr(toolTips[i]));
+        spinBox->setButtonSymbols(QAbstractSpinBox::NoButtons);
+        spinBox->setKeyboardTracking(false);
+        lt->addWidget(spinBox, 1);
+        connect(spinBox, SIGNAL(valueChanged(double)), this, SLOT(slotValueChanged()));
+        m_spinBoxes[i] = spinBox;
+    }
+
+    setFocusProxy(m_spinBoxes[0]);
+    setFocusPolicy(m_spinBoxes[0]->focusPolicy());
+}
+
+void QtVector3DEditWidget::setRange(double minVal, double maxVal)
+{
+    for (QDoubleSpinBox *spinBox : m_spinBoxes) {
+        spinBox->blockSignals(true);
+        spinBox->setRange(minVal, maxVal);
+        spinBox->blockSignals(false);
+    }
+}
+
+void QtVector3DEditWidget::setDecimals(int prec)
+{
+    for (QDoubleSpinBox *spinBox : m_spinBoxes) {
+        spinBox->blockSignals(true);
+        spinBox->setDecimals(prec);
+        spinBox->blockSignals(false);
+    }
+}
+
+void QtVector3DEditWidget::setSuffix(const QString &suffix)
+{
+    for (QDoubleSpinBox *spinBox : m_spinBoxes)
+        spinBox->setSuffix(suffix);
+}
+
+void QtVector3DEditWidget::setValue(double x, double y, double z)
+{
+    const double values[3] = { x, y, z };
+    for (int i = 0; i < 3; ++i) {
+        if (m_spinBoxes[i]->value() == values[i])
+            continue;
+        m_spinBoxes[i]->blockSignals(true);
+        m_spinBoxes[i]->setValue(values[i]);
+        m_spinBoxes[i]->blockSignals(false);
+    }
+}
+
+void QtVector3DEditWidget::slotValueChanged()
+{
+    emit valueChanged(m_spinBoxes[0]->value(), m_spinBoxes[1]->value(), m_spinBoxes[2]->value());
+}
+
+// QtIntArrayEditorFactory
+void QtIntArrayEditorFactoryPrivate::slotValuesChanged(QtProperty *property, const QList<int> &values)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (QtArrayEditWidget *editor : it.value()) {
+        editor->setCount(int(values.size()));
+        editor->setCurrentValue(values.value(editor->currentIndex(), 0));
+    }
+}
+
+void QtIntArrayEditorFactoryPrivate::slotValueChanged(QtProperty *property, int index, int value)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (QtArrayEditWidget *editor : it.value()) {
+        if (editor->currentIndex() == index)
+            editor->setCurrentValue(value);
+    }
+}
+
+void QtIntArrayEditorFactoryPrivate::slotRangeChanged(QtProperty *property, int min, int max)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    QtIntArrayPropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    for (QtArrayEditWidget *editor : it.value()) {
+        editor->setRange(min, max);
+        editor->setCurrentValue(manager->value(property, editor->currentIndex()));
+    }
+}
+
+void QtIntArrayEditorFactoryPrivate::slotCurrentIndexChanged(int index)
+{
+    QtArrayEditWidget *editor = qobject_cast<QtArrayEditWidget *>(q_ptr->sender());
+    QtProperty *property = m_editorToProperty.value(editor, 0);
+    if (!property)
+        return;
+    if (QtIntArrayPropertyManager *manager = q_ptr->propertyManager(property))
+        editor->setCurrentValue(manager->value(property, index));
+}
+
+void QtIntArrayEditorFactoryPrivate::slotSetValue(int index, double value)
+{
+    QtProperty *property = m_editorToProperty.value(qobject_cast<QtArrayEditWidget *>(q_ptr->sender()), 0);
+    if (!property)
+        return;
+    if (QtIntArrayPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, index, qRound(value));
+}
+
+/*!
+    \class QtIntArrayEditorFactory
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtIntArrayEditorFactory class provides editors for
+    properties created by QtIntArrayPropertyManager objects.
+
+    The editor shows one element at a time together with its index,
+    which can be changed to page through the array.
+
+    \sa QtAbstractEditorFactory, QtIntArrayPropertyManager
+*/
+
+/*!
+    Creates a factory with the given \a parent.
+*/
+QtIntArrayEditorFactory::QtIntArrayEditorFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtIntArrayPropertyManager>(parent), d_ptr(new QtIntArrayEditorFactoryPrivate())
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this factory, and all the widgets it has created.
+*/
+QtIntArrayEditorFactory::~QtIntArrayEditorFactory()
+{
+    qDeleteAll(d_ptr->m_editorToProperty.keys());
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtIntArrayEditorFactory::connectPropertyManager(QtIntArrayPropertyManager *manager)
+{
+    connect(manager, SIGNAL(valuesChanged(QtProperty*,QList<int>)),
+                this, SLOT(slotValuesChanged(QtProperty*,QList<int>)));
+    connect(manager, SIGNAL(valueChanged(QtProperty*,int,int)),
+                this, SLOT(slotValueChanged(QtProperty*,int,int)));
+    connect(manager, SIGNAL(rangeChanged(QtProperty*,int,int)),
+                this, SLOT(slotRangeChanged(QtProperty*,int,int)));
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+QWidget *QtIntArrayEditorFactory::createEditor(QtIntArrayPropertyManager *manager,
+        QtProperty *property, QWidget *parent)
+{
+    QtArrayEditWidget *editor = d_ptr->createEditor(property, parent);
+    editor->setDecimals(0);
+    editor->setRange(manager->minimum(property), manager->maximum(property));
+    editor->setCount(manager->count(property));
+    editor->setCurrentValue(manager->value(property, editor->currentIndex()));
+
+    connect(editor, SIGNAL(currentIndexChanged(int)), this, SLOT(slotCurrentIndexChanged(int)));
+    connect(editor, SIGNAL(valueChanged(int,double)), this, SLOT(slotSetValue(int,double)));
+    connect(editor, SIGNAL(destroyed(QObject*)),
+                this, SLOT(slotEditorDestroyed(QObject*)));
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtIntArrayEditorFactory::disconnectPropertyManager(QtIntArrayPropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valuesChanged(QtProperty*,QList<int>)),
+                this, SLOT(slotValuesChanged(QtProperty*,QList<int>)));
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,int,int)),
+                this, SLOT(slotValueChanged(QtProperty*,int,int)));
+    disconnect(manager, SIGNAL(rangeChanged(QtProperty*,int,int)),
+                this, SLOT(slotRangeChanged(QtProperty*,int,int)));
+}
+
+// QtDoubleArrayEditorFactory
+void QtDoubleArrayEditorFactoryPrivate::slotValuesChanged(QtProperty *property, const QList<double> &values)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (QtArrayEditWidget *editor : it.value()) {
+        editor->setCount(int(values.size()));
+        editor->setCurrentValue(values.value(editor->currentIndex(), 0.0));
+    }
+}
+
+void QtDoubleArrayEditorFactoryPrivate::slotValueChanged(QtProperty *property, int index, double value)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (QtArrayEditWidget *editor : it.value()) {
+        if (editor->currentIndex() == index)
+            editor->setCurrentValue(value);
+    }
+}
+
+void QtDoubleArrayEditorFactoryPrivate::slotRangeChanged(QtProperty *property, double min, double max)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    QtDoubleArrayPropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    for (QtArrayEditWidget *editor : it.value()) {
+        editor->setRange(min, max);
+        editor->setCurrentValue(manager->value(property, editor->currentIndex()));
+    }
+}
+
+void QtDoubleArrayEditorFactoryPrivate::slotDecimalsChanged(QtProperty *property, int prec)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    QtDoubleArrayPropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    for (QtArrayEditWidget *editor : it.value()) {
+        editor->setDecimals(prec);
+        editor->setCurrentValue(manager->value(property, editor->currentIndex()));
+    }
+}
+
+void QtDoubleArrayEditorFactoryPrivate::slotCurrentIndexChanged(int index)
+{
+    QtArrayEditWidget *editor = qobject_cast<QtArrayEditWidget *>(q_ptr->sender());
+    QtProperty *property = m_editorToProperty.value(editor, 0);
+    if (!property)
+        return;
+    if (QtDoubleArrayPropertyManager *manager = q_ptr->propertyManager(property))
+        editor->setCurrentValue(manager->value(property, index));
+}
+
+void QtDoubleArrayEditorFactoryPrivate::slotSetValue(int index, double value)
+{
+    QtProperty *property = m_editorToProperty.value(qobject_cast<QtArrayEditWidget *>(q_ptr->sender()), 0);
+    if (!property)
+        return;
+    if (QtDoubleArrayPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, index, value);
+}
+
+/*!
+    \class QtDoubleArrayEditorFactory
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtDoubleArrayEditorFactory class provides editors for
+    properties created by QtDoubleArrayPropertyManager objects.
+
+    The editor shows one element at a time together with its index,
+    which can be changed to page through the array.
+
+    \sa QtAbstractEditorFactory, QtDoubleArrayPropertyManager
+*/
+
+/*!
+    Creates a factory with the given \a parent.
+*/
+QtDoubleArrayEditorFactory::QtDoubleArrayEditorFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtDoubleArrayPropertyManager>(parent), d_ptr(new QtDoubleArrayEditorFactoryPrivate())
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this factory, and all the widgets it has created.
+*/
+QtDoubleArrayEditorFactory::~QtDoubleArrayEditorFactory()
+{
+    qDeleteAll(d_ptr->m_editorToProperty.keys());
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtDoubleArrayEditorFactory::connectPropertyManager(QtDoubleArrayPropertyManager *manager)
+{
+    connect(manager, SIGNAL(valuesChanged(QtProperty*,QList<double>)),
+                this, SLOT(slotValuesChanged(QtProperty*,QList<double>)));
+    connect(manager, SIGNAL(valueChanged(QtProperty*,int,double)),
+                this, SLOT(slotValueChanged(QtProperty*,int,double)));
+    connect(manager, SIGNAL(rangeChanged(QtProperty*,double,double)),
+                this, SLOT(slotRangeChanged(QtProperty*,double,double)));
+    connect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+QWidget *QtDoubleArrayEditorFactory::createEditor(QtDoubleArrayPropertyManager *manager,
+        QtProperty *property, QWidget *parent)
+{
+    QtArrayEditWidget *editor = d_ptr->createEditor(property, parent);
+    editor->setDecimals(manager->decimals(property));
+    editor->setRange(manager->minimum(property), manager->maximum(property));
+    editor->setCount(manager->count(property));
+    editor->setCurrentValue(manager->value(property, editor->currentIndex()));
+
+    connect(editor, SIGNAL(currentIndexChanged(int)), this, SLOT(slotCurrentIndexChanged(int)));
+    connect(editor, SIGNAL(valueChanged(int,double)), this, SLOT(slotSetValue(int,double)));
+    connect(editor, SIGNAL(destroyed(QObject*)),
+                this, SLOT(slotEditorDestroyed(QObject*)));
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtDoubleArrayEditorFactory::disconnectPropertyManager(QtDoubleArrayPropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valuesChanged(QtProperty*,QList<double>)),
+                this, SLOT(slotValuesChanged(QtProperty*,QList<double>)));
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,int,double)),
+                this, SLOT(slotValueChanged(QtProperty*,int,double)));
+    disconnect(manager, SIGNAL(rangeChanged(QtProperty*,double,double)),
+                this, SLOT(slotRangeChanged(QtProperty*,double,double)));
+    disconnect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
+}
+
+// Paints a resting RangeSlider: the groove, the selected span and both handles.
+static void paintRangeSlider(QPainter *painter, const QStyleOptionViewItem &option,
+            int minimum, int maximum, int minimumValue, int maximumValue)
+{
+    QStyleOptionSlider opt;
+    QStyle *style = initPaintedEditorOption(&opt, option);
+    opt.orientation = Qt::Horizontal;
+    opt.minimum = minimum;
+    opt.maximum = maximum;
+    opt.upsideDown = option.direction == Qt::RightToLeft;
+    opt.activeSubControls = QStyle::SC_None;
+
+    // Keep the groove from being highlighted up to a handle, see RangeSlider::paintEvent().
+    opt.subControls = QStyle::SC_SliderGroove;
+    opt.sliderPosition = opt.sliderValue = minimum;
+    style->drawComplexControl(QStyle::CC_Slider, &opt, painter, option.widget);
+
+    const QRect groove = style->subControlRect(QStyle::CC_Slider, &opt, QStyle::SC_SliderGroove, option.widget);
+    opt.sliderPosition = minimumValue;
+    const QRect lowerHandle = style->subControlRect(QStyle::CC_Slider, &opt, QStyle::SC_SliderHandle, option.widget);
+    opt.sliderPosition = maximumValue;
+    const QRect upperHandle = style->subControlRect(QStyle::CC_Slider, &opt, QStyle::SC_SliderHandle, option.widget);
+
+    const QColor highlight = opt.palette.color(QPalette::Normal, QPalette::Highlight);
+    const QRect span(QPoint(qMin(lowerHandle.center().x(), upperHandle.center().x()), groove.center().y() - 2),
+                     QPoint(qMax(lowerHandle.center().x(), upperHandle.center().x()), groove.center().y() + 1));
+    painter->save();
+    painter->setPen(QPen(highlight.darker(150), 0));
+    painter->setBrush(highlight);
+    painter->drawRect(span.intersected(groove));
+    painter->restore();
+
+    opt.subControls = QStyle::SC_SliderHandle;
+    opt.sliderPosition = opt.sliderValue = minimumValue;
+    style->drawComplexControl(QStyle::CC_Slider, &opt, painter, option.widget);
+    opt.sliderPosition = opt.sliderValue = maximumValue;
+    style->drawComplexControl(QStyle::CC_Slider, &opt, painter, option.widget);
+}
+
+// QtPoint3DEditorFactory
+void QtPoint3DEditorFactoryPrivate::slotPropertyChanged(QtProperty *property, const QPoint3D &value)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (QtVector3DEditWidget *editor : it.value())
+        editor->setValue(value.x(), value.y(), value.z());
+}
+
+void QtPoint3DEditorFactoryPrivate::slotPropertiesChanged(const QList<QtProperty *> &properties)
+{
+    for (QtProperty *property : properties) {
+        if (QtPoint3DPropertyManager *manager = q_ptr->propertyManager(property))
+            slotPropertyChanged(property, manager->value(property));
+    }
+}
+
+void QtPoint3DEditorFactoryPrivate::slotSetValue(double x, double y, double z)
+{
+    QtProperty *property = m_editorToProperty.value(qobject_cast<QtVector3DEditWidget *>(q_ptr->sender()), 0);
+    if (!property)
+        return;
+    if (QtPoint3DPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, QPoint3D(qRound(x), qRound(y), qRound(z)));
+}
+
+/*!
+    \class QtPoint3DEditorFactory
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtPoint3DEditorFactory class provides editors for
+    properties created by QtPoint3DPropertyManager objects.
+
+    The editor shows the X, Y and Z components next to each other and
+    commits the whole point when any of them is edited, so the
+    property's subproperties don't have to be created for editing.
+
+    \sa QtAbstractEditorFactory, QtPoint3DPropertyManager
+*/
+
+/*!
+    Creates a factory with the given \a parent.
+*/
+QtPoint3DEditorFactory::QtPoint3DEditorFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtPoint3DPropertyManager>(parent), d_ptr(new QtPoint3DEditorFactoryPrivate())
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this factory, and all the widgets it has created.
+*/
+QtPoint3DEditorFactory::~QtPoint3DEditorFactory()
+{
+    qDeleteAll(d_ptr->m_editorToProperty.keys());
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtPoint3DEditorFactory::connectPropertyManager(QtPoint3DPropertyManager *manager)
+{
+    connect(manager, SIGNAL(valueChanged(QtProperty*,QPoint3D)),
+                this, SLOT(slotPropertyChanged(QtProperty*,QPoint3D)));
+    connect(manager, SIGNAL(valuesChanged(QList<QtProperty*>)),
+                this, SLOT(slotPropertiesChanged(QList<QtProperty*>)));
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+QWidget *QtPoint3DEditorFactory::createEditor(QtPoint3DPropertyManager *manager,
+        QtProperty *property, QWidget *parent)
+{
+    QtVector3DEditWidget *editor = d_ptr->createEditor(property, parent);
+    editor->setDecimals(0);
+    editor->setRange(INT_MIN, INT_MAX);
+    const QPoint3D value = manager->value(property);
+    editor->setValue(value.x(), value.y(), value.z());
+
+    connect(editor, SIGNAL(valueChanged(double,double,double)),
+                this, SLOT(slotSetValue(double,double,double)));
+    connect(editor, SIGNAL(destroyed(QObject*)),
+                this, SLOT(slotEditorDestroyed(QObject*)));
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtPoint3DEditorFactory::disconnectPropertyManager(QtPoint3DPropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,QPoint3D)),
+                this, SLOT(slotPropertyChanged(QtProperty*,QPoint3D)));
+    disconnect(manager, SIGNAL(valuesChanged(QList<QtProperty*>)),
+                this, SLOT(slotPropertiesChanged(QList<QtProperty*>)));
+}
+
+// QtPoint3DFEditorFactory
+void QtPoint3DFEditorFactoryPrivate::slotPropertyChanged(QtProperty *property, const QPoint3DF &value)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (QtVector3DEditWidget *editor : it.value())
+        editor->setValue(value.x(), value.y(), value.z());
+}
+
+void QtPoint3DFEditorFactoryPrivate::slotPropertiesChanged(const QList<QtProperty *> &properties)
+{
+    for (QtProperty *property : properties) {
+        if (QtPoint3DFPropertyManager *manager = q_ptr->propertyManager(property))
+            slotPropertyChanged(property, manager->value(property));
+    }
+}
+
+void QtPoint3DFEditorFactoryPrivate::slotDecimalsChanged(QtProperty *property, int prec)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+
+    QtPoint3DFPropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    const QPoint3DF value = manager->value(property);
+    for (QtVector3DEditWidget *editor : it.value()) {
+        editor->setDecimals(prec);
+        editor->setValue(value.x(), value.y(), value.z());
+    }
+}
+
+void QtPoint3DFEditorFactoryPrivate::slotSetValue(double x, double y, double z)
+{
+    QtProperty *property = m_editorToProperty.value(qobject_cast<QtVector3DEditWidget *>(q_ptr->sender()), 0);
+    if (!property)
+        return;
+    if (QtPoint3DFPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, QPoint3DF(x, y, z));
+}
+
+/*!
+    \class QtPoint3DFEditorFactory
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtPoint3DFEditorFactory class provides editors for
+    properties created by QtPoint3DFPropertyManager objects.
+
+    Like QtPoint3DEditorFactory, the editor commits all three
+    components with a single QtPoint3DFPropertyManager::setValue() call.
+
+    \sa QtAbstractEditorFactory, QtPoint3DFPropertyManager
+*/
+
+/*!
+    Creates a factory with the given \a parent.
+*/
+QtPoint3DFEditorFactory::QtPoint3DFEditorFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtPoint3DFPropertyManager>(parent), d_ptr(new QtPoint3DFEditorFactoryPrivate())
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this factory, and all the widgets it has created.
+*/
+QtPoint3DFEditorFactory::~QtPoint3DFEditorFactory()
+{
+    qDeleteAll(d_ptr->m_editorToProperty.keys());
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtPoint3DFEditorFactory::connectPropertyManager(QtPoint3DFPropertyManager *manager)
+{
+    connect(manager, SIGNAL(valueChanged(QtProperty*,QPoint3DF)),
+                this, SLOT(slotPropertyChanged(QtProperty*,QPoint3DF)));
+    connect(manager, SIGNAL(valuesChanged(QList<QtProperty*>)),
+                this, SLOT(slotPropertiesChanged(QList<QtProperty*>)));
+    connect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+QWidget *QtPoint3DFEditorFactory::createEditor(QtPoint3DFPropertyManager *manager,
+        QtProperty *property, QWidget *parent)
+{
+    QtVector3DEditWidget *editor = d_ptr->createEditor(property, parent);
+    editor->setDecimals(manager->decimals(property));
+    editor->setRange(-std::numeric_limits<double>::max(), std::numeric_limits<double>::max());
+    const QPoint3DF value = manager->value(property);
+    editor->setValue(value.x(), value.y(), value.z());
+
+    connect(editor, SIGNAL(valueChanged(double,double,double)),
+                this, SLOT(slotSetValue(double,double,double)));
+    connect(editor, SIGNAL(destroyed(QObject*)),
+                this, SLOT(slotEditorDestroyed(QObject*)));
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtPoint3DFEditorFactory::disconnectPropertyManager(QtPoint3DFPropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,QPoint3DF)),
+                this, SLOT(slotPropertyChanged(QtProperty*,QPoint3DF)));
+    disconnect(manager, SIGNAL(valuesChanged(QList<QtProperty*>)),
+                this, SLOT(slotPropertiesChanged(QList<QtProperty*>)));
+    disconnect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
+}
+
+// QtRotation3DEditorFactory
+void QtRotation3DEditorFactoryPrivate::slotPropertyChanged(QtProperty *property, const QRotation3D &value)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (QtVector3DEditWidget *editor : it.value())
+        editor->setValue(value.x(), value.y(), value.z());
+}
+
+void QtRotation3DEditorFactoryPrivate::slotSetValue(double x, double y, double z)
+{
+    QtProperty *property = m_editorToProperty.value(qobject_cast<QtVector3DEditWidget *>(q_ptr->sender()), 0);
+    if (!property)
+        return;
+    if (QtRotation3DPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, QRotation3D(qRound(x), qRound(y), qRound(z)));
+}
+
+/*!
+    \class QtRotation3DEditorFactory
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtRotation3DEditorFactory class provides editors for
+    properties created by QtRotation3DPropertyManager objects.
+
+    The editor shows the three angles in degrees and commits them
+    together.
+
+    \sa QtAbstractEditorFactory, QtRotation3DPropertyManager
+*/
+
+/*!
+    Creates a factory with the given \a parent.
+*/
+QtRotation3DEditorFactory::QtRotation3DEditorFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtRotation3DPropertyManager>(parent), d_ptr(new QtRotation3DEditorFactoryPrivate())
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this factory, and all the widgets it has created.
+*/
+QtRotation3DEditorFactory::~QtRotation3DEditorFactory()
+{
+    qDeleteAll(d_ptr->m_editorToProperty.keys());
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtRotation3DEditorFactory::connectPropertyManager(QtRotation3DPropertyManager *manager)
+{
+    connect(manager, SIGNAL(valueChanged(QtProperty*,QRotation3D)),
+                this, SLOT(slotPropertyChanged(QtProperty*,QRotation3D)));
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+QWidget *QtRotation3DEditorFactory::createEditor(QtRotation3DPropertyManager *manager,
+        QtProperty *property, QWidget *parent)
+{
+    QtVector3DEditWidget *editor = d_ptr->createEditor(property, parent);
+    editor->setDecimals(0);
+    editor->setRange(INT_MIN, INT_MAX);
+    editor->setSuffix(QString(QChar(0x00B0)));
+    const QRotation3D value = manager->value(property);
+    editor->setValue(value.x(), value.y(), value.z());
+
+    connect(editor, SIGNAL(valueChanged(double,double,double)),
+                this, SLOT(slotSetValue(double,double,double)));
+    connect(editor, SIGNAL(destroyed(QObject*)),
+                this, SLOT(slotEditorDestroyed(QObject*)));
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtRotation3DEditorFactory::disconnectPropertyManager(QtRotation3DPropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,QRotation3D)),
+                this, SLOT(slotPropertyChanged(QtProperty*,QRotation3D)));
+}
+
+// QtIntRangeEditorFactory
+void QtIntRangeEditorFactoryPrivate::slotPropertyChanged(QtProperty *property, int minValue, int maxValue)
 {
-    disconnect(manager, SIGNAL(valueChanged(QtProperty*,int)),
-                this, SLOT(slotPropertyChanged(QtProperty*,int)));
-    disconnect(manager, SIGNAL(rangeChanged(QtProperty*,int,int)),
-                this, SLOT(slotRangeChanged(QtProperty*,int,int)));
-    disconnect(manager, SIGNAL(singleStepChanged(QtProperty*,int)),
-                this, SLOT(slotSingleStepChanged(QtProperty*,int)));
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (RangeSlider *editor : it.value()) {
+        if (editor->minimumValue() != minValue || editor->maximumValue() != maxValue) {
+            editor->blockSignals(true);
+            editor->setValues(minValue, maxValue);
+            editor->blockSignals(false);
+        }
+    }
 }
 
-// QtCheckBoxFactory
-void QtCheckBoxFactoryPrivate::slotPropertyChanged(QtProperty *property, bool value)
+void QtIntRangeEditorFactoryPrivate::slotRangeChanged(QtProperty *property, int min, int max)
 {
     const auto it = m_createdEditors.constFind(property);
     if (it == m_createdEditors.cend())
         return;
 
-    for (QtBoolEdit *editor : it.value()) {
-        editor->blockCheckBoxSignals(true);
-        editor->setChecked(value);
-        editor->blockCheckBoxSignals(false);
+    QtIntRangePropertyManager *manager = q_ptr->propertyManager(property);
+    if (!manager)
+        return;
+
+    for (RangeSlider *editor : it.value()) {
+        editor->blockSignals(true);
+        editor->setRange(min, max);
+        editor->setValues(manager->minimumValue(property), manager->maximumValue(property));
+        editor->blockSignals(false);
     }
 }
 
-void QtCheckBoxFactoryPrivate::slotSetValue(bool value)
+void QtIntRangeEditorFactoryPrivate::slotSingleStepChanged(QtProperty *property, int step)
 {
-    QObject *object = q_ptr->sender();
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.cend())
+        return;
+    for (RangeSlider *editor : it.value()) {
+        editor->blockSignals(true);
+        editor->setSingleStep(step);
+        editor->blockSignals(false);
+    }
+}
 
-    const QMap<QtBoolEdit *, QtProperty *>::ConstIterator ecend = m_editorToProperty.constEnd();
-    for (QMap<QtBoolEdit *, QtProperty *>::ConstIterator itEditor = m_editorToProperty.constBegin(); itEditor != ecend;  ++itEditor)
-        if (itEditor.key() == object) {
-            QtProperty *property = itEditor.value();
-            QtBoolPropertyManager *manager = q_ptr->propertyManager(property);
-            if (!manager)
-                return;
-            manager->setValue(property, value);
-            return;
-        }
+void QtIntRangeEditorFactoryPrivate::slotSetValues(int minValue, int maxValue)
+{
+    QtProperty *property = m_editorToProperty.value(qobject_cast<RangeSlider *>(q_ptr->sender()), 0);
+    if (!property)
+        return;
+    if (QtIntRangePropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValues(property, minValue, maxValue);
 }
 
 /*!
-    \class QtCheckBoxFactory
+    \class QtIntRangeEditorFactory
     \internal
     \inmodule QtDesigner
-    \since 4.4
 
-    \brief The QtCheckBoxFactory class provides QCheckBox widgets for
-    properties created by QtBoolPropertyManager objects.
+    \brief The QtIntRangeEditorFactory class provides RangeSlider
+    widgets for properties created by QtIntRangePropertyManager objects.
 
-    \sa QtAbstractEditorFactory, QtBoolPropertyManager
+    \sa QtAbstractEditorFactory, QtIntRangePropertyManager
 */
 
 /*!
     Creates a factory with the given \a parent.
 */
-QtCheckBoxFactory::QtCheckBoxFactory(QObject *parent)
-    : QtAbstractEditorFactory<QtBoolPropertyManager>(parent), d_ptr(new QtCheckBoxFactoryPrivate())
+QtIntRangeEditorFactory::QtIntRangeEditorFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtIntRangePropertyManager>(parent), d_ptr(new QtIntRangeEditorFactoryPrivate())
 {
     d_ptr->q_ptr = this;
-
 }
 
 /*!
     Destroys this factory, and all the widgets it has created.
 */
-QtCheckBoxFactory::~QtCheckBoxFactory()
+QtIntRangeEditorFactory::~QtIntRangeEditorFactory()
 {
     qDeleteAll(d_ptr->m_editorToProperty.keys());
 }
@@ -530,10 +1736,14 @@ QtCheckBoxFactory::~QtCheckBoxFactory()
 
     Reimplemented from the QtAbstractEditorFactory class.
 */
-void QtCheckBoxFactory::connectPropertyManager(QtBoolPropertyManager *manager)
+void QtIntRangeEditorFactory::connectPropertyManager(QtIntRangePropertyManager *manager)
 {
-    connect(manager, SIGNAL(valueChanged(QtProperty*,bool)),
-                this, SLOT(slotPropertyChanged(QtProperty*,bool)));
+    connect(manager, SIGNAL(valueChanged(QtProperty*,int,int)),
+                this, SLOT(slotPropertyChanged(QtProperty*,int,int)));
+    connect(manager, SIGNAL(rangeChanged(QtProperty*,int,int)),
+                this, SLOT(slotRangeChanged(QtProperty*,int,int)));
+    connect(manager, SIGNAL(singleStepChanged(QtProperty*,int)),
+                this, SLOT(slotSingleStepChanged(QtProperty*,int)));
 }
 
 /*!
@@ -541,13 +1751,16 @@ void QtCheckBoxFactory::connectPropertyManager(QtBoolPropertyManager *manager)
 
     Reimplemented from the QtAbstractEditorFactory class.
 */
-QWidget *QtCheckBoxFactory::createEditor(QtBoolPropertyManager *manager, QtProperty *property,
+QWidget *QtIntRangeEditorFactory::createEditor(QtIntRangePropertyManager *manager, QtProperty *property,
         QWidget *parent)
 {
-    QtBoolEdit *editor = d_ptr->createEditor(property, parent);
-    editor->setChecked(manager->value(property));
+    RangeSlider *editor = new RangeSlider(Qt::Horizontal, parent);
+    d_ptr->initializeEditor(property, editor);
+    editor->setSingleStep(manager->singleStep(property));
+    editor->setRange(manager->minimum(property), manager->maximum(property));
+    editor->setValues(manager->minimumValue(property), manager->maximumValue(property));
 
-    connect(editor, SIGNAL(toggled(bool)), this, SLOT(slotSetValue(bool)));
+    connect(editor, SIGNAL(valuesChanged(int,int)), this, SLOT(slotSetValues(int,int)));
     connect(editor, SIGNAL(destroyed(QObject*)),
                 this, SLOT(slotEditorDestroyed(QObject*)));
     return editor;
@@ -558,122 +1771,159 @@ QWidget *QtCheckBoxFactory::createEditor(QtBoolPropertyManager *manager, QtPrope
 
     Reimplemented from the QtAbstractEditorFactory class.
 */
-void QtCheckBoxFactory::disconnectPropertyManager(QtBoolPropertyManager *manager)
+bool QtIntRangeEditorFactory::paintEditor(QtIntRangePropertyManager *manager, QtProperty *property,
+        QPainter *painter, const QStyleOptionViewItem &option)
 {
-    disconnect(manager, SIGNAL(valueChanged(QtProperty*,bool)),
-                this, SLOT(slotPropertyChanged(QtProperty*,bool)));
+    paintRangeSlider(painter, option, manager->minimum(property), manager->maximum(property),
+                manager->minimumValue(property), manager->maximumValue(property));
+    return true;
 }
 
-// QtDoubleSpinBoxFactory
-void QtDoubleSpinBoxFactoryPrivate::slotPropertyChanged(QtProperty *property, double value)
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtIntRangeEditorFactory::disconnectPropertyManager(QtIntRangePropertyManager *manager)
 {
-    const auto it = m_createdEditors.constFind(property);
-    if (it == m_createdEditors.cend())
-        return;
-    for (QDoubleSpinBox *editor : it.value()) {
-        if (editor->value() != value) {
-            editor->blockSignals(true);
-            editor->setValue(value);
-            editor->blockSignals(false);
-        }
-    }
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,int,int)),
+                this, SLOT(slotPropertyChanged(QtProperty*,int,int)));
+    disconnect(manager, SIGNAL(rangeChanged(QtProperty*,int,int)),
+                this, SLOT(slotRangeChanged(QtProperty*,int,int)));
+    disconnect(manager, SIGNAL(singleStepChanged(QtProperty*,int)),
+                this, SLOT(slotSingleStepChanged(QtProperty*,int)));
 }
 
-void QtDoubleSpinBoxFactoryPrivate::slotRangeChanged(QtProperty *property,
-            double min, double max)
+// QtDoubleRangeEditorFactory
+int QtDoubleRangeEditorFactoryPrivate::tickCount(const QtDoubleRangePropertyManager *manager,
+            const QtProperty *property)
 {
-    const auto it = m_createdEditors.constFind(property);
-    if (it == m_createdEditors.cend())
-        return;
+    enum { MaximumTickCount = 1000000 };
+    const double span = manager->maximum(property) - manager->minimum(property);
+    const double step = manager->singleStep(property);
+    if (!qIsFinite(span) || step <= 0)
+        return MaximumTickCount;
+    return int(qBound(1.0, std::ceil(span / step), double(MaximumTickCount)));
+}
 
-    QtDoublePropertyManager *manager = q_ptr->propertyManager(property);
-    if (!manager)
-        return;
+int QtDoubleRangeEditorFactoryPrivate::valueToTick(const QtDoubleRangePropertyManager *manager,
+            const QtProperty *property, double value)
+{
+    const double minimum = manager->minimum(property);
+    const double span = manager->maximum(property) - minimum;
+    if (span <= 0 || !qIsFinite(span))
+        return 0;
+    return qRound((value - minimum) / span * tickCount(manager, property));
+}
 
-    for (QDoubleSpinBox *editor : it.value()) {
-        editor->blockSignals(true);
-        editor->setRange(min, max);
-        editor->setValue(manager->value(property));
-        editor->blockSignals(false);
-    }
+double QtDoubleRangeEditorFactoryPrivate::tickToValue(const QtDoubleRangePropertyManager *manager,
+            const QtProperty *property, int tick)
+{
+    const double minimum = manager->minimum(property);
+    const double maximum = manager->maximum(property);
+    const int ticks = tickCount(manager, property);
+    if (tick >= ticks)
+        return maximum;
+    return minimum + (maximum - minimum) * tick / ticks;
 }
 
-void QtDoubleSpinBoxFactoryPrivate::slotSingleStepChanged(QtProperty *property, double step)
+void QtDoubleRangeEditorFactoryPrivate::updateEditor(RangeSlider *editor,
+            const QtDoubleRangePropertyManager *manager, const QtProperty *property)
+{
+    editor->blockSignals(true);
+    editor->setRange(0, tickCount(manager, property));
+    editor->setValues(valueToTick(manager, property, manager->minimumValue(property)),
+                valueToTick(manager, property, manager->maximumValue(property)));
+    editor->blockSignals(false);
+}
+
+void QtDoubleRangeEditorFactoryPrivate::slotPropertyChanged(QtProperty *property, double minValue, double maxValue)
 {
     const auto it = m_createdEditors.constFind(property);
     if (it == m_createdEditors.cend())
         return;
 
-    QtDoublePropertyManager *manager = q_ptr->propertyManager(property);
+    QtDoubleRangePropertyManager *manager = q_ptr->propertyManager(property);
     if (!manager)
         return;
 
-    for (QDoubleSpinBox *editor : it.value()) {
-        editor->blockSignals(true);
-        editor->setSingleStep(step);
-        editor->blockSignals(false);
+    const int minTick = valueToTick(manager, property, minValue);
+    const int maxTick = valueToTick(manager, property, maxValue);
+    for (RangeSlider *editor : it.value()) {
+        if (editor->minimumValue() != minTick || editor->maximumValue() != maxTick) {
+            editor->blockSignals(true);
+            editor->setValues(minTick, maxTick);
+            editor->blockSignals(false);
+        }
     }
 }
 
-void QtDoubleSpinBoxFactoryPrivate::slotDecimalsChanged(QtProperty *property, int prec)
+void QtDoubleRangeEditorFactoryPrivate::slotRangeChanged(QtProperty *property, double, double)
 {
     const auto it = m_createdEditors.constFind(property);
-    if (it == m_createdEditors.constEnd())
+    if (it == m_createdEditors.cend())
         return;
 
-    QtDoublePropertyManager *manager = q_ptr->propertyManager(property);
+    QtDoubleRangePropertyManager *manager = q_ptr->propertyManager(property);
     if (!manager)
         return;
 
-    for (QDoubleSpinBox *editor : it.value()) {
-        editor->blockSignals(true);
-        editor->setDecimals(prec);
-        editor->setValue(manager->value(property));
-        editor->blockSignals(false);
-    }
+    for (RangeSlider *editor : it.value())
+        updateEditor(editor, manager, property);
 }
 
-void QtDoubleSpinBoxFactoryPrivate::slotSetValue(double value)
+void QtDoubleRangeEditorFactoryPrivate::slotSingleStepChanged(QtProperty *property, double)
 {
-    QObject *object = q_ptr->sender();
-    const QMap<QDoubleSpinBox *, QtProperty *>::ConstIterator itcend = m_editorToProperty.constEnd();
-    for (QMap<QDoubleSpinBox *, QtProperty *>::ConstIterator itEditor = m_editorToProperty.constBegin(); itEditor != itcend; ++itEditor) {
-        if (itEditor.key() == object) {
-            QtProperty *property = itEditor.value();
-            QtDoublePropertyManager *manager = q_ptr->propertyManager(property);
-            if (!manager)
-                return;
-            manager->setValue(property, value);
-            return;
-        }
+    // The step defines the tick count, so it rescales the editors like a range change.
+    slotRangeChanged(property, 0, 0);
+}
+
+void QtDoubleRangeEditorFactoryPrivate::slotSetValues(int minValue, int maxValue)
+{
+    QtProperty *property = m_editorToProperty.value(qobject_cast<RangeSlider *>(q_ptr->sender()), 0);
+    if (!property)
+        return;
+    if (QtDoubleRangePropertyManager *manager = q_ptr->propertyManager(property)) {
+        // Only the handle that moved to another tick takes the tick's value,
+        // the other bound keeps its exact value instead of snapping to its tick.
+        const double minimumValue = manager->minimumValue(property);
+        const double maximumValue = manager->maximumValue(property);
+        manager->setValues(property,
+                    minValue == valueToTick(manager, property, minimumValue)
+                        ? minimumValue : tickToValue(manager, property, minValue),
+                    maxValue == valueToTick(manager, property, maximumValue)
+                        ? maximumValue : tickToValue(manager, property, maxValue));
     }
 }
 
-/*! \class QtDoubleSpinBoxFactory
+/*!
+    \class QtDoubleRangeEditorFactory
     \internal
     \inmodule QtDesigner
-    \since 4.4
 
-    \brief The QtDoubleSpinBoxFactory class provides QDoubleSpinBox
-    widgets for properties created by QtDoublePropertyManager objects.
+    \brief The QtDoubleRangeEditorFactory class provides RangeSlider
+    widgets for properties created by QtDoubleRangePropertyManager objects.
 
-    \sa QtAbstractEditorFactory, QtDoublePropertyManager
+    The slider moves in single steps of the property, but uses at most
+    one million positions over the property's range. The property
+    should therefore have a finite range.
+
+    \sa QtAbstractEditorFactory, QtDoubleRangePropertyManager
 */
 
 /*!
     Creates a factory with the given \a parent.
 */
-QtDoubleSpinBoxFactory::QtDoubleSpinBoxFactory(QObject *parent)
-    : QtAbstractEditorFactory<QtDoublePropertyManager>(parent), d_ptr(new QtDoubleSpinBoxFactoryPrivate())
+QtDoubleRangeEditorFactory::QtDoubleRangeEditorFactory(QObject *parent)
+    : QtAbstractEditorFactory<QtDoubleRangePropertyManager>(parent), d_ptr(new QtDoubleRangeEditorFactoryPrivate())
 {
     d_ptr->q_ptr = this;
-
 }
 
 /*!
     Destroys this factory, and all the widgets it has created.
 */
-QtDoubleSpinBoxFactory::~QtDoubleSpinBoxFactory()
+QtDoubleRangeEditorFactory::~QtDoubleRangeEditorFactory()
 {
     qDeleteAll(d_ptr->m_editorToProperty.keys());
 }
@@ -683,16 +1933,14 @@ QtDoubleSpinBoxFactory::~QtDoubleSpinBoxFactory()
 
     Reimplemented from the QtAbstractEditorFactory class.
 */
-void QtDoubleSpinBoxFactory::connectPropertyManager(QtDoublePropertyManager *manager)
+void QtDoubleRangeEditorFactory::connectPropertyManager(QtDoubleRangePropertyManager *manager)
 {
-    connect(manager, SIGNAL(valueChanged(QtProperty*,double)),
-                this, SLOT(slotPropertyChanged(QtProperty*,double)));
+    connect(manager, SIGNAL(valueChanged(QtProperty*,double,double)),
+                this, SLOT(slotPropertyChanged(QtProperty*,double,double)));
     connect(manager, SIGNAL(rangeChanged(QtProperty*,double,double)),
                 this, SLOT(slotRangeChanged(QtProperty*,double,double)));
     connect(manager, SIGNAL(singleStepChanged(QtProperty*,double)),
                 this, SLOT(slotSingleStepChanged(QtProperty*,double)));
-    connect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
-                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
 }
 
 /*!
@@ -700,18 +1948,14 @@ void QtDoubleSpinBoxFactory::connectPropertyManager(QtDoublePropertyManager *man
 
     Reimplemented from the QtAbstractEditorFactory class.
 */
-QWidget *QtDoubleSpinBoxFactory::createEditor(QtDoublePropertyManager *manager,
-        QtProperty *property, QWidget *parent)
+QWidget *QtDoubleRangeEditorFactory::createEditor(QtDoubleRangePropertyManager *manager, QtProperty *property,
+        QWidget *parent)
 {
-    QDoubleSpinBox *editor = d_ptr->createEditor(property, parent);
-    editor->setStepType(QAbstractSpinBox::AdaptiveDecimalStepType);
-    editor->setSingleStep(manager->singleStep(property));
-    editor->setDecimals(manager->decimals(property));
-    editor->setRange(manager->minimum(property), manager->maximum(property));
-    editor->setValue(manager->value(property));
-    editor->setKeyboardTracking(false);
+    RangeSlider *editor = new RangeSlider(Qt::Horizontal, parent);
+    d_ptr->initializeEditor(property, editor);
+    d_ptr->updateEditor(editor, manager, property);
 
-    connect(editor, SIGNAL(valueChanged(double)), this, SLOT(slotSetValue(double)));
+    connect(editor, SIGNAL(valuesChanged(int,int)), this, SLOT(slotSetValues(int,int)));
     connect(editor, SIGNAL(destroyed(QObject*)),
                 this, SLOT(slotEditorDestroyed(QObject*)));
     return editor;
@@ -722,19 +1966,78 @@ QWidget *QtDoubleSpinBoxFactory::createEditor(QtDoublePropertyManager *manager,
 
     Reimplemented from the QtAbstractEditorFactory class.
 */
-void QtDoubleSpinBoxFactory::disconnectPropertyManager(QtDoublePropertyManager *manager)
+bool QtDoubleRangeEditorFactory::paintEditor(QtDoubleRangePropertyManager *manager, QtProperty *property,
+        QPainter *painter, const QStyleOptionViewItem &option)
 {
-    disconnect(manager, SIGNAL(valueChanged(QtProperty*,double)),
-                this, SLOT(slotPropertyChanged(QtProperty*,double)));
+    paintRangeSlider(painter, option, 0, d_ptr->tickCount(manager, property),
+                d_ptr->valueToTick(manager, property, manager->minimumValue(property)),
+                d_ptr->valueToTick(manager, property, manager->maximumValue(property)));
+    return true;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+void QtDoubleRangeEditorFactory::disconnectPropertyManager(QtDoubleRangePropertyManager *manager)
+{
+    disconnect(manager, SIGNAL(valueChanged(QtProperty*,double,double)),
+                this, SLOT(slotPropertyChanged(QtProperty*,double,double)));
     disconnect(manager, SIGNAL(rangeChanged(QtProperty*,double,double)),
                 this, SLOT(slotRangeChanged(QtProperty*,double,double)));
     disconnect(manager, SIGNAL(singleStepChanged(QtProperty*,double)),
                 this, SLOT(slotSingleStepChanged(QtProperty*,double)));
-    disconnect(manager, SIGNAL(decimalsChanged(QtProperty*,int)),
-                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
 }
 
 // QtLineEditFactory
+
+// Leaves values the manager checks on a worker thread to the manager, so
+// that pasting a long text does not block the editor.
+class QtStringValidator : public QRegularExpressionValidator
+{
+public:
+    QtStringValidator(const QRegularExpression &regExp, int asyncThreshold, QObject *parent)
+        : QRegularExpressionValidator(regExp, parent), m_asyncThreshold(asyncThreshold) {}
+
+    State validate(QString &input, int &pos) const override
+    {
+        if (m_asyncThreshold > 0 && input.size() >= m_asyncThreshold)
+            return Acceptable;
+        return QRegularExpressionValidator::validate(input, pos);
+    }
+
+private:
+    const int m_asyncThreshold;
+};
+
+static QValidator *createStringValidator(const QtStringPropertyManager *manager,
+            const QRegularExpression &regExp, QObject *parent)
+{
+    if (!regExp.isValid() || regExp.pattern().isEmpty())
+        return 0;
+    return new QtStringValidator(regExp, manager->asyncValidationThreshold(), parent);
+}
+
+static const char validationPendingActionName[] = "_q_validationPending";
+
+void QtLineEditFactoryPrivate::setValidationPending(QLineEdit *editor, bool pending)
+{
+    QAction *action = editor->findChild<QAction *>(QLatin1String(validationPendingActionName),
+                Qt::FindDirectChildrenOnly);
+    if (pending == (action != 0))
+        return;
+
+    if (pending) {
+        action = editor->addAction(editor->style()->standardIcon(QStyle::SP_BrowserReload),
+                    QLineEdit::TrailingPosition);
+        action->setObjectName(QLatin1String(validationPendingActionName));
+        action->setToolTip(QCoreApplication::translate("QtLineEditFactory", "Validating..."));
+    } else {
+        delete action;
+    }
+}
+
 void QtLineEditFactoryPrivate::slotPropertyChanged(QtProperty *property,
                 const QString &value)
 {
@@ -742,6 +2045,8 @@ void QtLineEditFactoryPrivate::slotPropertyChanged(QtProperty *property,
     if (it == m_createdEditors.constEnd())
         return;
 
+    discardPendingCommits(property);
+
     for (QLineEdit *editor : it.value()) {
         if (editor->text() != value)
             editor->setText(value);
@@ -762,10 +2067,7 @@ void QtLineEditFactoryPrivate::slotRegExpChanged(QtProperty *property,
     for (QLineEdit *editor : it.value()) {
         editor->blockSignals(true);
         const QValidator *oldValidator = editor->validator();
-        QValidator *newValidator = 0;
-        if (regExp.isValid()) {
-            newValidator = new QRegularExpressionValidator(regExp, editor);
-        }
+        QValidator *newValidator = createStringValidator(manager, regExp, editor);
         editor->setValidator(newValidator);
         if (oldValidator)
             delete oldValidator;
@@ -773,19 +2075,47 @@ void QtLineEditFactoryPrivate::slotRegExpChanged(QtProperty *property,
     }
 }
 
-void QtLineEditFactoryPrivate::slotSetValue(const QString &value)
+void QtLineEditFactoryPrivate::slotValidationPendingChanged(QtProperty *property, bool pending)
 {
-    QObject *object = q_ptr->sender();
-    const QMap<QLineEdit *, QtProperty *>::ConstIterator ecend = m_editorToProperty.constEnd();
-    for (QMap<QLineEdit *, QtProperty *>::ConstIterator itEditor = m_editorToProperty.constBegin(); itEditor != ecend; ++itEditor)
-        if (itEditor.key() == object) {
-            QtProperty *property = itEditor.value();
-            QtStringPropertyManager *manager = q_ptr->propertyManager(property);
-            if (!manager)
-                return;
-            manager->setValue(property, value);
-            return;
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.constEnd())
+        return;
+
+    // The validator accepted the long text unchecked; once the manager has
+    // decided, show the value it kept, which differs if the text was rejected.
+    QtStringPropertyManager *manager = pending ? 0 : q_ptr->propertyManager(property);
+    for (QLineEdit *editor : it.value()) {
+        setValidationPending(editor, pending);
+        if (manager) {
+            const QString value = manager->value(property);
+            if (editor->text() != value) {
+                editor->blockSignals(true);
+                editor->setText(value);
+                editor->blockSignals(false);
+            }
         }
+    }
+}
+
+void QtLineEditFactoryPrivate::slotSetValue(const QString &value)
+{
+    editorValueChanged(q_ptr, qobject_cast<QLineEdit *>(q_ptr->sender()), value);
+}
+
+void QtLineEditFactoryPrivate::slotEditingFinished()
+{
+    editorEditingFinished(qobject_cast<QLineEdit *>(q_ptr->sender()));
+}
+
+void QtLineEditFactoryPrivate::slotCommitTimeout()
+{
+    commitTimeout(q_ptr->sender());
+}
+
+void QtLineEditFactoryPrivate::commitValue(QtProperty *property, const QString &value)
+{
+    if (QtStringPropertyManager *manager = q_ptr->propertyManager(property))
+        manager->setValue(property, value);
 }
 
 /*!
@@ -797,6 +2127,9 @@ void QtLineEditFactoryPrivate::slotSetValue(const QString &value)
     \brief The QtLineEditFactory class provides QLineEdit widgets for
     properties created by QtStringPropertyManager objects.
 
+    While the manager checks a value in the background, the editor
+    shows an indicator instead of blocking.
+
     \sa QtAbstractEditorFactory, QtStringPropertyManager
 */
 
@@ -829,6 +2162,8 @@ void QtLineEditFactory::connectPropertyManager(QtStringPropertyManager *manager)
                 this, SLOT(slotPropertyChanged(QtProperty*,QString)));
     connect(manager, SIGNAL(regExpChanged(QtProperty*,QRegularExpression)),
                 this, SLOT(slotRegExpChanged(QtProperty*,QRegularExpression)));
+    connect(manager, SIGNAL(validationPendingChanged(QtProperty*,bool)),
+                this, SLOT(slotValidationPendingChanged(QtProperty*,bool)));
 }
 
 /*!
@@ -841,15 +2176,14 @@ QWidget *QtLineEditFactory::createEditor(QtStringPropertyManager *manager,
 {
 
     QLineEdit *editor = d_ptr->createEditor(property, parent);
-    QRegularExpression regExp = manager->regExp(property);
-    if (regExp.isValid() && !regExp.pattern().isEmpty()) {
-        QValidator *validator = new QRegularExpressionValidator(regExp, editor);
+    if (QValidator *validator = createStringValidator(manager, manager->regExp(property), editor))
         editor->setValidator(validator);
-    }
     editor->setText(manager->value(property));
+    QtLineEditFactoryPrivate::setValidationPending(editor, manager->isValidationPending(property));
 
     connect(editor, SIGNAL(textEdited(QString)),
                 this, SLOT(slotSetValue(QString)));
+    connect(editor, SIGNAL(editingFinished()), this, SLOT(slotEditingFinished()));
     connect(editor, SIGNAL(destroyed(QObject*)),
                 this, SLOT(slotEditorDestroyed(QObject*)));
     return editor;
@@ -866,6 +2200,8 @@ void QtLineEditFactory::disconnectPropertyManager(QtStringPropertyManager *manag
                 this, SLOT(slotPropertyChanged(QtProperty*,QString)));
     disconnect(manager, SIGNAL(regExpChanged(QtProperty*,QRegularExpression)),
                 this, SLOT(slotRegExpChanged(QtProperty*,QRegularExpression)));
+    disconnect(manager, SIGNAL(validationPendingChanged(QtProperty*,bool)),
+                this, SLOT(slotValidationPendingChanged(QtProperty*,bool)));
 }
 
 // QtDateEditFactory
@@ -1673,6 +3009,27 @@ QWidget *QtEnumEditorFactory::createEditor(QtEnumPropertyManager *manager, QtPro
     return editor;
 }
 
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+bool QtEnumEditorFactory::paintEditor(QtEnumPropertyManager *manager, QtProperty *property,
+        QPainter *painter, const QStyleOptionViewItem &option)
+{
+    QStyleOptionComboBox opt;
+    QStyle *style = initPaintedEditorOption(&opt, option);
+    const int value = manager->value(property);
+    opt.currentText = manager->enumNames(property).value(value);
+    opt.currentIcon = manager->enumIcons(property).value(value);
+    opt.iconSize = QSize(opt.fontMetrics.height(), opt.fontMetrics.height());
+    opt.subControls = QStyle::SC_All;
+    opt.activeSubControls = QStyle::SC_None;
+    style->drawComplexControl(QStyle::CC_ComboBox, &opt, painter, option.widget);
+    style->drawControl(QStyle::CE_ComboBoxLabel, &opt, painter, option.widget);
+    return true;
+}
+
 /*!
     \internal
 
@@ -1687,7 +3044,6 @@ void QtEnumEditorFactory::disconnectPropertyManager(QtEnumPropertyManager *manag
 }
 
 // QtCursorEditorFactory
-Q_GLOBAL_STATIC(QtCursorDatabase, cursorDatabase)
 
 QtCursorEditorFactoryPrivate::QtCursorEditorFactoryPrivate()
     : m_updatingEnum(false)
@@ -1703,7 +3059,7 @@ void QtCursorEditorFactoryPrivate::slotPropertyChanged(QtProperty *property, con
         return;
 
     m_updatingEnum = true;
-    m_enumPropertyManager->setValue(enumProp, cursorDatabase()->cursorToValue(cursor));
+    m_enumPropertyManager->setValue(enumProp, QtCursorDatabase::instance()->cursorToValue(cursor));
     m_updatingEnum = false;
 }
 
@@ -1719,7 +3075,7 @@ void QtCursorEditorFactoryPrivate::slotEnumChanged(QtProperty *property, int val
     if (!cursorManager)
         return;
 #ifndef QT_NO_CURSOR
-    cursorManager->setValue(prop, QCursor(cursorDatabase()->valueToCursor(value)));
+    cursorManager->setValue(prop, QCursor(QtCursorDatabase::instance()->valueToCursor(value)));
 #endif
 }
 
@@ -1804,10 +3160,10 @@ QWidget *QtCursorEditorFactory::createEditor(QtCursorPropertyManager *manager, Q
         enumProp = d_ptr->m_propertyToEnum[property];
     } else {
         enumProp = d_ptr->m_enumPropertyManager->addProperty(property->propertyName());
-        d_ptr->m_enumPropertyManager->setEnumNames(enumProp, cursorDatabase()->cursorShapeNames());
-        d_ptr->m_enumPropertyManager->setEnumIcons(enumProp, cursorDatabase()->cursorShapeIcons());
+        d_ptr->m_enumPropertyManager->setEnumNames(enumProp, QtCursorDatabase::instance()->cursorShapeNames());
+        d_ptr->m_enumPropertyManager->setEnumIcons(enumProp, QtCursorDatabase::instance()->cursorShapeIcons());
 #ifndef QT_NO_CURSOR
-        d_ptr->m_enumPropertyManager->setValue(enumProp, cursorDatabase()->cursorToValue(manager->value(property)));
+        d_ptr->m_enumPropertyManager->setValue(enumProp, QtCursorDatabase::instance()->cursorToValue(manager->value(property)));
 #endif
         d_ptr->m_propertyToEnum[property] = enumProp;
         d_ptr->m_enumToProperty[enumProp] = property;
@@ -1982,6 +3338,38 @@ QWidget *QtColorEditorFactory::createEditor(QtColorPropertyManager *manager,
     return editor;
 }
 
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+bool QtColorEditorFactory::paintEditor(QtColorPropertyManager *manager, QtProperty *property,
+        QPainter *painter, const QStyleOptionViewItem &option)
+{
+    QStyleOption opt;
+    initPaintedEditorOption(&opt, option);
+    const QPixmap swatch = QtPropertyBrowserUtils::brushValuePixmap(QBrush(manager->value(property)));
+    const QSize swatchSize = swatch.deviceIndependentSize().toSize();
+    QRect swatchRect(opt.rect.topLeft(), swatchSize);
+    swatchRect.moveTop(opt.rect.top() + (opt.rect.height() - swatchSize.height()) / 2);
+    QRect textRect = opt.rect.adjusted(swatchSize.width() + 4, 0, 0, 0);
+    if (opt.direction == Qt::RightToLeft) {
+        swatchRect.moveRight(opt.rect.right());
+        textRect = opt.rect.adjusted(0, 0, -swatchSize.width() - 4, 0);
+    }
+    painter->drawPixmap(swatchRect, swatch);
+
+    const QPalette::ColorRole role = (option.state & QStyle::State_Selected)
+                ? QPalette::HighlightedText : QPalette::Text;
+    const QString text = opt.fontMetrics.elidedText(property->valueText(), Qt::ElideRight, textRect.width());
+    painter->save();
+    painter->setPen(opt.palette.color(role));
+    painter->setFont(option.font);
+    painter->drawText(textRect, Qt::AlignVCenter | Qt::AlignLeading, text);
+    painter->restore();
+    return true;
+}
+
 /*!
     \internal
 
@@ -41,6 +41,7 @@
 
 #include "qtpropertymanager.h"
 #include "qtpropertybrowserutils_p.h"
+#include "rangeslider.h"
 #include <QtWidgets/QSpinBox>
 #include <QtWidgets/QScrollBar>
 #include <QtWidgets/QComboBox>
@@ -52,6 +53,8 @@
 #include <QtGui/QKeyEvent>
 #include <QtGui/QRegularExpressionValidator>
 #include <QtWidgets/QApplication>
+#include <QtWidgets/QStyleOption>
+#include <QtGui/QPainter>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QToolButton>
 #include <QtWidgets/QColorDialog>
@@ -59,6 +62,7 @@
 #include <QtWidgets/QSpacerItem>
 #include <QtWidgets/QKeySequenceEdit>
 #include <QtCore/QMap>
+#include <QtCore/QTimer>
 #include <QtCore/QRegularExpression>
 #include <QtWidgets/QKeySequenceEdit>
 
@@ -142,6 +146,58 @@ private:
     QToolButton* m_button;
 };
 
+// QtArrayEditWidget
+// Edits one element of an array at a time; the index spin box pages
+// through the elements so that the widget stays cheap for large arrays.
+class QtArrayEditWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    QtArrayEditWidget(QWidget* parent);
+
+    int currentIndex() const;
+    void setCount(int count);
+    void setRange(double minVal, double maxVal);
+    void setDecimals(int prec);
+    void setCurrentValue(double value);
+
+Q_SIGNALS:
+    void currentIndexChanged(int index);
+    void valueChanged(int index, double value);
+
+private Q_SLOTS:
+    void slotIndexChanged(int index);
+    void slotValueChanged(double value);
+
+private:
+    QSpinBox* m_indexSpinBox;
+    QDoubleSpinBox* m_valueSpinBox;
+};
+
+// QtVector3DEditWidget
+// Edits the three components of a 3D value side by side; any component
+// change is reported with the whole vector so that it is committed at once.
+class QtVector3DEditWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    QtVector3DEditWidget(QWidget* parent);
+
+    void setRange(double minVal, double maxVal);
+    void setDecimals(int prec);
+    void setSuffix(const QString& suffix);
+    void setValue(double x, double y, double z);
+
+Q_SIGNALS:
+    void valueChanged(double x, double y, double z);
+
+private Q_SLOTS:
+    void slotValueChanged();
+
+private:
+    QDoubleSpinBox* m_spinBoxes[3];
+};
+
 // Set a hard coded left margin to account for the indentation
 // of the tree view icon when switching to an editor
 
@@ -212,9 +268,138 @@ void EditorFactoryPrivate<Editor>::slotEditorDestroyed(QObject* object)
     }
 }
 
+// ---------- EditorCommitPolicyPrivate :
+// Base class for the private classes of factories whose editors report
+// intermediate values. Keeps edits local to the editor until the commit
+// policy of the factory says they are due, then hands them to commitValue().
+
+template <class Editor, class Value>
+class EditorCommitPolicyPrivate : public EditorFactoryPrivate<Editor>
+{
+public:
+    virtual ~EditorCommitPolicyPrivate() {}
+
+    // complete: the change is a finished edit on its own, like a keyboard
+    // step on a slider, and needs no separate editingFinished().
+    void editorValueChanged(QtAbstractEditorFactoryBase* factory, Editor* editor,
+                const Value& value, bool complete = false);
+    void editorEditingFinished(Editor* editor);
+    void commitTimeout(QObject* timer);
+    void discardPendingCommits(QtProperty* property);
+    void slotEditorDestroyed(QObject* object);
+
+protected:
+    virtual void commitValue(QtProperty* property, const Value& value) = 0;
+
+private:
+    struct PendingCommit
+    {
+        QTimer* timer{ nullptr };
+        Value value{};
+        bool pending{ false };
+    };
+
+    QMap<Editor*, PendingCommit> m_pendingCommits;
+};
+
+template <class Editor, class Value>
+void EditorCommitPolicyPrivate<Editor, Value>::editorValueChanged(QtAbstractEditorFactoryBase* factory,
+            Editor* editor, const Value& value, bool complete)
+{
+    QtProperty* property = this->m_editorToProperty.value(editor, 0);
+    if (!property)
+        return;
+
+    const QtAbstractEditorFactoryBase::CommitPolicy policy = factory->commitPolicy(property);
+    if (policy == QtAbstractEditorFactoryBase::CommitImmediately
+            || (complete && policy == QtAbstractEditorFactoryBase::CommitOnEditingFinished)) {
+        const typename QMap<Editor*, PendingCommit>::iterator it = m_pendingCommits.find(editor);
+        if (it != m_pendingCommits.end()) {
+            it.value().pending = false;
+            if (it.value().timer)
+                it.value().timer->stop();
+        }
+        commitValue(property, value);
+        return;
+    }
+
+    PendingCommit& pending = m_pendingCommits[editor];
+    pending.value = value;
+    pending.pending = true;
+    if (policy == QtAbstractEditorFactoryBase::CommitDebounced) {
+        if (!pending.timer) {
+            pending.timer = new QTimer(editor);
+            pending.timer->setSingleShot(true);
+            QObject::connect(pending.timer, SIGNAL(timeout()), factory, SLOT(slotCommitTimeout()));
+        }
+        pending.timer->start(factory->commitDelay());
+    }
+}
+
+template <class Editor, class Value>
+void EditorCommitPolicyPrivate<Editor, Value>::editorEditingFinished(Editor* editor)
+{
+    const typename QMap<Editor*, PendingCommit>::iterator it = m_pendingCommits.find(editor);
+    if (it == m_pendingCommits.end() || !it.value().pending)
+        return;
+
+    it.value().pending = false;
+    if (it.value().timer)
+        it.value().timer->stop();
+    const Value value = it.value().value;
+    if (QtProperty* property = this->m_editorToProperty.value(editor, 0))
+        commitValue(property, value);
+}
+
+template <class Editor, class Value>
+void EditorCommitPolicyPrivate<Editor, Value>::commitTimeout(QObject* timer)
+{
+    if (timer)
+        editorEditingFinished(static_cast<Editor*>(timer->parent()));
+}
+
+template <class Editor, class Value>
+void EditorCommitPolicyPrivate<Editor, Value>::discardPendingCommits(QtProperty* property)
+{
+    const typename EditorFactoryPrivate<Editor>::PropertyToEditorListMap::const_iterator it =
+            this->m_createdEditors.constFind(property);
+    if (it == this->m_createdEditors.constEnd())
+        return;
+    for (Editor* editor : it.value()) {
+        const typename QMap<Editor*, PendingCommit>::iterator pit = m_pendingCommits.find(editor);
+        if (pit != m_pendingCommits.end()) {
+            pit.value().pending = false;
+            if (pit.value().timer)
+                pit.value().timer->stop();
+        }
+    }
+}
+
+template <class Editor, class Value>
+void EditorCommitPolicyPrivate<Editor, Value>::slotEditorDestroyed(QObject* object)
+{
+    // A pending edit is committed from the stored value once the editor no
+    // longer receives updates, as the widget itself is already gone.
+    QtProperty* property = 0;
+    Value value{};
+    bool pending = false;
+    for (typename QMap<Editor*, PendingCommit>::iterator it = m_pendingCommits.begin(); it != m_pendingCommits.end(); ++it) {
+        if (it.key() == object) {
+            pending = it.value().pending;
+            value = it.value().value;
+            property = this->m_editorToProperty.value(it.key(), 0);
+            m_pendingCommits.erase(it);
+            break;
+        }
+    }
+    EditorFactoryPrivate<Editor>::slotEditorDestroyed(object);
+    if (pending && property)
+        commitValue(property, value);
+}
+
 
 class QtSpinBoxFactory;
-class QtSpinBoxFactoryPrivate : public EditorFactoryPrivate<QSpinBox>
+class QtSpinBoxFactoryPrivate : public EditorCommitPolicyPrivate<QSpinBox, int>
 {
     QtSpinBoxFactory* q_ptr;
     Q_DECLARE_PUBLIC(QtSpinBoxFactory)
@@ -224,6 +409,11 @@ public:
     void slotRangeChanged(QtProperty* property, int min, int max);
     void slotSingleStepChanged(QtProperty* property, int step);
     void slotSetValue(int value);
+    void slotEditingFinished();
+    void slotCommitTimeout();
+
+protected:
+    void commitValue(QtProperty* property, const int& value) override;
 };
 class QtSpinBoxFactory : public QtAbstractEditorFactory<QtIntPropertyManager>
 {
@@ -244,11 +434,13 @@ private:
     Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, int, int))
     Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, int))
     Q_PRIVATE_SLOT(d_func(), void slotSetValue(int))
+    Q_PRIVATE_SLOT(d_func(), void slotEditingFinished())
+    Q_PRIVATE_SLOT(d_func(), void slotCommitTimeout())
     Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
 };
 
 class QtSliderFactory;
-class QtSliderFactoryPrivate : public EditorFactoryPrivate<QSlider>
+class QtSliderFactoryPrivate : public EditorCommitPolicyPrivate<QSlider, int>
 {
     QtSliderFactory* q_ptr;
     Q_DECLARE_PUBLIC(QtSliderFactory)
@@ -257,6 +449,11 @@ public:
     void slotRangeChanged(QtProperty* property, int min, int max);
     void slotSingleStepChanged(QtProperty* property, int step);
     void slotSetValue(int value);
+    void slotEditingFinished();
+    void slotCommitTimeout();
+
+protected:
+    void commitValue(QtProperty* property, const int& value) override;
 };
 class QtSliderFactory : public QtAbstractEditorFactory<QtIntPropertyManager>
 {
@@ -268,6 +465,8 @@ protected:
     void connectPropertyManager(QtIntPropertyManager *manager) override;
     QWidget *createEditor(QtIntPropertyManager *manager, QtProperty *property,
                 QWidget *parent) override;
+    bool paintEditor(QtIntPropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option) override;
     void disconnectPropertyManager(QtIntPropertyManager *manager) override;
 private:
     QScopedPointer<QtSliderFactoryPrivate> d_ptr;
@@ -277,11 +476,13 @@ private:
     Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, int, int))
     Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, int))
     Q_PRIVATE_SLOT(d_func(), void slotSetValue(int))
+    Q_PRIVATE_SLOT(d_func(), void slotEditingFinished())
+    Q_PRIVATE_SLOT(d_func(), void slotCommitTimeout())
     Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
 };
 
 class QtScrollBarFactory;
-class QtScrollBarFactoryPrivate : public  EditorFactoryPrivate<QScrollBar>
+class QtScrollBarFactoryPrivate : public EditorCommitPolicyPrivate<QScrollBar, int>
 {
     QtScrollBarFactory* q_ptr;
     Q_DECLARE_PUBLIC(QtScrollBarFactory)
@@ -290,6 +491,11 @@ public:
     void slotRangeChanged(QtProperty* property, int min, int max);
     void slotSingleStepChanged(QtProperty* property, int step);
     void slotSetValue(int value);
+    void slotEditingFinished();
+    void slotCommitTimeout();
+
+protected:
+    void commitValue(QtProperty* property, const int& value) override;
 };
 class QtScrollBarFactory : public QtAbstractEditorFactory<QtIntPropertyManager>
 {
@@ -310,6 +516,8 @@ private:
     Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, int, int))
     Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, int))
     Q_PRIVATE_SLOT(d_func(), void slotSetValue(int))
+    Q_PRIVATE_SLOT(d_func(), void slotEditingFinished())
+    Q_PRIVATE_SLOT(d_func(), void slotCommitTimeout())
     Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
 };
 
@@ -332,6 +540,8 @@ protected:
     void connectPropertyManager(QtBoolPropertyManager *manager) override;
     QWidget *createEditor(QtBoolPropertyManager *manager, QtProperty *property,
                 QWidget *parent) override;
+    bool paintEditor(QtBoolPropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option) override;
     void disconnectPropertyManager(QtBoolPropertyManager *manager) override;
 private:
     QScopedPointer<QtCheckBoxFactoryPrivate> d_ptr;
@@ -343,7 +553,7 @@ private:
 };
 
 class QtDoubleSpinBoxFactory;
-class QtDoubleSpinBoxFactoryPrivate : public EditorFactoryPrivate<QDoubleSpinBox>
+class QtDoubleSpinBoxFactoryPrivate : public EditorCommitPolicyPrivate<QDoubleSpinBox, double>
 {
     QtDoubleSpinBoxFactory* q_ptr;
     Q_DECLARE_PUBLIC(QtDoubleSpinBoxFactory)
@@ -354,6 +564,11 @@ public:
     void slotSingleStepChanged(QtProperty* property, double step);
     void slotDecimalsChanged(QtProperty* property, int prec);
     void slotSetValue(double value);
+    void slotEditingFinished();
+    void slotCommitTimeout();
+
+protected:
+    void commitValue(QtProperty* property, const double& value) override;
 };
 class QtDoubleSpinBoxFactory : public QtAbstractEditorFactory<QtDoublePropertyManager>
 {
@@ -375,11 +590,260 @@ private:
     Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, double))
     Q_PRIVATE_SLOT(d_func(), void slotDecimalsChanged(QtProperty *, int))
     Q_PRIVATE_SLOT(d_func(), void slotSetValue(double))
+    Q_PRIVATE_SLOT(d_func(), void slotEditingFinished())
+    Q_PRIVATE_SLOT(d_func(), void slotCommitTimeout())
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
+};
+
+class QtIntArrayEditorFactory;
+class QtIntArrayEditorFactoryPrivate : public EditorFactoryPrivate<QtArrayEditWidget>
+{
+    QtIntArrayEditorFactory* q_ptr;
+    Q_DECLARE_PUBLIC(QtIntArrayEditorFactory)
+public:
+
+    void slotValuesChanged(QtProperty* property, const QList<int>& values);
+    void slotValueChanged(QtProperty* property, int index, int value);
+    void slotRangeChanged(QtProperty* property, int min, int max);
+    void slotCurrentIndexChanged(int index);
+    void slotSetValue(int index, double value);
+};
+class QtIntArrayEditorFactory : public QtAbstractEditorFactory<QtIntArrayPropertyManager>
+{
+    Q_OBJECT
+public:
+    QtIntArrayEditorFactory(QObject *parent = 0);
+    ~QtIntArrayEditorFactory();
+protected:
+    void connectPropertyManager(QtIntArrayPropertyManager *manager) override;
+    QWidget *createEditor(QtIntArrayPropertyManager *manager, QtProperty *property,
+                QWidget *parent) override;
+    void disconnectPropertyManager(QtIntArrayPropertyManager *manager) override;
+private:
+    QScopedPointer<QtIntArrayEditorFactoryPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtIntArrayEditorFactory)
+    Q_DISABLE_COPY_MOVE(QtIntArrayEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotValuesChanged(QtProperty *, const QList<int> &))
+    Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, int, int))
+    Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, int, int))
+    Q_PRIVATE_SLOT(d_func(), void slotCurrentIndexChanged(int))
+    Q_PRIVATE_SLOT(d_func(), void slotSetValue(int, double))
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
+};
+
+class QtDoubleArrayEditorFactory;
+class QtDoubleArrayEditorFactoryPrivate : public EditorFactoryPrivate<QtArrayEditWidget>
+{
+    QtDoubleArrayEditorFactory* q_ptr;
+    Q_DECLARE_PUBLIC(QtDoubleArrayEditorFactory)
+public:
+
+    void slotValuesChanged(QtProperty* property, const QList<double>& values);
+    void slotValueChanged(QtProperty* property, int index, double value);
+    void slotRangeChanged(QtProperty* property, double min, double max);
+    void slotDecimalsChanged(QtProperty* property, int prec);
+    void slotCurrentIndexChanged(int index);
+    void slotSetValue(int index, double value);
+};
+class QtDoubleArrayEditorFactory : public QtAbstractEditorFactory<QtDoubleArrayPropertyManager>
+{
+    Q_OBJECT
+public:
+    QtDoubleArrayEditorFactory(QObject *parent = 0);
+    ~QtDoubleArrayEditorFactory();
+protected:
+    void connectPropertyManager(QtDoubleArrayPropertyManager *manager) override;
+    QWidget *createEditor(QtDoubleArrayPropertyManager *manager, QtProperty *property,
+                QWidget *parent) override;
+    void disconnectPropertyManager(QtDoubleArrayPropertyManager *manager) override;
+private:
+    QScopedPointer<QtDoubleArrayEditorFactoryPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtDoubleArrayEditorFactory)
+    Q_DISABLE_COPY_MOVE(QtDoubleArrayEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotValuesChanged(QtProperty *, const QList<double> &))
+    Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, int, double))
+    Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, double, double))
+    Q_PRIVATE_SLOT(d_func(), void slotDecimalsChanged(QtProperty *, int))
+    Q_PRIVATE_SLOT(d_func(), void slotCurrentIndexChanged(int))
+    Q_PRIVATE_SLOT(d_func(), void slotSetValue(int, double))
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
+};
+
+class QtPoint3DEditorFactory;
+class QtPoint3DEditorFactoryPrivate : public EditorFactoryPrivate<QtVector3DEditWidget>
+{
+    QtPoint3DEditorFactory* q_ptr;
+    Q_DECLARE_PUBLIC(QtPoint3DEditorFactory)
+public:
+
+    void slotPropertyChanged(QtProperty* property, const QPoint3D& value);
+    void slotPropertiesChanged(const QList<QtProperty*>& properties);
+    void slotSetValue(double x, double y, double z);
+};
+class QtPoint3DEditorFactory : public QtAbstractEditorFactory<QtPoint3DPropertyManager>
+{
+    Q_OBJECT
+public:
+    QtPoint3DEditorFactory(QObject *parent = 0);
+    ~QtPoint3DEditorFactory();
+protected:
+    void connectPropertyManager(QtPoint3DPropertyManager *manager) override;
+    QWidget *createEditor(QtPoint3DPropertyManager *manager, QtProperty *property,
+                QWidget *parent) override;
+    void disconnectPropertyManager(QtPoint3DPropertyManager *manager) override;
+private:
+    QScopedPointer<QtPoint3DEditorFactoryPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtPoint3DEditorFactory)
+    Q_DISABLE_COPY_MOVE(QtPoint3DEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *, const QPoint3D &))
+    Q_PRIVATE_SLOT(d_func(), void slotPropertiesChanged(const QList<QtProperty *> &))
+    Q_PRIVATE_SLOT(d_func(), void slotSetValue(double, double, double))
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
+};
+
+class QtPoint3DFEditorFactory;
+class QtPoint3DFEditorFactoryPrivate : public EditorFactoryPrivate<QtVector3DEditWidget>
+{
+    QtPoint3DFEditorFactory* q_ptr;
+    Q_DECLARE_PUBLIC(QtPoint3DFEditorFactory)
+public:
+
+    void slotPropertyChanged(QtProperty* property, const QPoint3DF& value);
+    void slotPropertiesChanged(const QList<QtProperty*>& properties);
+    void slotDecimalsChanged(QtProperty* property, int prec);
+    void slotSetValue(double x, double y, double z);
+};
+class QtPoint3DFEditorFactory : public QtAbstractEditorFactory<QtPoint3DFPropertyManager>
+{
+    Q_OBJECT
+public:
+    QtPoint3DFEditorFactory(QObject *parent = 0);
+    ~QtPoint3DFEditorFactory();
+protected:
+    void connectPropertyManager(QtPoint3DFPropertyManager *manager) override;
+    QWidget *createEditor(QtPoint3DFPropertyManager *manager, QtProperty *property,
+                QWidget *parent) override;
+    void disconnectPropertyManager(QtPoint3DFPropertyManager *manager) override;
+private:
+    QScopedPointer<QtPoint3DFEditorFactoryPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtPoint3DFEditorFactory)
+    Q_DISABLE_COPY_MOVE(QtPoint3DFEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *, const QPoint3DF &))
+    Q_PRIVATE_SLOT(d_func(), void slotPropertiesChanged(const QList<QtProperty *> &))
+    Q_PRIVATE_SLOT(d_func(), void slotDecimalsChanged(QtProperty *, int))
+    Q_PRIVATE_SLOT(d_func(), void slotSetValue(double, double, double))
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
+};
+
+class QtRotation3DEditorFactory;
+class QtRotation3DEditorFactoryPrivate : public EditorFactoryPrivate<QtVector3DEditWidget>
+{
+    QtRotation3DEditorFactory* q_ptr;
+    Q_DECLARE_PUBLIC(QtRotation3DEditorFactory)
+public:
+
+    void slotPropertyChanged(QtProperty* property, const QRotation3D& value);
+    void slotSetValue(double x, double y, double z);
+};
+class QtRotation3DEditorFactory : public QtAbstractEditorFactory<QtRotation3DPropertyManager>
+{
+    Q_OBJECT
+public:
+    QtRotation3DEditorFactory(QObject *parent = 0);
+    ~QtRotation3DEditorFactory();
+protected:
+    void connectPropertyManager(QtRotation3DPropertyManager *manager) override;
+    QWidget *createEditor(QtRotation3DPropertyManager *manager, QtProperty *property,
+                QWidget *parent) override;
+    void disconnectPropertyManager(QtRotation3DPropertyManager *manager) override;
+private:
+    QScopedPointer<QtRotation3DEditorFactoryPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtRotation3DEditorFactory)
+    Q_DISABLE_COPY_MOVE(QtRotation3DEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *, const QRotation3D &))
+    Q_PRIVATE_SLOT(d_func(), void slotSetValue(double, double, double))
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
+};
+
+class QtIntRangeEditorFactory;
+class QtIntRangeEditorFactoryPrivate : public EditorFactoryPrivate<RangeSlider>
+{
+    QtIntRangeEditorFactory* q_ptr;
+    Q_DECLARE_PUBLIC(QtIntRangeEditorFactory)
+public:
+    void slotPropertyChanged(QtProperty* property, int minValue, int maxValue);
+    void slotRangeChanged(QtProperty* property, int min, int max);
+    void slotSingleStepChanged(QtProperty* property, int step);
+    void slotSetValues(int minValue, int maxValue);
+};
+class QtIntRangeEditorFactory : public QtAbstractEditorFactory<QtIntRangePropertyManager>
+{
+    Q_OBJECT
+public:
+    QtIntRangeEditorFactory(QObject *parent = 0);
+    ~QtIntRangeEditorFactory();
+protected:
+    void connectPropertyManager(QtIntRangePropertyManager *manager) override;
+    QWidget *createEditor(QtIntRangePropertyManager *manager, QtProperty *property,
+                QWidget *parent) override;
+    bool paintEditor(QtIntRangePropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option) override;
+    void disconnectPropertyManager(QtIntRangePropertyManager *manager) override;
+private:
+    QScopedPointer<QtIntRangeEditorFactoryPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtIntRangeEditorFactory)
+    Q_DISABLE_COPY_MOVE(QtIntRangeEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *, int, int))
+    Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, int, int))
+    Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, int))
+    Q_PRIVATE_SLOT(d_func(), void slotSetValues(int, int))
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
+};
+
+class QtDoubleRangeEditorFactory;
+class QtDoubleRangeEditorFactoryPrivate : public EditorFactoryPrivate<RangeSlider>
+{
+    QtDoubleRangeEditorFactory* q_ptr;
+    Q_DECLARE_PUBLIC(QtDoubleRangeEditorFactory)
+public:
+    // RangeSlider only has an int domain, so the editors work on ticks
+    // spread evenly over the property's range.
+    static int tickCount(const QtDoubleRangePropertyManager* manager, const QtProperty* property);
+    static int valueToTick(const QtDoubleRangePropertyManager* manager, const QtProperty* property, double value);
+    static double tickToValue(const QtDoubleRangePropertyManager* manager, const QtProperty* property, int tick);
+    static void updateEditor(RangeSlider* editor, const QtDoubleRangePropertyManager* manager, const QtProperty* property);
+
+    void slotPropertyChanged(QtProperty* property, double minValue, double maxValue);
+    void slotRangeChanged(QtProperty* property, double min, double max);
+    void slotSingleStepChanged(QtProperty* property, double step);
+    void slotSetValues(int minValue, int maxValue);
+};
+class QtDoubleRangeEditorFactory : public QtAbstractEditorFactory<QtDoubleRangePropertyManager>
+{
+    Q_OBJECT
+public:
+    QtDoubleRangeEditorFactory(QObject *parent = 0);
+    ~QtDoubleRangeEditorFactory();
+protected:
+    void connectPropertyManager(QtDoubleRangePropertyManager *manager) override;
+    QWidget *createEditor(QtDoubleRangePropertyManager *manager, QtProperty *property,
+                QWidget *parent) override;
+    bool paintEditor(QtDoubleRangePropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option) override;
+    void disconnectPropertyManager(QtDoubleRangePropertyManager *manager) override;
+private:
+    QScopedPointer<QtDoubleRangeEditorFactoryPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtDoubleRangeEditorFactory)
+    Q_DISABLE_COPY_MOVE(QtDoubleRangeEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *, double, double))
+    Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, double, double))
+    Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, double))
+    Q_PRIVATE_SLOT(d_func(), void slotSetValues(int, int))
     Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
 };
 
 class QtLineEditFactory;
-class QtLineEditFactoryPrivate : public EditorFactoryPrivate<QLineEdit>
+class QtLineEditFactoryPrivate : public EditorCommitPolicyPrivate<QLineEdit, QString>
 {
     QtLineEditFactory* q_ptr;
     Q_DECLARE_PUBLIC(QtLineEditFactory)
@@ -387,7 +851,15 @@ public:
 
     void slotPropertyChanged(QtProperty* property, const QString& value);
     void slotRegExpChanged(QtProperty* property, const QRegularExpression& regExp);
+    void slotValidationPendingChanged(QtProperty* property, bool pending);
     void slotSetValue(const QString& value);
+    void slotEditingFinished();
+    void slotCommitTimeout();
+
+    static void setValidationPending(QLineEdit* editor, bool pending);
+
+protected:
+    void commitValue(QtProperty* property, const QString& value) override;
 };
 class QtLineEditFactory : public QtAbstractEditorFactory<QtStringPropertyManager>
 {
@@ -406,7 +878,10 @@ private:
     Q_DISABLE_COPY_MOVE(QtLineEditFactory)
     Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *, const QString &))
     Q_PRIVATE_SLOT(d_func(), void slotRegExpChanged(QtProperty *, const QRegularExpression &))
+    Q_PRIVATE_SLOT(d_func(), void slotValidationPendingChanged(QtProperty *, bool))
     Q_PRIVATE_SLOT(d_func(), void slotSetValue(const QString &))
+    Q_PRIVATE_SLOT(d_func(), void slotEditingFinished())
+    Q_PRIVATE_SLOT(d_func(), void slotCommitTimeout())
     Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
 };
 
@@ -586,6 +1061,8 @@ protected:
     void connectPropertyManager(QtEnumPropertyManager *manager) override;
     QWidget *createEditor(QtEnumPropertyManager *manager, QtProperty *property,
                 QWidget *parent) override;
+    bool paintEditor(QtEnumPropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option) override;
     void disconnectPropertyManager(QtEnumPropertyManager *manager) override;
 private:
     QScopedPointer<QtEnumEditorFactoryPrivate> d_ptr;
@@ -661,6 +1138,8 @@ protected:
     void connectPropertyManager(QtColorPropertyManager *manager) override;
     QWidget *createEditor(QtColorPropertyManager *manager, QtProperty *property,
                 QWidget *parent) override;
+    bool paintEditor(QtColorPropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option) override;
     void disconnectPropertyManager(QtColorPropertyManager *manager) override;
 private:
     QScopedPointer<QtColorEditorFactoryPrivate> d_ptr;
@@ -0,0 +1,403 @@
+#include "qtobjectpropertybinder.h"
+#include <QtCore/QMetaProperty>
+#include <QtCore/QMutex>
+
+QT_BEGIN_NAMESPACE
+
+// The class description is shared by all binders and kept for the
+// lifetime of the application, like the meta-object it describes.
+typedef QHash<const QMetaObject *, QSharedPointer<const QtObjectPropertyBinderPrivate::ClassInfo> > QtClassInfoCache;
+Q_GLOBAL_STATIC(QtClassInfoCache, classInfoCache)
+Q_GLOBAL_STATIC(QMutex, classInfoCacheMutex)
+
+QSharedPointer<const QtObjectPropertyBinderPrivate::ClassInfo>
+        QtObjectPropertyBinderPrivate::classInfo(const QMetaObject *metaObject)
+{
+    QMutexLocker locker(classInfoCacheMutex());
+    QSharedPointer<const ClassInfo> &cached = (*classInfoCache())[metaObject];
+    if (cached)
+        return cached;
+
+    QSharedPointer<ClassInfo> info(new ClassInfo);
+    for (int i = 0; i < metaObject->propertyCount(); ++i) {
+        const QMetaProperty metaProperty = metaObject->property(i);
+        if (!metaProperty.isReadable() || !metaProperty.isDesignable())
+            continue;
+
+        ClassProperty classProperty;
+        classProperty.propertyIndex = i;
+        classProperty.notifySignalIndex = metaProperty.hasNotifySignal() ? metaProperty.notifySignalIndex() : -1;
+        classProperty.writable = metaProperty.isWritable();
+        if (metaProperty.isEnumType()) {
+            const QMetaEnum metaEnum = metaProperty.enumerator();
+            if (metaEnum.isFlag()) {
+                // The flag manager addresses flags by bit position, so only
+                // single bit keys can be offered.
+                classProperty.propertyType = QtVariantPropertyManager::flagTypeId();
+                for (int k = 0; k < metaEnum.keyCount(); ++k) {
+                    const int value = metaEnum.value(k);
+                    if (value == 0 || (value & (value - 1)) != 0)
+                        continue;
+                    classProperty.enumNames.append(QString::fromLatin1(metaEnum.key(k)));
+                    classProperty.enumValues.append(value);
+                }
+            } else {
+                classProperty.propertyType = QtVariantPropertyManager::enumTypeId();
+                for (int k = 0; k < metaEnum.keyCount(); ++k) {
+                    classProperty.enumNames.append(QString::fromLatin1(metaEnum.key(k)));
+                    classProperty.enumValues.append(metaEnum.value(k));
+                }
+            }
+        } else {
+            classProperty.propertyType = metaProperty.metaType().id();
+        }
+
+        info->properties.append(classProperty);
+        if (classProperty.notifySignalIndex >= 0)
+            info->notifySignalToProperties[classProperty.notifySignalIndex].append(info->properties.size() - 1);
+    }
+
+    cached = info;
+    return cached;
+}
+
+QVariant QtObjectPropertyBinderPrivate::toPropertyValue(const ClassProperty &classProperty, const QVariant &value) const
+{
+    if (classProperty.propertyType == QtVariantPropertyManager::enumTypeId())
+        return qMax(classProperty.enumValues.indexOf(value.toInt()), 0);
+    if (classProperty.propertyType == QtVariantPropertyManager::flagTypeId()) {
+        const int flags = value.toInt();
+        int bits = 0;
+        for (int i = 0; i < classProperty.enumValues.size(); ++i) {
+            if (flags & classProperty.enumValues.at(i))
+                bits |= 1 << i;
+        }
+        return bits;
+    }
+    return value;
+}
+
+QVariant QtObjectPropertyBinderPrivate::toObjectValue(const ClassProperty &classProperty, const QVariant &value) const
+{
+    if (classProperty.propertyType == QtVariantPropertyManager::enumTypeId())
+        return classProperty.enumValues.value(value.toInt());
+    if (classProperty.propertyType == QtVariantPropertyManager::flagTypeId()) {
+        const int bits = value.toInt();
+        int flags = 0;
+        for (int i = 0; i < classProperty.enumValues.size(); ++i) {
+            if (bits & (1 << i))
+                flags |= classProperty.enumValues.at(i);
+        }
+        return flags;
+    }
+    return value;
+}
+
+void QtObjectPropertyBinderPrivate::updateProperty(int index)
+{
+    QtVariantProperty *property = m_indexToProperty.at(index);
+    if (!property)
+        return;
+
+    const ClassProperty &classProperty = m_classInfo->properties.at(index);
+    const QMetaProperty metaProperty = m_metaObject->property(classProperty.propertyIndex);
+
+    const bool wasUpdating = m_updating;
+    m_updating = true;
+    if (m_objects.size() == 1) {
+        m_manager->setValue(property, toPropertyValue(classProperty, metaProperty.read(m_objects.first())));
+    } else {
+        QVariantList values;
+        values.reserve(m_objects.size());
+        for (QObject *object : qAsConst(m_objects))
+            values.append(toPropertyValue(classProperty, metaProperty.read(object)));
+        if (values != m_manager->targetValues(property))
+            m_manager->setTargetValues(property, values);
+    }
+    m_updating = wasUpdating;
+}
+
+void QtObjectPropertyBinderPrivate::deleteProperties()
+{
+    const QList<QtProperty *> properties = m_properties;
+    m_properties.clear();
+    m_indexToProperty.clear();
+    m_propertyToIndex.clear();
+    qDeleteAll(properties);
+}
+
+// Writes values to the objects at the same index. The notifications this
+// causes only mark the property; it is refreshed once afterwards, so that
+// values the objects adjusted are shown but not written back.
+void QtObjectPropertyBinderPrivate::writeValues(int index, const QVariantList &values)
+{
+    const ClassProperty &classProperty = m_classInfo->properties.at(index);
+    const QMetaProperty metaProperty = m_metaObject->property(classProperty.propertyIndex);
+
+    m_updating = true;
+    const qsizetype count = qMin(m_objects.size(), values.size());
+    for (qsizetype i = 0; i < count; ++i)
+        metaProperty.write(m_objects.at(i), toObjectValue(classProperty, values.at(i)));
+    m_updating = false;
+
+    const QSet<int> dirtyIndexes = m_dirtyIndexes;
+    m_dirtyIndexes.clear();
+    for (int dirtyIndex : dirtyIndexes)
+        updateProperty(dirtyIndex);
+}
+
+void QtObjectPropertyBinderPrivate::slotValueChanged(QtProperty *property, const QVariant &value)
+{
+    // Several objects are written from targetValuesChanged(), which carries
+    // the value of each of them.
+    if (m_updating || m_objects.size() != 1)
+        return;
+
+    const auto it = m_propertyToIndex.constFind(property);
+    if (it == m_propertyToIndex.constEnd())
+        return;
+    writeValues(it.value(), QVariantList() << value);
+}
+
+void QtObjectPropertyBinderPrivate::slotTargetValuesChanged(QtProperty *property, const QVariantList &values)
+{
+    if (m_updating || m_objects.size() < 2)
+        return;
+
+    const auto it = m_propertyToIndex.constFind(property);
+    if (it == m_propertyToIndex.constEnd())
+        return;
+    writeValues(it.value(), values);
+}
+
+void QtObjectPropertyBinderPrivate::slotPropertyDestroyed(QtProperty *property)
+{
+    const auto it = m_propertyToIndex.find(property);
+    if (it == m_propertyToIndex.end())
+        return;
+    m_indexToProperty[it.value()] = 0;
+    m_properties.removeAll(property);
+    m_propertyToIndex.erase(it);
+}
+
+void QtObjectPropertyBinderPrivate::slotObjectPropertyChanged()
+{
+    const int signalIndex = q_ptr->senderSignalIndex();
+    const auto it = m_classInfo->notifySignalToProperties.constFind(signalIndex);
+    if (it == m_classInfo->notifySignalToProperties.constEnd())
+        return;
+    for (int index : it.value()) {
+        if (m_updating)
+            m_dirtyIndexes.insert(index);
+        else
+            updateProperty(index);
+    }
+}
+
+void QtObjectPropertyBinderPrivate::slotObjectDestroyed(QObject *object)
+{
+    if (!m_objects.removeAll(object))
+        return;
+
+    if (m_objects.isEmpty()) {
+        deleteProperties();
+        m_classInfo.reset();
+        m_metaObject = 0;
+        return;
+    }
+
+    for (int i = 0; i < m_indexToProperty.size(); ++i)
+        updateProperty(i);
+}
+
+/*!
+    \class QtObjectPropertyBinder
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtObjectPropertyBinder class exposes the Q_PROPERTY
+    declarations of QObjects as variant properties.
+
+    bind() creates one property in the given QtVariantPropertyManager
+    for every readable, designable Q_PROPERTY of an object's class
+    whose type the manager supports, and returns them in declaration
+    order, ready to be added to a property browser. Enumerations and
+    flags become enum and flag properties; properties that cannot be
+    written are disabled.
+
+    The properties and the object are kept in sync in both directions:
+    editing a property writes the object's Q_PROPERTY, and the
+    property's NOTIFY signal updates the property. Properties without a
+    NOTIFY signal only follow edits made through the browser.
+
+    Several objects of the same class can be bound at once; their
+    properties are then bound to all values with
+    QtVariantPropertyManager::setTargetValues(), so that differing
+    values are shown as mixed and an edit is written to every object.
+
+    The meta-property indices and notify signals of a class are
+    resolved once and shared by all binders, so neither direction of
+    synchronization looks up properties by name.
+
+    \sa QtVariantPropertyManager
+*/
+
+/*!
+    Creates a binder that creates its properties in the given \a
+    manager, with the given \a parent.
+*/
+QtObjectPropertyBinder::QtObjectPropertyBinder(QtVariantPropertyManager *manager, QObject *parent)
+    : QObject(parent), d_ptr(new QtObjectPropertyBinderPrivate)
+{
+    d_ptr->q_ptr = this;
+    d_ptr->m_manager = manager;
+
+    connect(manager, SIGNAL(valueChanged(QtProperty*,QVariant)),
+                this, SLOT(slotValueChanged(QtProperty*,QVariant)));
+    connect(manager, SIGNAL(targetValuesChanged(QtProperty*,QVariantList)),
+                this, SLOT(slotTargetValuesChanged(QtProperty*,QVariantList)));
+    connect(manager, SIGNAL(propertyDestroyed(QtProperty*)),
+                this, SLOT(slotPropertyDestroyed(QtProperty*)));
+}
+
+/*!
+    Destroys the binder, and the properties it created.
+*/
+QtObjectPropertyBinder::~QtObjectPropertyBinder()
+{
+    unbind();
+}
+
+/*!
+    Returns the manager the binder creates its properties in.
+*/
+QtVariantPropertyManager *QtObjectPropertyBinder::propertyManager() const
+{
+    return d_ptr->m_manager;
+}
+
+/*!
+    Binds the given \a object, replacing any previous binding, and
+    returns the created properties.
+
+    \sa unbind(), properties()
+*/
+QList<QtProperty *> QtObjectPropertyBinder::bind(QObject *object)
+{
+    return bind(QList<QObject *>() << object);
+}
+
+/*!
+    \overload
+
+    Binds all of the given \a objects, which must be instances of the
+    same class, replacing any previous binding, and returns the created
+    properties.
+*/
+QList<QtProperty *> QtObjectPropertyBinder::bind(const QList<QObject *> &objects)
+{
+    unbind();
+    if (objects.isEmpty() || objects.contains(nullptr))
+        return QList<QtProperty *>();
+
+    const QMetaObject *metaObject = objects.first()->metaObject();
+    for (const QObject *object : objects) {
+        if (object->metaObject() != metaObject) {
+            qWarning("QtObjectPropertyBinder::bind: Objects of different classes cannot be bound together.");
+            return QList<QtProperty *>();
+        }
+    }
+
+    Q_D(QtObjectPropertyBinder);
+    d->m_metaObject = metaObject;
+    d->m_classInfo = QtObjectPropertyBinderPrivate::classInfo(metaObject);
+    d->m_objects = objects;
+
+    const QList<QtObjectPropertyBinderPrivate::ClassProperty> &classProperties = d->m_classInfo->properties;
+    d->m_indexToProperty.fill(0, classProperties.size());
+    for (int i = 0; i < classProperties.size(); ++i) {
+        const QtObjectPropertyBinderPrivate::ClassProperty &classProperty = classProperties.at(i);
+        if (!d->m_manager->isPropertyTypeSupported(classProperty.propertyType))
+            continue;
+
+        const QMetaProperty metaProperty = metaObject->property(classProperty.propertyIndex);
+        QtVariantProperty *property = d->m_manager->addProperty(classProperty.propertyType,
+                    QString::fromLatin1(metaProperty.name()));
+        if (!property)
+            continue;
+        if (classProperty.propertyType == QtVariantPropertyManager::enumTypeId())
+            property->setAttribute(QLatin1String("enumNames"), classProperty.enumNames);
+        else if (classProperty.propertyType == QtVariantPropertyManager::flagTypeId())
+            property->setAttribute(QLatin1String("flagNames"), classProperty.enumNames);
+        property->setEnabled(classProperty.writable);
+
+        d->m_indexToProperty[i] = property;
+        d->m_propertyToIndex.insert(property, i);
+        d->m_properties.append(property);
+        d->updateProperty(i);
+    }
+
+    static const int slotIndex = staticMetaObject.indexOfSlot("slotObjectPropertyChanged()");
+    for (QObject *object : objects) {
+        for (auto it = d->m_classInfo->notifySignalToProperties.cbegin();
+                    it != d->m_classInfo->notifySignalToProperties.cend(); ++it)
+            QMetaObject::connect(object, it.key(), this, slotIndex, Qt::UniqueConnection);
+        connect(object, SIGNAL(destroyed(QObject*)), this, SLOT(slotObjectDestroyed(QObject*)),
+                    Qt::UniqueConnection);
+    }
+
+    return d->m_properties;
+}
+
+/*!
+    Disconnects the bound objects and deletes the properties created
+    for them.
+
+    \sa bind()
+*/
+void QtObjectPropertyBinder::unbind()
+{
+    Q_D(QtObjectPropertyBinder);
+    for (QObject *object : qAsConst(d->m_objects))
+        disconnect(object, 0, this, 0);
+    d->m_objects.clear();
+    d->deleteProperties();
+    d->m_classInfo.reset();
+    d->m_metaObject = 0;
+}
+
+/*!
+    Returns the bound objects.
+*/
+QList<QObject *> QtObjectPropertyBinder::objects() const
+{
+    return d_ptr->m_objects;
+}
+
+/*!
+    Returns the properties created for the bound objects, in the order
+    their Q_PROPERTY declarations appear in the class.
+*/
+QList<QtProperty *> QtObjectPropertyBinder::properties() const
+{
+    return d_ptr->m_properties;
+}
+
+/*!
+    Returns the property created for the Q_PROPERTY with the given \a
+    name, or 0 if there is none.
+*/
+QtVariantProperty *QtObjectPropertyBinder::boundProperty(const char *name) const
+{
+    if (!d_ptr->m_metaObject)
+        return 0;
+    const int propertyIndex = d_ptr->m_metaObject->indexOfProperty(name);
+    const QList<QtObjectPropertyBinderPrivate::ClassProperty> &classProperties = d_ptr->m_classInfo->properties;
+    for (int i = 0; i < classProperties.size(); ++i) {
+        if (classProperties.at(i).propertyIndex == propertyIndex)
+            return d_ptr->m_indexToProperty.at(i);
+    }
+    return 0;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,90 @@
+#ifndef QTOBJECTPROPERTYBINDER_H
+#define QTOBJECTPROPERTYBINDER_H
+#include "qtvariantproperty.h"
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QSet>
+#include <QtCore/QSharedPointer>
+
+QT_BEGIN_NAMESPACE
+
+class QtObjectPropertyBinder;
+
+class QtObjectPropertyBinderPrivate
+{
+    QtObjectPropertyBinder *q_ptr;
+    Q_DECLARE_PUBLIC(QtObjectPropertyBinder)
+public:
+    // A Q_PROPERTY as seen by the binder, resolved once per class.
+    struct ClassProperty
+    {
+        int propertyIndex;
+        int propertyType;
+        int notifySignalIndex;
+        bool writable;
+        QStringList enumNames;
+        QList<int> enumValues;
+    };
+
+    struct ClassInfo
+    {
+        QList<ClassProperty> properties;
+        QHash<int, QList<int> > notifySignalToProperties;
+    };
+
+    static QSharedPointer<const ClassInfo> classInfo(const QMetaObject *metaObject);
+
+    QVariant toPropertyValue(const ClassProperty &classProperty, const QVariant &value) const;
+    QVariant toObjectValue(const ClassProperty &classProperty, const QVariant &value) const;
+    void updateProperty(int index);
+    void writeValues(int index, const QVariantList &values);
+    void deleteProperties();
+
+    void slotValueChanged(QtProperty *property, const QVariant &value);
+    void slotTargetValuesChanged(QtProperty *property, const QVariantList &values);
+    void slotPropertyDestroyed(QtProperty *property);
+    void slotObjectPropertyChanged();
+    void slotObjectDestroyed(QObject *object);
+
+    QtVariantPropertyManager *m_manager;
+    const QMetaObject *m_metaObject{nullptr};
+    QSharedPointer<const ClassInfo> m_classInfo;
+    QList<QObject *> m_objects;
+    QList<QtProperty *> m_properties;
+    QList<QtVariantProperty *> m_indexToProperty;
+    QHash<const QtProperty *, int> m_propertyToIndex;
+    bool m_updating{false};
+    QSet<int> m_dirtyIndexes;
+};
+
+class QtObjectPropertyBinder : public QObject
+{
+    Q_OBJECT
+public:
+    explicit QtObjectPropertyBinder(QtVariantPropertyManager *manager, QObject *parent = 0);
+    ~QtObjectPropertyBinder();
+
+    QtVariantPropertyManager *propertyManager() const;
+
+    QList<QtProperty *> bind(QObject *object);
+    QList<QtProperty *> bind(const QList<QObject *> &objects);
+    void unbind();
+
+    QList<QObject *> objects() const;
+    QList<QtProperty *> properties() const;
+    QtVariantProperty *boundProperty(const char *name) const;
+
+private:
+    QScopedPointer<class QtObjectPropertyBinderPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtObjectPropertyBinder)
+    Q_DISABLE_COPY_MOVE(QtObjectPropertyBinder)
+    Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, const QVariant &))
+    Q_PRIVATE_SLOT(d_func(), void slotTargetValuesChanged(QtProperty *, const QVariantList &))
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyDestroyed(QtProperty *))
+    Q_PRIVATE_SLOT(d_func(), void slotObjectPropertyChanged())
+    Q_PRIVATE_SLOT(d_func(), void slotObjectDestroyed(QObject *))
+};
+
+QT_END_NAMESPACE
+
+#endif
@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qtpropertybrowser.h"
+#include <QtCore/QDebug>
 
 #if defined(Q_CC_MSVC)
 #    pragma warning(disable: 4786) /* MS VS 6: truncating debug info after 255 characters */
@@ -45,6 +46,127 @@
 
 QT_BEGIN_NAMESPACE
 
+/*!
+    \class QtMemoryReport
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtMemoryReport struct breaks down the memory used by
+    property managers and browsers.
+
+    A report is returned by QtAbstractPropertyManager::memoryReport()
+    and QtAbstractPropertyBrowser::memoryReport(). It holds the number
+    of bytes per category, per manager class and per property. Bytes
+    that cannot be charged to a single property, like the widgets of a
+    browser, only appear in the categories.
+
+    The numbers are estimates computed from the sizes of the involved
+    structures and the capacities of their containers. They do not
+    include allocator overhead or data shared between properties.
+*/
+
+/*!
+    Adds \a bytes to the given \a category, to the \a managerType
+    unless it is empty, and to the \a property unless it is 0.
+*/
+void QtMemoryReport::add(Category category, const QString &managerType, const QtProperty *property, qint64 bytes)
+{
+    categories[category] += bytes;
+    if (!managerType.isEmpty())
+        managerTypes[managerType] += bytes;
+    if (property)
+        properties[property] += bytes;
+}
+
+/*!
+    Returns the sum of all categories.
+*/
+qint64 QtMemoryReport::totalBytes() const
+{
+    qint64 total = 0;
+    for (int i = 0; i < CategoryCount; ++i)
+        total += categories[i];
+    return total;
+}
+
+/*!
+    Adds the numbers of the \a other report to this one.
+*/
+QtMemoryReport &QtMemoryReport::operator+=(const QtMemoryReport &other)
+{
+    for (int i = 0; i < CategoryCount; ++i)
+        categories[i] += other.categories[i];
+    for (auto it = other.managerTypes.cbegin(); it != other.managerTypes.cend(); ++it)
+        managerTypes[it.key()] += it.value();
+    for (auto it = other.properties.cbegin(); it != other.properties.cend(); ++it)
+        properties[it.key()] += it.value();
+    return *this;
+}
+
+/*!
+    Returns a readable name for the given \a category.
+*/
+QString QtMemoryReport::categoryName(Category category)
+{
+    switch (category) {
+    case Properties:
+        return QLatin1String("Properties");
+    case ManagerData:
+        return QLatin1String("Manager data");
+    case MapNodes:
+        return QLatin1String("Map nodes");
+    case Journal:
+        return QLatin1String("Journal");
+    case BrowserItems:
+        return QLatin1String("Browser items");
+    case TreeWidgetItems:
+        return QLatin1String("Tree widget items");
+    case Widgets:
+        return QLatin1String("Widgets");
+    default:
+        break;
+    }
+    return QString();
+}
+
+/*!
+    Returns the heap memory held by the given \a string.
+*/
+qint64 QtMemoryReport::stringBytes(const QString &string)
+{
+    if (!string.capacity())
+        return 0;
+    return sizeof(QArrayData) + (string.capacity() + 1) * qint64(sizeof(QChar));
+}
+
+/*!
+    Returns an estimate of the memory used by the given \a widget. The
+    size of a widget's private data is not available, so a fixed amount
+    is added for it.
+*/
+qint64 QtMemoryReport::widgetBytes(const QWidget *widget)
+{
+    Q_UNUSED(widget);
+    return sizeof(QWidget) + 1024;
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+QDebug operator<<(QDebug debug, const QtMemoryReport &report)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "QtMemoryReport(total " << report.totalBytes() << " bytes";
+    for (int i = 0; i < QtMemoryReport::CategoryCount; ++i) {
+        const QtMemoryReport::Category category = static_cast<QtMemoryReport::Category>(i);
+        if (report.categories[i])
+            debug << ", " << QtMemoryReport::categoryName(category) << ": " << report.categories[i];
+    }
+    for (auto it = report.managerTypes.cbegin(); it != report.managerTypes.cend(); ++it)
+        debug << ", " << it.key() << ": " << it.value();
+    debug << ", " << report.properties.size() << " properties)";
+    return debug;
+}
+#endif
+
 /*!
     \class QtProperty
     \internal
@@ -237,6 +359,23 @@ bool QtProperty::isModified() const
     return d_ptr->m_modified;
 }
 
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+// Counts a call and adds the time spent until the end of the scope.
+class QtInstrumentationScope
+{
+public:
+    QtInstrumentationScope(qint64 &calls, qint64 &nsecs) : m_nsecs(nsecs)
+    {
+        ++calls;
+        m_timer.start();
+    }
+    ~QtInstrumentationScope() { m_nsecs += m_timer.nsecsElapsed(); }
+private:
+    qint64 &m_nsecs;
+    QElapsedTimer m_timer;
+};
+#endif
+
 /*!
     Returns whether the property has a value.
 
@@ -253,11 +392,24 @@ bool QtProperty::hasValue() const
     If the given property type can not generate such an icon, this
     function returns an invalid icon.
 
-    \sa QtAbstractPropertyManager::valueIcon()
+    If the manager's value cache is enabled, the icon is generated once
+    and reused until the property changes.
+
+    \sa QtAbstractPropertyManager::valueIcon(), QtAbstractPropertyManager::setValueCacheEnabled()
 */
 QIcon QtProperty::valueIcon() const
 {
-    return d_ptr->m_manager->valueIcon(this);
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters &counters = d_ptr->m_manager->d_ptr->m_counters;
+    const QtInstrumentationScope scope(counters.valueIconCalls, counters.valueIconNSecs);
+#endif
+    if (!d_ptr->m_manager->d_ptr->m_valueCacheEnabled)
+        return d_ptr->m_manager->valueIcon(this);
+    if (!d_ptr->m_valueIconCached) {
+        d_ptr->m_valueIcon = d_ptr->m_manager->valueIcon(this);
+        d_ptr->m_valueIconCached = true;
+    }
+    return d_ptr->m_valueIcon;
 }
 
 /*!
@@ -266,11 +418,24 @@ QIcon QtProperty::valueIcon() const
     If the given property type can not generate such a string, this
     function returns an empty string.
 
-    \sa QtAbstractPropertyManager::valueText()
+    If the manager's value cache is enabled, the string is generated
+    once and reused until the property changes.
+
+    \sa QtAbstractPropertyManager::valueText(), QtAbstractPropertyManager::setValueCacheEnabled()
 */
 QString QtProperty::valueText() const
 {
-    return d_ptr->m_manager->valueText(this);
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters &counters = d_ptr->m_manager->d_ptr->m_counters;
+    const QtInstrumentationScope scope(counters.valueTextCalls, counters.valueTextNSecs);
+#endif
+    if (!d_ptr->m_manager->d_ptr->m_valueCacheEnabled)
+        return d_ptr->m_manager->valueText(this);
+    if (!d_ptr->m_valueTextCached) {
+        d_ptr->m_valueText = d_ptr->m_manager->valueText(this);
+        d_ptr->m_valueTextCached = true;
+    }
+    return d_ptr->m_valueText;
 }
 
 /*!
@@ -474,6 +639,48 @@ void QtProperty::removeSubProperty(QtProperty *property)
     }
 }
 
+/*!
+    Returns whether the subproperties of this property are created on
+    demand rather than together with the property itself.
+
+    Such subproperties only exist while at least one client holds a
+    request obtained with requestSubProperties().
+
+    \sa QtAbstractPropertyManager::hasDeferredSubProperties()
+*/
+bool QtProperty::hasDeferredSubProperties() const
+{
+    return d_ptr->m_manager->hasDeferredSubProperties(this);
+}
+
+/*!
+    Asks the manager to create the deferred subproperties of this
+    property. Requests are counted; the subproperties are created by
+    the first request and stay alive until every request has been
+    released with releaseSubProperties().
+
+    \sa hasDeferredSubProperties()
+*/
+void QtProperty::requestSubProperties()
+{
+    if (d_ptr->m_subPropertyRequests++ == 0)
+        d_ptr->m_manager->createDeferredSubProperties(this);
+}
+
+/*!
+    Releases a request made with requestSubProperties(). When the last
+    request is released the manager destroys the deferred subproperties.
+
+    \sa hasDeferredSubProperties()
+*/
+void QtProperty::releaseSubProperties()
+{
+    if (d_ptr->m_subPropertyRequests == 0)
+        return;
+    if (--d_ptr->m_subPropertyRequests == 0)
+        d_ptr->m_manager->destroyDeferredSubProperties(this);
+}
+
 /*!
     \internal
 */
@@ -487,7 +694,11 @@ void QtProperty::propertyChanged()
 void QtAbstractPropertyManagerPrivate::propertyDestroyed(QtProperty *property)
 {
     if (m_properties.contains(property)) {
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+        ++m_counters.signalsEmitted;
+#endif
         emit q_ptr->propertyDestroyed(property);
+        removeFromJournal(property);
         q_ptr->uninitializeProperty(property);
         m_properties.remove(property);
     }
@@ -498,15 +709,194 @@ void QtAbstractPropertyManagerPrivate::propertyChanged(QtProperty *property) con
     emit q_ptr->propertyChanged(property);
 }
 
+void QtAbstractPropertyManagerPrivate::slotPropertyChanged(QtProperty *property)
+{
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    ++m_counters.signalsEmitted;
+#endif
+    q_ptr->invalidateValueCache(property);
+    if (m_journalEnabled && !m_applyingJournal)
+        recordChange(property);
+}
+
+QAtomicInt QtAbstractPropertyManagerPrivate::valueTextGeneration;
+
+QtAbstractPropertyManagerPrivate::JournalEntry &QtAbstractPropertyManagerPrivate::journalEntry(qsizetype index)
+{
+    return m_journal[(m_journalHead + index) % m_journal.size()];
+}
+
+const QtAbstractPropertyManagerPrivate::JournalEntry &QtAbstractPropertyManagerPrivate::journalEntry(qsizetype index) const
+{
+    return m_journal.at((m_journalHead + index) % m_journal.size());
+}
+
+bool QtAbstractPropertyManagerPrivate::startsJournalStep(qsizetype index) const
+{
+    return index == 0 || journalEntry(index).group != journalEntry(index - 1).group;
+}
+
+void QtAbstractPropertyManagerPrivate::appendJournalEntry(const JournalEntry &entry)
+{
+    if (m_journalCount == m_journal.size()) {
+        // Full: unroll the ring into a buffer twice the size.
+        QList<JournalEntry> journal;
+        journal.reserve(qMax(qsizetype(16), 2 * m_journalCount));
+        for (qsizetype i = 0; i < m_journalCount; ++i)
+            journal.append(journalEntry(i));
+        journal.resize(qMax(qsizetype(16), 2 * m_journalCount));
+        m_journal.swap(journal);
+        m_journalHead = 0;
+    }
+    journalEntry(m_journalCount++) = entry;
+    if (startsJournalStep(m_journalCount - 1))
+        ++m_journalSteps;
+}
+
+// Drops the entries from count on, the steps that could be redone.
+void QtAbstractPropertyManagerPrivate::truncateJournal(qsizetype count)
+{
+    for (qsizetype i = m_journalCount - 1; i >= count; --i) {
+        if (startsJournalStep(i))
+            --m_journalSteps;
+        journalEntry(i) = JournalEntry();
+    }
+    m_journalCount = qMin(m_journalCount, count);
+    m_journalPosition = qMin(m_journalPosition, m_journalCount);
+}
+
+void QtAbstractPropertyManagerPrivate::clearJournalEntries()
+{
+    m_journal.clear();
+    m_journalHead = 0;
+    m_journalCount = 0;
+    m_journalSteps = 0;
+    m_journalPosition = 0;
+}
+
+void QtAbstractPropertyManagerPrivate::recordChange(QtProperty *property)
+{
+    const auto it = m_journalValues.find(property);
+    if (it == m_journalValues.end())
+        return;
+
+    const QVariant after = q_ptr->journalValue(property);
+    if (after == it.value())
+        return;
+    const QVariant before = it.value();
+    it.value() = after;
+
+    truncateJournal(m_journalPosition);
+    const qint64 now = m_journalClock.elapsed();
+    if (m_journalCount > 0) {
+        JournalEntry &last = journalEntry(m_journalCount - 1);
+        if (last.group == m_mergeGroup && last.property == property
+                && now - last.time <= m_journalMergeInterval) {
+            last.after = after;
+            last.time = now;
+            if (last.before == last.after) {
+                truncateJournal(m_journalCount - 1);
+                m_mergeGroup = -1;
+            }
+            emit q_ptr->journalChanged();
+            return;
+        }
+    }
+
+    const int group = m_journalGroupDepth > 0 ? m_journalGroup : ++m_nextJournalGroup;
+    appendJournalEntry({property, before, after, group, now});
+    m_journalPosition = m_journalCount;
+    m_mergeGroup = group;
+    trimJournal();
+    emit q_ptr->journalChanged();
+}
+
+// Undoes or redoes the entries of one group, without recording the
+// changes this causes. The entries are handed to the manager at once,
+// so that it can apply them as one batch.
+void QtAbstractPropertyManagerPrivate::applyJournal(bool undo)
+{
+    if (undo ? m_journalPosition == 0 : m_journalPosition == m_journalCount)
+        return;
+
+    const int group = journalEntry(undo ? m_journalPosition - 1 : m_journalPosition).group;
+    QList<QtProperty *> properties;
+    QVariantList values;
+    while (undo ? m_journalPosition > 0 && journalEntry(m_journalPosition - 1).group == group
+                : m_journalPosition < m_journalCount && journalEntry(m_journalPosition).group == group) {
+        const JournalEntry &entry = journalEntry(undo ? --m_journalPosition : m_journalPosition++);
+        properties.append(entry.property);
+        values.append(undo ? entry.before : entry.after);
+    }
+
+    m_applyingJournal = true;
+    q_ptr->setJournalValues(properties, values);
+    m_applyingJournal = false;
+    for (QtProperty *property : qAsConst(properties)) {
+        const auto it = m_journalValues.find(property);
+        if (it != m_journalValues.end())
+            it.value() = q_ptr->journalValue(property);
+    }
+    m_mergeGroup = -1;
+    emit q_ptr->journalChanged();
+}
+
+void QtAbstractPropertyManagerPrivate::removeFromJournal(QtProperty *property)
+{
+    if (!m_journalValues.remove(property))
+        return;
+
+    QList<JournalEntry> journal;
+    qsizetype position = 0;
+    for (qsizetype i = 0; i < m_journalCount; ++i) {
+        const JournalEntry &entry = journalEntry(i);
+        if (entry.property == property)
+            continue;
+        journal.append(entry);
+        if (i < m_journalPosition)
+            ++position;
+    }
+    if (journal.size() == m_journalCount)
+        return;
+
+    clearJournalEntries();
+    for (const JournalEntry &entry : qAsConst(journal))
+        appendJournalEntry(entry);
+    m_journalPosition = position;
+    m_mergeGroup = -1;
+    emit q_ptr->journalChanged();
+}
+
+// Drops the oldest steps beyond the journal's capacity.
+void QtAbstractPropertyManagerPrivate::trimJournal()
+{
+    while (m_journalSteps > m_journalCapacity) {
+        const int group = journalEntry(0).group;
+        while (m_journalCount > 0 && journalEntry(0).group == group) {
+            journalEntry(0) = JournalEntry();
+            m_journalHead = (m_journalHead + 1) % m_journal.size();
+            --m_journalCount;
+            m_journalPosition = qMax(qsizetype(0), m_journalPosition - 1);
+        }
+        --m_journalSteps;
+    }
+}
+
 void QtAbstractPropertyManagerPrivate::propertyRemoved(QtProperty *property,
             QtProperty *parentProperty) const
 {
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    ++q_ptr->instrumentationCounters().signalsEmitted;
+#endif
     emit q_ptr->propertyRemoved(property, parentProperty);
 }
 
 void QtAbstractPropertyManagerPrivate::propertyInserted(QtProperty *property,
             QtProperty *parentProperty, QtProperty *afterProperty) const
 {
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    ++q_ptr->instrumentationCounters().signalsEmitted;
+#endif
     emit q_ptr->propertyInserted(property, parentProperty, afterProperty);
 }
 
@@ -537,6 +927,23 @@ void QtAbstractPropertyManagerPrivate::propertyInserted(QtProperty *property,
     emitted when the manager's properties change: propertyInserted(),
     propertyRemoved(), propertyChanged() and propertyDestroyed().
 
+    Changes to property values can be recorded in a journal, see
+    setJournalEnabled(). undo() and redo() then step through the
+    recorded changes. Consecutive changes of one property within
+    journalMergeInterval() form a single step, and the changes made
+    between beginJournalGroup() and endJournalGroup() are undone and
+    redone together. Managers take part by reimplementing
+    journalValue() and setJournalValue(), and setJournalValues() to
+    apply a step as one batch.
+
+    The text and icon representing a property's value are cached by
+    default: QtProperty::valueText() and QtProperty::valueIcon() call
+    the manager's valueText() and valueIcon() functions only after the
+    manager has emitted propertyChanged() for the property. Managers
+    whose representation depends on state they do not report through
+    propertyChanged() should call invalidateValueCache(), or disable
+    the cache with setValueCacheEnabled().
+
     QtAbstractPropertyManager subclasses are supposed to provide their
     own type specific API. Note that several ready-made
     implementations are available:
@@ -606,6 +1013,15 @@ void QtAbstractPropertyManagerPrivate::propertyInserted(QtProperty *property,
     \sa QtAbstractPropertyBrowser::itemRemoved()
 */
 
+/*!
+    \fn void QtAbstractPropertyManager::journalChanged()
+
+    This signal is emitted whenever a change is recorded in the journal
+    or the journal is stepped through, cleared or trimmed.
+
+    \sa canUndo(), canRedo()
+*/
+
 /*!
     \fn void QtAbstractPropertyManager::propertyDestroyed(QtProperty *property)
 
@@ -627,43 +1043,443 @@ void QtAbstractPropertyManagerPrivate::propertyInserted(QtProperty *property,
 */
 
 /*!
-    Creates an abstract property manager with the given \a parent.
+    Creates an abstract property manager with the given \a parent.
+*/
+QtAbstractPropertyManager::QtAbstractPropertyManager(QObject *parent)
+    : QObject(parent), d_ptr(new QtAbstractPropertyManagerPrivate)
+{
+    d_ptr->q_ptr = this;
+
+    // Connected first so the cache is already reset when other receivers
+    // of propertyChanged() ask for the new value text.
+    connect(this, SIGNAL(propertyChanged(QtProperty*)),
+                this, SLOT(slotPropertyChanged(QtProperty*)));
+}
+
+/*!
+    Destroys the manager. All properties created by the manager are
+    destroyed.
+*/
+QtAbstractPropertyManager::~QtAbstractPropertyManager()
+{
+    clear();
+}
+
+/*!
+    Destroys all the properties that this manager has created.
+
+    \sa propertyDestroyed(), uninitializeProperty()
+*/
+void QtAbstractPropertyManager::clear() const
+{
+    while (!d_ptr->m_properties.isEmpty())
+        delete *d_ptr->m_properties.cbegin();
+}
+
+/*!
+    Returns the set of properties created by this manager.
+
+    \sa addProperty()
+*/
+QSet<QtProperty *> QtAbstractPropertyManager::properties() const
+{
+    return d_ptr->m_properties;
+}
+
+/*!
+    Returns whether the text and icon representing the value of this
+    manager's properties are cached.
+
+    \sa setValueCacheEnabled(), invalidateValueCache()
+*/
+bool QtAbstractPropertyManager::isValueCacheEnabled() const
+{
+    return d_ptr->m_valueCacheEnabled;
+}
+
+/*!
+    Enables the value cache if \a enable is true; otherwise disables
+    it. The cache is enabled by default.
+
+    While the cache is enabled, QtProperty::valueText() and
+    QtProperty::valueIcon() return the result of the last valueText()
+    and valueIcon() call until the property changes.
+
+    \sa isValueCacheEnabled(), invalidateValueCache()
+*/
+void QtAbstractPropertyManager::setValueCacheEnabled(bool enable)
+{
+    if (d_ptr->m_valueCacheEnabled == enable)
+        return;
+
+    d_ptr->m_valueCacheEnabled = enable;
+    invalidateValueCache();
+}
+
+/*!
+    Discards the cached text and icon of the given \a property, or of
+    all properties created by this manager if \a property is 0.
+
+    The cache is invalidated automatically whenever propertyChanged()
+    is emitted. Invalidating all properties also makes the managers
+    translate their value text templates again. Property browsers do
+    so on a language change.
+
+    \sa setValueCacheEnabled()
+*/
+void QtAbstractPropertyManager::invalidateValueCache(QtProperty *property)
+{
+    if (property) {
+        if (property->propertyManager() != this)
+            return;
+        property->d_ptr->m_valueText.clear();
+        property->d_ptr->m_valueIcon = QIcon();
+        property->d_ptr->m_valueTextCached = false;
+        property->d_ptr->m_valueIconCached = false;
+        return;
+    }
+
+    QtAbstractPropertyManagerPrivate::valueTextGeneration.ref();
+    for (QtProperty *prop : qAsConst(d_ptr->m_properties))
+        invalidateValueCache(prop);
+}
+
+/*!
+    Returns whether changes to the values of this manager's properties
+    are recorded.
+
+    \sa setJournalEnabled(), undo(), redo()
+*/
+bool QtAbstractPropertyManager::isJournalEnabled() const
+{
+    return d_ptr->m_journalEnabled;
+}
+
+/*!
+    Starts recording changes to the values of this manager's properties
+    if \a enable is true; otherwise stops recording and clears the
+    journal. The journal is disabled by default.
+
+    Only properties for which journalValue() returns a valid value are
+    recorded. While the journal is enabled the manager keeps the last
+    recorded value of each such property.
+
+    \sa isJournalEnabled(), clearJournal()
+*/
+void QtAbstractPropertyManager::setJournalEnabled(bool enable)
+{
+    if (d_ptr->m_journalEnabled == enable)
+        return;
+
+    d_ptr->m_journalEnabled = enable;
+    if (!enable) {
+        d_ptr->m_journalValues.clear();
+        clearJournal();
+        return;
+    }
+
+    d_ptr->m_journalClock.start();
+    for (QtProperty *property : qAsConst(d_ptr->m_properties)) {
+        const QVariant value = journalValue(property);
+        if (value.isValid())
+            d_ptr->m_journalValues.insert(property, value);
+    }
+}
+
+/*!
+    Returns the number of steps the journal keeps.
+
+    \sa setJournalCapacity()
+*/
+int QtAbstractPropertyManager::journalCapacity() const
+{
+    return d_ptr->m_journalCapacity;
+}
+
+/*!
+    Sets the number of steps the journal keeps to \a steps. When more
+    steps are recorded, the oldest ones are dropped. The default is 100.
+
+    \sa journalCapacity()
+*/
+void QtAbstractPropertyManager::setJournalCapacity(int steps)
+{
+    steps = qMax(1, steps);
+    if (d_ptr->m_journalCapacity == steps)
+        return;
+
+    d_ptr->m_journalCapacity = steps;
+    const qsizetype count = d_ptr->m_journalCount;
+    d_ptr->trimJournal();
+    if (d_ptr->m_journalCount != count)
+        emit journalChanged();
+}
+
+/*!
+    Returns the time in milliseconds within which consecutive changes
+    of the same property are merged into one step.
+
+    \sa setJournalMergeInterval()
+*/
+int QtAbstractPropertyManager::journalMergeInterval() const
+{
+    return d_ptr->m_journalMergeInterval;
+}
+
+/*!
+    Sets the time within which consecutive changes of the same property
+    are merged into one step to \a msec milliseconds, so that dragging
+    a slider for instance is undone at once. A negative value disables
+    merging. The default is 500.
+
+    \sa journalMergeInterval()
+*/
+void QtAbstractPropertyManager::setJournalMergeInterval(int msec)
+{
+    d_ptr->m_journalMergeInterval = msec;
+}
+
+/*!
+    Returns whether the journal holds a step that can be undone.
+
+    \sa undo(), journalChanged()
+*/
+bool QtAbstractPropertyManager::canUndo() const
+{
+    return d_ptr->m_journalPosition > 0;
+}
+
+/*!
+    Returns whether the journal holds a step that can be redone.
+
+    \sa redo(), journalChanged()
+*/
+bool QtAbstractPropertyManager::canRedo() const
+{
+    return d_ptr->m_journalPosition < d_ptr->m_journalCount;
+}
+
+/*!
+    Starts a group of changes which are undone and redone as one step.
+    Groups can be nested, the outermost group ends with the matching
+    call to endJournalGroup().
+
+    \sa endJournalGroup()
+*/
+void QtAbstractPropertyManager::beginJournalGroup()
+{
+    if (d_ptr->m_journalGroupDepth++ == 0) {
+        d_ptr->m_journalGroup = ++d_ptr->m_nextJournalGroup;
+        d_ptr->m_mergeGroup = -1;
+    }
+}
+
+/*!
+    Ends a group of changes started with beginJournalGroup().
+
+    \sa beginJournalGroup()
+*/
+void QtAbstractPropertyManager::endJournalGroup()
+{
+    if (d_ptr->m_journalGroupDepth == 0)
+        return;
+    if (--d_ptr->m_journalGroupDepth == 0)
+        d_ptr->m_mergeGroup = -1;
+}
+
+/*!
+    Removes all steps from the journal.
+
+    \sa setJournalEnabled()
+*/
+void QtAbstractPropertyManager::clearJournal()
+{
+    if (d_ptr->m_journalCount == 0)
+        return;
+
+    d_ptr->clearJournalEntries();
+    d_ptr->m_mergeGroup = -1;
+    emit journalChanged();
+}
+
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+/*!
+    Returns a snapshot of the manager's instrumentation counters.
+
+    setValueCalls counts calls of the value setters of the concrete
+    managers, and signalsEmitted the propertyChanged(),
+    propertyInserted(), propertyRemoved() and propertyDestroyed()
+    notifications. The valueText and valueIcon counters cover calls of
+    QtProperty::valueText() and QtProperty::valueIcon() for the
+    manager's properties, with the time spent in them in nanoseconds.
+
+    Only available when the library is built with
+    QT_PROPERTYBROWSER_INSTRUMENTATION defined.
+
+    \sa resetCounters()
+*/
+QtPropertyBrowserCounters QtAbstractPropertyManager::counters() const
+{
+    return d_ptr->m_counters;
+}
+
+/*!
+    Sets all instrumentation counters of the manager to zero.
+
+    \sa counters()
+*/
+void QtAbstractPropertyManager::resetCounters()
+{
+    d_ptr->m_counters = QtPropertyBrowserCounters();
+}
+
+/*!
+    Returns the counters updated by QT_PROPERTYBROWSER_COUNT() in the
+    member functions of derived managers.
+*/
+QtPropertyBrowserCounters &QtAbstractPropertyManager::instrumentationCounters() const
+{
+    return d_ptr->m_counters;
+}
+#endif
+
+/*!
+    Restores the values the properties had before the last recorded
+    step.
+
+    \sa redo(), canUndo()
+*/
+void QtAbstractPropertyManager::undo()
+{
+    d_ptr->applyJournal(true);
+}
+
+/*!
+    Applies the step last undone again.
+
+    \sa undo(), canRedo()
+*/
+void QtAbstractPropertyManager::redo()
+{
+    d_ptr->applyJournal(false);
+}
+
+/*!
+    Returns the value of the given \a property as recorded in the
+    journal.
+
+    The default implementation returns an invalid value, which excludes
+    the property from the journal.
+
+    \sa setJournalValue(), setJournalEnabled()
+*/
+QVariant QtAbstractPropertyManager::journalValue(const QtProperty *property) const
+{
+    Q_UNUSED(property);
+    return QVariant();
+}
+
+/*!
+    Sets the value of the given \a property to a \a value previously
+    returned by journalValue(). Called when undoing or redoing a step.
+
+    The default implementation does nothing.
+
+    \sa journalValue()
 */
-QtAbstractPropertyManager::QtAbstractPropertyManager(QObject *parent)
-    : QObject(parent), d_ptr(new QtAbstractPropertyManagerPrivate)
+void QtAbstractPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
 {
-    d_ptr->q_ptr = this;
-
+    Q_UNUSED(property);
+    Q_UNUSED(value);
 }
 
 /*!
-    Destroys the manager. All properties created by the manager are
-    destroyed.
+    Sets the values of all \a properties to the \a values at the same
+    index, as recorded by one step of the journal, in order. A property
+    may occur more than once. Called when undoing or redoing a step.
+
+    The default implementation calls setJournalValue() for each
+    property. Managers with a bulk setter reimplement it to update the
+    properties as one batch.
+
+    \sa setJournalValue()
 */
-QtAbstractPropertyManager::~QtAbstractPropertyManager()
+void QtAbstractPropertyManager::setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values)
 {
-    clear();
+    const qsizetype count = qMin(properties.size(), values.size());
+    for (qsizetype i = 0; i < count; ++i)
+        setJournalValue(properties.at(i), values.at(i));
 }
 
 /*!
-    Destroys all the properties that this manager has created.
+    Returns an estimate of the memory used by the manager's properties:
+    the QtProperty objects, the data the manager keeps for them, the
+    map entries linking compound properties to their subproperties and
+    the journal. The managers that are children of this manager, like
+    the ones creating the subproperties of compound properties, are
+    included.
 
-    \sa propertyDestroyed(), uninitializeProperty()
+    \sa reportMemory(), QtAbstractPropertyBrowser::memoryReport()
 */
-void QtAbstractPropertyManager::clear() const
+QtMemoryReport QtAbstractPropertyManager::memoryReport() const
 {
-    while (!d_ptr->m_properties.isEmpty())
-        delete *d_ptr->m_properties.cbegin();
+    QtMemoryReport report;
+    const QString type = QString::fromLatin1(metaObject()->className());
+    const qint64 linkBytes = 2 * QtMemoryReport::mapNodeBytes<const QtProperty *, QtProperty *>();
+
+    for (QtProperty *property : qAsConst(d_ptr->m_properties)) {
+        const QtPropertyPrivate *data = property->d_ptr.data();
+        qint64 bytes = sizeof(QtProperty) + sizeof(QtPropertyPrivate)
+                    + QtMemoryReport::hashNodeBytes<QtProperty *, QHashDummyValue>()
+                    + QtMemoryReport::stringBytes(data->m_valueToolTip)
+                    + QtMemoryReport::stringBytes(data->m_descriptionToolTip)
+                    + QtMemoryReport::stringBytes(data->m_statusTip)
+                    + QtMemoryReport::stringBytes(data->m_whatsThis)
+                    + QtMemoryReport::stringBytes(data->m_name)
+                    + QtMemoryReport::stringBytes(data->m_valueText)
+                    + QtMemoryReport::listBytes(data->m_subItems)
+                    + data->m_parentItems.capacity() * QtMemoryReport::hashNodeBytes<QtProperty *, QHashDummyValue>();
+        report.add(QtMemoryReport::Properties, type, property, bytes);
+
+        // Compound managers map each property to its subproperties and back.
+        qint64 links = 0;
+        for (QtProperty *subProperty : qAsConst(data->m_subItems)) {
+            if (subProperty->propertyManager()->parent() == this)
+                links += linkBytes;
+        }
+        if (links)
+            report.add(QtMemoryReport::MapNodes, type, property, links);
+
+        reportMemory(property, &report);
+    }
+
+    for (qsizetype i = 0; i < d_ptr->m_journalCount; ++i) {
+        const QtAbstractPropertyManagerPrivate::JournalEntry &entry = d_ptr->journalEntry(i);
+        report.add(QtMemoryReport::Journal, type, entry.property, sizeof(entry));
+    }
+    for (auto it = d_ptr->m_journalValues.cbegin(); it != d_ptr->m_journalValues.cend(); ++it)
+        report.add(QtMemoryReport::Journal, type, it.key(),
+                    QtMemoryReport::hashNodeBytes<const QtProperty *, QVariant>());
+
+    const auto children = findChildren<QtAbstractPropertyManager *>(QString(), Qt::FindDirectChildrenOnly);
+    for (const QtAbstractPropertyManager *child : children)
+        report += child->memoryReport();
+    return report;
 }
 
 /*!
-    Returns the set of properties created by this manager.
+    Adds the memory the manager uses for the given \a property, beyond
+    the QtProperty object itself, to the \a report. Called by
+    memoryReport() for every property of the manager.
 
-    \sa addProperty()
+    The default implementation does nothing.
+
+    \sa memoryReport()
 */
-QSet<QtProperty *> QtAbstractPropertyManager::properties() const
+void QtAbstractPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
 {
-    return d_ptr->m_properties;
+    Q_UNUSED(property);
+    Q_UNUSED(report);
 }
 
 /*!
@@ -724,6 +1540,11 @@ QtProperty *QtAbstractPropertyManager::addProperty(const QString &name)
         property->setPropertyName(name);
         d_ptr->m_properties.insert(property);
         initializeProperty(property);
+        if (d_ptr->m_journalEnabled) {
+            const QVariant value = journalValue(property);
+            if (value.isValid())
+                d_ptr->m_journalValues.insert(property, value);
+        }
     }
     return property;
 }
@@ -742,6 +1563,51 @@ QtProperty *QtAbstractPropertyManager::createProperty()
     return new QtProperty(this);
 }
 
+/*!
+    Returns whether the subproperties of the given \a property are
+    created on demand.
+
+    The default implementation of this function returns false.
+    Managers that return true create the subproperties in
+    createDeferredSubProperties() and destroy them in
+    destroyDeferredSubProperties().
+
+    \sa QtProperty::hasDeferredSubProperties()
+*/
+bool QtAbstractPropertyManager::hasDeferredSubProperties(const QtProperty *property) const
+{
+    Q_UNUSED(property);
+    return false;
+}
+
+/*!
+    This function is called when the first request for the subproperties
+    of the given \a property is made.
+
+    The default implementation of this function does nothing.
+
+    \sa QtProperty::requestSubProperties(), destroyDeferredSubProperties()
+*/
+void QtAbstractPropertyManager::createDeferredSubProperties(QtProperty *property)
+{
+    Q_UNUSED(property);
+}
+
+/*!
+    This function is called when the last request for the subproperties
+    of the given \a property has been released. It may also be called for
+    a property which is being uninitialized, in which case it must do
+    nothing.
+
+    The default implementation of this function does nothing.
+
+    \sa QtProperty::releaseSubProperties(), createDeferredSubProperties()
+*/
+void QtAbstractPropertyManager::destroyDeferredSubProperties(QtProperty *property)
+{
+    Q_UNUSED(property);
+}
+
 /*!
     \fn void QtAbstractPropertyManager::initializeProperty(QtProperty *property) = 0
 
@@ -835,6 +1701,238 @@ void QtAbstractPropertyManager::uninitializeProperty(QtProperty *property)
     \sa QtAbstractEditorFactory::createEditor()
 */
 
+/*!
+    Paints the resting state of the editor that would be created for
+    the given \a property, using the given \a painter and the item view
+    \a option describing the value cell. Returns true if the editor was
+    painted; the default implementation paints nothing and returns false.
+
+    This allows a property browser to show what an editor looks like
+    without instantiating any widget; the real editor is only created
+    once the user starts editing.
+
+    This function is reimplemented in QtAbstractEditorFactory template class
+    which also provides a convenience overload of this function enabling
+    access to the property's manager.
+
+    \sa createEditor(), QtAbstractEditorFactory::paintEditor()
+*/
+bool QtAbstractEditorFactoryBase::paintEditor(QtProperty *property, QPainter *painter,
+            const QStyleOptionViewItem &option)
+{
+    Q_UNUSED(property);
+    Q_UNUSED(painter);
+    Q_UNUSED(option);
+    return false;
+}
+
+/*!
+    \enum QtAbstractEditorFactoryBase::CommitPolicy
+
+    This enum describes when the values edited in the editors of a
+    factory are written to the property manager.
+
+    \value CommitImmediately Every change made in the editor is set on
+    the property right away.
+    \value CommitOnEditingFinished Intermediate values are only shown
+    in the editor; the value is set once the user finishes editing,
+    e.g. by pressing Return, leaving the editor or releasing a slider.
+    \value CommitDebounced The value is set once the editor has not
+    changed for commitDelay() milliseconds, or when editing finishes.
+
+    The policy only affects editors reporting intermediate values, i.e.
+    the line edit, spin box, slider and scroll bar factories.
+
+    \sa setCommitPolicy(), setCommitDelay()
+*/
+
+/*!
+    Returns the factory wide commit policy. The default is
+    CommitImmediately.
+
+    \sa setCommitPolicy()
+*/
+QtAbstractEditorFactoryBase::CommitPolicy QtAbstractEditorFactoryBase::commitPolicy() const
+{
+    return m_commitPolicy;
+}
+
+/*!
+    Sets the factory wide commit \a policy, used for all properties
+    without a policy of their own.
+
+    \sa commitPolicy(), unsetCommitPolicy()
+*/
+void QtAbstractEditorFactoryBase::setCommitPolicy(CommitPolicy policy)
+{
+    if (m_commitPolicy == policy)
+        return;
+    m_commitPolicy = policy;
+    commitPolicyChanged(0);
+}
+
+/*!
+    \overload
+
+    Returns the commit policy in effect for the given \a property.
+*/
+QtAbstractEditorFactoryBase::CommitPolicy QtAbstractEditorFactoryBase::commitPolicy(const QtProperty *property) const
+{
+    return m_propertyCommitPolicies.value(property, m_commitPolicy);
+}
+
+/*!
+    Returns true if the given \a property has a commit policy
+    overriding the factory wide one.
+*/
+bool QtAbstractEditorFactoryBase::hasCommitPolicy(const QtProperty *property) const
+{
+    return m_propertyCommitPolicies.contains(property);
+}
+
+/*!
+    \overload
+
+    Overrides the commit policy for the given \a property with \a
+    policy. The override is dropped when the property is destroyed.
+
+    \sa unsetCommitPolicy()
+*/
+void QtAbstractEditorFactoryBase::setCommitPolicy(const QtProperty *property, CommitPolicy policy)
+{
+    if (!property)
+        return;
+    const QMap<const QtProperty *, CommitPolicy>::const_iterator it = m_propertyCommitPolicies.constFind(property);
+    if (it != m_propertyCommitPolicies.constEnd() && it.value() == policy)
+        return;
+    m_propertyCommitPolicies[property] = policy;
+    commitPolicyChanged(property);
+}
+
+/*!
+    Removes the commit policy override of the given \a property, so
+    that it uses the factory wide policy again.
+*/
+void QtAbstractEditorFactoryBase::unsetCommitPolicy(const QtProperty *property)
+{
+    if (m_propertyCommitPolicies.remove(property))
+        commitPolicyChanged(property);
+}
+
+/*!
+    Returns the delay, in milliseconds, after which a debounced edit is
+    committed. The default is 300.
+
+    \sa setCommitDelay(), CommitDebounced
+*/
+int QtAbstractEditorFactoryBase::commitDelay() const
+{
+    return m_commitDelay;
+}
+
+/*!
+    Sets the delay after which a debounced edit is committed to \a msec
+    milliseconds.
+*/
+void QtAbstractEditorFactoryBase::setCommitDelay(int msec)
+{
+    msec = qMax(0, msec);
+    if (m_commitDelay == msec)
+        return;
+    m_commitDelay = msec;
+    commitPolicyChanged(0);
+}
+
+/*!
+    This virtual function is called whenever the commit policy of the
+    given \a property changes, or with a null \a property when the
+    factory wide policy or the commit delay change.
+
+    The default implementation does nothing; factories delegating to
+    other factories reimplement it to pass the policy on.
+*/
+void QtAbstractEditorFactoryBase::commitPolicyChanged(const QtProperty *property)
+{
+    Q_UNUSED(property);
+}
+
+/*!
+    \internal
+
+    Drops the commit policy override of the destroyed \a property.
+*/
+void QtAbstractEditorFactoryBase::commitPolicyPropertyDestroyed(QtProperty *property)
+{
+    m_propertyCommitPolicies.remove(property);
+}
+
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+// Kept outside the class, whose layout must not depend on the define
+// because QtAbstractEditorFactory is compiled in client code.
+typedef QHash<const QtAbstractEditorFactoryBase *, QtPropertyBrowserCounters> FactoryCounterMap;
+Q_GLOBAL_STATIC(FactoryCounterMap, factoryCounters)
+
+/*!
+    Returns a snapshot of the factory's instrumentation counters: the
+    number of editors created and destroyed.
+
+    Only available when the library is built with
+    QT_PROPERTYBROWSER_INSTRUMENTATION defined.
+
+    \sa resetCounters()
+*/
+QtPropertyBrowserCounters QtAbstractEditorFactoryBase::counters() const
+{
+    return factoryCounters()->value(this);
+}
+
+/*!
+    Sets all instrumentation counters of the factory to zero.
+
+    \sa counters()
+*/
+void QtAbstractEditorFactoryBase::resetCounters()
+{
+    factoryCounters()->remove(this);
+}
+
+/*!
+    \internal
+*/
+void QtAbstractEditorFactoryBase::instrumentedEditorDestroyed()
+{
+    ++(*factoryCounters())[this].editorsDestroyed;
+}
+#endif
+
+/*!
+    Destroys the factory.
+*/
+QtAbstractEditorFactoryBase::~QtAbstractEditorFactoryBase()
+{
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    if (!factoryCounters.isDestroyed())
+        factoryCounters()->remove(this);
+#endif
+}
+
+/*!
+    \internal
+
+    Counts the given \a editor as created, and its destruction once it
+    happens. Does nothing unless the library is built with
+    QT_PROPERTYBROWSER_INSTRUMENTATION defined.
+*/
+void QtAbstractEditorFactoryBase::instrumentEditor(QWidget *editor)
+{
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    ++(*factoryCounters())[this].editorsCreated;
+    connect(editor, SIGNAL(destroyed()), this, SLOT(instrumentedEditorDestroyed()));
+#else
+    Q_UNUSED(editor);
+#endif
+}
+
 /*!
     \fn QtAbstractEditorFactoryBase::QtAbstractEditorFactoryBase(QObject *parent = 0)
 
@@ -1156,6 +2254,7 @@ Q_GLOBAL_STATIC(Map1, m_viewToManagerToFactory)
 Q_GLOBAL_STATIC(Map2, m_managerToFactoryToViews)
 
 QtAbstractPropertyBrowserPrivate::QtAbstractPropertyBrowserPrivate() :
+   m_subPropertiesDeferred(false),
    m_currentItem(0)
 {
 }
@@ -1264,7 +2363,16 @@ void QtAbstractPropertyBrowserPrivate::createBrowserIndexes(QtProperty *property
 QtBrowserItem *QtAbstractPropertyBrowserPrivate::createBrowserIndex(QtProperty *property,
         QtBrowserItem *parentIndex, QtBrowserItem *afterIndex)
 {
+    // Request deferred children before the index is registered, so that the
+    // insertions they trigger are only mirrored into the property's existing
+    // indexes; the loop below creates the children of the new one.
+    const bool requestSubProperties = !m_subPropertiesDeferred && property->hasDeferredSubProperties();
+    if (requestSubProperties)
+        property->requestSubProperties();
+
     QtBrowserItem *newIndex = new QtBrowserItem(q_ptr, property, parentIndex);
+    if (requestSubProperties)
+        m_subPropertyRequests.insert(newIndex);
     if (parentIndex) {
         parentIndex->d_ptr->addChild(newIndex, afterIndex);
     } else {
@@ -1273,6 +2381,9 @@ QtBrowserItem *QtAbstractPropertyBrowserPrivate::createBrowserIndex(QtProperty *
     }
     m_propertyToIndexes[property].append(newIndex);
 
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    ++m_counters.itemsInserted;
+#endif
     q_ptr->itemInserted(newIndex, afterIndex);
 
     const auto subItems = property->subProperties();
@@ -1306,6 +2417,9 @@ void QtAbstractPropertyBrowserPrivate::removeBrowserIndex(QtBrowserItem *index)
         removeBrowserIndex(children.at(i - 1));
     }
 
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    ++m_counters.itemsRemoved;
+#endif
     q_ptr->itemRemoved(index);
 
     if (index->parent()) {
@@ -1322,6 +2436,9 @@ void QtAbstractPropertyBrowserPrivate::removeBrowserIndex(QtBrowserItem *index)
         m_propertyToIndexes.remove(property);
 
     delete index;
+
+    if (m_subPropertyRequests.remove(index))
+        property->releaseSubProperties();
 }
 
 void QtAbstractPropertyBrowserPrivate::clearIndex(QtBrowserItem *index)
@@ -1329,7 +2446,10 @@ void QtAbstractPropertyBrowserPrivate::clearIndex(QtBrowserItem *index)
     const auto children = index->children();
     for (QtBrowserItem *item : children)
         clearIndex(item);
+    QtProperty *property = index->property();
     delete index;
+    if (m_subPropertyRequests.remove(index))
+        property->releaseSubProperties();
 }
 
 void QtAbstractPropertyBrowserPrivate::slotPropertyInserted(QtProperty *property,
@@ -1359,6 +2479,43 @@ void QtAbstractPropertyBrowserPrivate::slotPropertyDestroyed(QtProperty *propert
     q_ptr->removeProperty(property);
 }
 
+void QtAbstractPropertyBrowserPrivate::reportMemory(QtMemoryReport *report) const
+{
+    const qint64 itemBytes = sizeof(QtBrowserItem) + sizeof(QtBrowserItemPrivate);
+    for (auto it = m_propertyToIndexes.cbegin(); it != m_propertyToIndexes.cend(); ++it) {
+        const QtProperty *property = it.key();
+        for (const QtBrowserItem *item : it.value()) {
+            report->add(QtMemoryReport::BrowserItems, QString(), property,
+                        itemBytes + QtMemoryReport::listBytes(item->children()));
+        }
+        report->add(QtMemoryReport::MapNodes, QString(), property,
+                    QtMemoryReport::mapNodeBytes<QtProperty *, QList<QtBrowserItem *> >()
+                    + QtMemoryReport::listBytes(it.value()));
+    }
+    for (auto it = m_propertyToParents.cbegin(); it != m_propertyToParents.cend(); ++it) {
+        report->add(QtMemoryReport::MapNodes, QString(), it.key(),
+                    QtMemoryReport::mapNodeBytes<QtProperty *, QList<QtProperty *> >()
+                    + QtMemoryReport::listBytes(it.value()));
+    }
+
+    const auto widgets = q_ptr->findChildren<QWidget *>();
+    for (const QWidget *widget : widgets)
+        report->add(QtMemoryReport::Widgets, QString(), 0, QtMemoryReport::widgetBytes(widget));
+
+    // Managers that are children of another listed manager are part of
+    // that manager's report.
+    QSet<QtAbstractPropertyManager *> managers;
+    for (auto it = m_managerToProperties.cbegin(); it != m_managerToProperties.cend(); ++it)
+        managers.insert(it.key());
+    for (QtAbstractPropertyManager *manager : qAsConst(managers)) {
+        bool nested = false;
+        for (QObject *parent = manager->parent(); parent && !nested; parent = parent->parent())
+            nested = managers.contains(qobject_cast<QtAbstractPropertyManager *>(parent));
+        if (!nested)
+            *report += manager->memoryReport();
+    }
+}
+
 void QtAbstractPropertyBrowserPrivate::slotPropertyDataChanged(QtProperty *property)
 {
     if (!m_propertyToParents.contains(property))
@@ -1369,6 +2526,9 @@ void QtAbstractPropertyBrowserPrivate::slotPropertyDataChanged(QtProperty *prope
         return;
 
     const auto indexes = it.value();
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    m_counters.repaintRequests += indexes.size();
+#endif
     for (QtBrowserItem *idx : indexes)
         q_ptr->itemChanged(idx);
     //q_ptr->propertyChanged(property);
@@ -1569,6 +2729,11 @@ QtAbstractPropertyBrowser::QtAbstractPropertyBrowser(QWidget *parent)
 */
 QtAbstractPropertyBrowser::~QtAbstractPropertyBrowser()
 {
+    // Releasing deferred subproperties below makes the managers emit
+    // signals which must not reach this partially destroyed browser.
+    for (auto it = d_ptr->m_managerToProperties.cbegin(), end = d_ptr->m_managerToProperties.cend(); it != end; ++it)
+        disconnect(it.key(), 0, this, 0);
+
     const auto indexes = topLevelItems();
     for (QtBrowserItem *item : indexes)
         d_ptr->clearIndex(item);
@@ -1739,6 +2904,67 @@ void QtAbstractPropertyBrowser::removeProperty(QtProperty *property)
     }
 }
 
+/*!
+    Returns whether this browser defers the creation of subproperties
+    until they are requested with setSubPropertiesRequested().
+
+    \sa setSubPropertiesDeferred()
+*/
+bool QtAbstractPropertyBrowser::subPropertiesDeferred() const
+{
+    return d_ptr->m_subPropertiesDeferred;
+}
+
+/*!
+    Sets whether this browser defers the creation of subproperties to \a deferred.
+
+    By default the browser requests the subproperties of every inserted
+    property whose manager creates them on demand. Browsers which can
+    hide subproperties (e.g. by collapsing an item) can pass true and
+    call setSubPropertiesRequested() when the item is shown expanded.
+    This function should be called before any property is inserted.
+
+    \sa QtProperty::hasDeferredSubProperties()
+*/
+void QtAbstractPropertyBrowser::setSubPropertiesDeferred(bool deferred)
+{
+    d_ptr->m_subPropertiesDeferred = deferred;
+}
+
+/*!
+    Returns whether this browser holds a request for the subproperties
+    of the given \a item's property.
+
+    \sa setSubPropertiesRequested()
+*/
+bool QtAbstractPropertyBrowser::subPropertiesRequested(QtBrowserItem *item) const
+{
+    return d_ptr->m_subPropertyRequests.contains(item);
+}
+
+/*!
+    Requests or releases, depending on \a requested, the deferred
+    subproperties of the given \a item's property. The children of \a item
+    are inserted or removed through the usual itemInserted() and
+    itemRemoved() calls. The request is released automatically when the
+    \a item is removed.
+
+    \sa setSubPropertiesDeferred(), QtProperty::requestSubProperties()
+*/
+void QtAbstractPropertyBrowser::setSubPropertiesRequested(QtBrowserItem *item, bool requested)
+{
+    if (!item || d_ptr->m_subPropertyRequests.contains(item) == requested)
+        return;
+    QtProperty *property = item->property();
+    if (requested) {
+        d_ptr->m_subPropertyRequests.insert(item);
+        property->requestSubProperties();
+    } else {
+        d_ptr->m_subPropertyRequests.remove(item);
+        property->releaseSubProperties();
+    }
+}
+
 /*!
     Creates an editing widget (with the given \a parent) for the given
     \a property according to the previously established associations
@@ -1780,6 +3006,46 @@ QWidget *QtAbstractPropertyBrowser::createEditor(QtProperty *property,
     return w;
 }
 
+/*!
+    Paints the resting state of the editor for the given \a property with
+    \a painter into the value cell described by \a option, using the
+    factory associated with the property's manager. Returns false if
+    there is no such factory or if it does not support painting.
+
+    \sa createEditor(), QtAbstractEditorFactoryBase::paintEditor()
+*/
+bool QtAbstractPropertyBrowser::paintEditor(QtProperty *property, QPainter *painter,
+            const QStyleOptionViewItem &option)
+{
+    const auto views = m_viewToManagerToFactory();
+    const auto it = views->constFind(this);
+    if (it == views->constEnd())
+        return false;
+
+    QtAbstractEditorFactoryBase *factory = it.value().value(property->propertyManager(), 0);
+    return factory ? factory->paintEditor(property, painter, option) : false;
+}
+
+/*!
+    \reimp
+
+    On a language change the value texts of all managers used by this
+    browser are invalidated and the items are updated, so that
+    translated value texts follow the installed translators.
+*/
+void QtAbstractPropertyBrowser::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        for (auto it = d_ptr->m_managerToProperties.cbegin(), end = d_ptr->m_managerToProperties.cend(); it != end; ++it)
+            it.key()->invalidateValueCache();
+        for (auto it = d_ptr->m_propertyToIndexes.cbegin(), end = d_ptr->m_propertyToIndexes.cend(); it != end; ++it) {
+            for (QtBrowserItem *item : it.value())
+                itemChanged(item);
+        }
+    }
+    QWidget::changeEvent(event);
+}
+
 bool QtAbstractPropertyBrowser::addFactory(QtAbstractPropertyManager *abstractManager,
             QtAbstractEditorFactoryBase *abstractFactory)
 {
@@ -1857,6 +3123,50 @@ void QtAbstractPropertyBrowser::setCurrentItem(QtBrowserItem *item)
         emit  currentItemChanged(item);
 }
 
+/*!
+    Returns an estimate of the memory used by the browser and the
+    properties it shows: the browser items, the browser's bookkeeping
+    of the properties, its child widgets including open editors, and
+    the memory reports of the managers of the properties.
+
+    Subclasses add the memory of their own per item structures.
+
+    \sa QtAbstractPropertyManager::memoryReport()
+*/
+QtMemoryReport QtAbstractPropertyBrowser::memoryReport() const
+{
+    QtMemoryReport report;
+    d_ptr->reportMemory(&report);
+    return report;
+}
+
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+/*!
+    Returns a snapshot of the browser's instrumentation counters: the
+    number of items inserted and removed, and the number of item
+    updates requested because a property changed.
+
+    Only available when the library is built with
+    QT_PROPERTYBROWSER_INSTRUMENTATION defined.
+
+    \sa resetCounters(), QtAbstractPropertyManager::counters()
+*/
+QtPropertyBrowserCounters QtAbstractPropertyBrowser::counters() const
+{
+    return d_ptr->m_counters;
+}
+
+/*!
+    Sets all instrumentation counters of the browser to zero.
+
+    \sa counters()
+*/
+void QtAbstractPropertyBrowser::resetCounters()
+{
+    d_ptr->m_counters = QtPropertyBrowserCounters();
+}
+#endif
+
 QT_END_NAMESPACE
 
 //#include "moc_qtpropertybrowser.cpp"
@@ -41,20 +41,94 @@
 #define QTPROPERTYBROWSER_H
 
 #include <QtWidgets/QWidget>
+#include <QtCore/QAtomicInt>
 #include <QtCore/QSet>
 #include <QtCore/QMap>
+#include <QtCore/QHash>
+#include <QtCore/QVariant>
+#include <QtCore/QElapsedTimer>
 #include <QtGui/QIcon>
+#include <utility>
 
 QT_BEGIN_NAMESPACE
 
 class QtProperty;
 class QtAbstractPropertyManager;
 class QtAbstractPropertyBrowser;
+class QPainter;
+class QStyleOptionViewItem;
+class QDebug;
+
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+struct QtPropertyBrowserCounters
+{
+    // Property managers
+    qint64 setValueCalls{0};
+    qint64 signalsEmitted{0};
+    qint64 valueTextCalls{0};
+    qint64 valueTextNSecs{0};
+    qint64 valueIconCalls{0};
+    qint64 valueIconNSecs{0};
+    // Editor factories
+    qint64 editorsCreated{0};
+    qint64 editorsDestroyed{0};
+    // Property browsers
+    qint64 itemsInserted{0};
+    qint64 itemsRemoved{0};
+    qint64 repaintRequests{0};
+};
+#  define QT_PROPERTYBROWSER_COUNT(counter) (++instrumentationCounters().counter)
+#else
+#  define QT_PROPERTYBROWSER_COUNT(counter) do { } while (false)
+#endif
+
+struct QtMemoryReport
+{
+    enum Category
+    {
+        Properties,
+        ManagerData,
+        MapNodes,
+        Journal,
+        BrowserItems,
+        TreeWidgetItems,
+        Widgets,
+        CategoryCount
+    };
+
+    qint64 categories[CategoryCount]{};
+    QMap<QString, qint64> managerTypes;
+    QHash<const QtProperty *, qint64> properties;
+
+    void add(Category category, const QString &managerType, const QtProperty *property, qint64 bytes);
+    qint64 totalBytes() const;
+    QtMemoryReport &operator+=(const QtMemoryReport &other);
+
+    static QString categoryName(Category category);
+
+    // Estimates of the heap memory used by common building blocks.
+    static qint64 stringBytes(const QString &string);
+    static qint64 widgetBytes(const QWidget *widget);
+    template <class T>
+    static qint64 listBytes(const QList<T> &list)
+    { return list.capacity() ? qint64(sizeof(QArrayData)) + list.capacity() * qint64(sizeof(T)) : 0; }
+    template <class Key, class T>
+    static constexpr qint64 mapNodeBytes()
+    { return 4 * sizeof(void *) + sizeof(std::pair<const Key, T>); }
+    template <class Key, class T>
+    static constexpr qint64 hashNodeBytes()
+    { return sizeof(Key) + sizeof(T) + 2; }
+};
+
+#ifndef QT_NO_DEBUG_STREAM
+QDebug operator<<(QDebug debug, const QtMemoryReport &report);
+#endif
 
 class QtPropertyPrivate
 {
 public:
-    QtPropertyPrivate(QtAbstractPropertyManager* manager) : m_enabled(true), m_modified(false), m_manager(manager) {}
+    QtPropertyPrivate(QtAbstractPropertyManager* manager) : m_enabled(true), m_modified(false), m_subPropertyRequests(0),
+        m_valueTextCached(false), m_valueIconCached(false), m_manager(manager) {}
     QtProperty* q_ptr;
 
     QSet<QtProperty*> m_parentItems;
@@ -67,6 +141,12 @@ public:
     QString m_name;
     bool m_enabled;
     bool m_modified;
+    int m_subPropertyRequests;
+
+    QString m_valueText;
+    QIcon m_valueIcon;
+    bool m_valueTextCached;
+    bool m_valueIconCached;
 
     QtAbstractPropertyManager* const m_manager;
 };
@@ -104,6 +184,10 @@ public:
     void addSubProperty(QtProperty *property);
     void insertSubProperty(QtProperty *property, QtProperty *afterProperty);
     void removeSubProperty(QtProperty *property);
+
+    bool hasDeferredSubProperties() const;
+    void requestSubProperties();
+    void releaseSubProperties();
 protected:
     explicit QtProperty(QtAbstractPropertyManager *manager);
     void propertyChanged();
@@ -123,8 +207,56 @@ public:
         QtProperty* parentProperty) const;
     void propertyInserted(QtProperty* property, QtProperty* parentProperty,
         QtProperty* afterProperty) const;
+    void slotPropertyChanged(QtProperty* property);
+
+    struct JournalEntry
+    {
+        QtProperty* property;
+        QVariant before;
+        QVariant after;
+        int group;
+        qint64 time;
+    };
+
+    void recordChange(QtProperty* property);
+    void applyJournal(bool undo);
+    void removeFromJournal(QtProperty* property);
+    void trimJournal();
+
+    // The entries live in a ring buffer: m_journalCount entries starting
+    // at m_journalHead in m_journal, wrapping around its end.
+    JournalEntry& journalEntry(qsizetype index);
+    const JournalEntry& journalEntry(qsizetype index) const;
+    bool startsJournalStep(qsizetype index) const;
+    void appendJournalEntry(const JournalEntry& entry);
+    void truncateJournal(qsizetype count);
+    void clearJournalEntries();
 
     QSet<QtProperty*> m_properties;
+    bool m_valueCacheEnabled{true};
+    // Advanced whenever the value cache of a whole manager is invalidated,
+    // e.g. on a language change, so that translated value text templates
+    // are resolved again.
+    static QAtomicInt valueTextGeneration;
+
+    bool m_journalEnabled{false};
+    bool m_applyingJournal{false};
+    int m_journalCapacity{100};
+    int m_journalMergeInterval{500};
+    int m_journalGroupDepth{0};
+    int m_journalGroup{0};
+    int m_nextJournalGroup{0};
+    int m_mergeGroup{-1};
+    qsizetype m_journalPosition{0};
+    qsizetype m_journalHead{0};
+    qsizetype m_journalCount{0};
+    int m_journalSteps{0};
+    QList<JournalEntry> m_journal;
+    QHash<const QtProperty*, QVariant> m_journalValues;
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters m_counters;
+#endif
+    QElapsedTimer m_journalClock;
 };
 class QtAbstractPropertyManager : public QObject
 {
@@ -138,6 +270,31 @@ public:
     void clear() const;
 
     QtProperty *addProperty(const QString &name = QString());
+
+    bool isValueCacheEnabled() const;
+    void setValueCacheEnabled(bool enable);
+    void invalidateValueCache(QtProperty *property = 0);
+
+    bool isJournalEnabled() const;
+    void setJournalEnabled(bool enable);
+    int journalCapacity() const;
+    void setJournalCapacity(int steps);
+    int journalMergeInterval() const;
+    void setJournalMergeInterval(int msec);
+    bool canUndo() const;
+    bool canRedo() const;
+    void beginJournalGroup();
+    void endJournalGroup();
+    void clearJournal();
+
+    virtual QtMemoryReport memoryReport() const;
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters counters() const;
+    void resetCounters();
+#endif
+public Q_SLOTS:
+    void undo();
+    void redo();
 Q_SIGNALS:
 
     void propertyInserted(QtProperty *property,
@@ -145,6 +302,7 @@ Q_SIGNALS:
     void propertyChanged(QtProperty *property);
     void propertyRemoved(QtProperty *property, QtProperty *parent);
     void propertyDestroyed(QtProperty *property);
+    void journalChanged();
 protected:
     virtual bool hasValue(const QtProperty *property) const;
     virtual QIcon valueIcon(const QtProperty *property) const;
@@ -152,25 +310,70 @@ protected:
     virtual void initializeProperty(QtProperty *property) = 0;
     virtual void uninitializeProperty(QtProperty *property);
     virtual QtProperty *createProperty();
+    virtual bool hasDeferredSubProperties(const QtProperty *property) const;
+    virtual void createDeferredSubProperties(QtProperty *property);
+    virtual void destroyDeferredSubProperties(QtProperty *property);
+    virtual QVariant journalValue(const QtProperty *property) const;
+    virtual void setJournalValue(QtProperty *property, const QVariant &value);
+    virtual void setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values);
+    virtual void reportMemory(const QtProperty *property, QtMemoryReport *report) const;
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters &instrumentationCounters() const;
+#endif
 private:
     friend class QtProperty;
     QScopedPointer<QtAbstractPropertyManagerPrivate> d_ptr;
     Q_DECLARE_PRIVATE(QtAbstractPropertyManager)
     Q_DISABLE_COPY_MOVE(QtAbstractPropertyManager)
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *))
 };
 
 class QtAbstractEditorFactoryBase : public QObject
 {
     Q_OBJECT
 public:
+    enum CommitPolicy
+    {
+        CommitImmediately,
+        CommitOnEditingFinished,
+        CommitDebounced
+    };
+    Q_ENUM(CommitPolicy)
+
     virtual QWidget *createEditor(QtProperty *property, QWidget *parent) = 0;
+    virtual bool paintEditor(QtProperty *property, QPainter *painter,
+                const QStyleOptionViewItem &option);
+
+    CommitPolicy commitPolicy() const;
+    void setCommitPolicy(CommitPolicy policy);
+    CommitPolicy commitPolicy(const QtProperty *property) const;
+    bool hasCommitPolicy(const QtProperty *property) const;
+    void setCommitPolicy(const QtProperty *property, CommitPolicy policy);
+    void unsetCommitPolicy(const QtProperty *property);
+    int commitDelay() const;
+    void setCommitDelay(int msec);
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters counters() const;
+    void resetCounters();
+#endif
 protected:
     explicit QtAbstractEditorFactoryBase(QObject *parent = 0)
         : QObject(parent) {}
+    ~QtAbstractEditorFactoryBase();
 
     virtual void breakConnection(QtAbstractPropertyManager *manager) = 0;
+    virtual void commitPolicyChanged(const QtProperty *property);
+    void instrumentEditor(QWidget *editor);
 protected Q_SLOTS:
     virtual void managerDestroyed(QObject *manager) = 0;
+    void commitPolicyPropertyDestroyed(QtProperty *property);
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    void instrumentedEditorDestroyed();
+#endif
+private:
+    CommitPolicy m_commitPolicy{ CommitImmediately };
+    int m_commitDelay{ 300 };
+    QMap<const QtProperty *, CommitPolicy> m_propertyCommitPolicies;
 
     friend class QtAbstractPropertyBrowser;
 };
@@ -184,11 +387,24 @@ public:
     {
         for (PropertyManager *manager : qAsConst(m_managers)) {
             if (manager == property->propertyManager()) {
-                return createEditor(manager, property, parent);
+                QWidget *editor = createEditor(manager, property, parent);
+                if (editor)
+                    instrumentEditor(editor);
+                return editor;
             }
         }
         return 0;
     }
+    bool paintEditor(QtProperty *property, QPainter *painter,
+                const QStyleOptionViewItem &option) override
+    {
+        for (PropertyManager *manager : qAsConst(m_managers)) {
+            if (manager == property->propertyManager()) {
+                return paintEditor(manager, property, painter, option);
+            }
+        }
+        return false;
+    }
     void addPropertyManager(PropertyManager *manager)
     {
         if (m_managers.contains(manager))
@@ -197,6 +413,8 @@ public:
         connectPropertyManager(manager);
         connect(manager, SIGNAL(destroyed(QObject *)),
                     this, SLOT(managerDestroyed(QObject *)));
+        connect(manager, SIGNAL(propertyDestroyed(QtProperty *)),
+                    this, SLOT(commitPolicyPropertyDestroyed(QtProperty *)));
     }
     void removePropertyManager(PropertyManager *manager)
     {
@@ -204,6 +422,8 @@ public:
             return;
         disconnect(manager, SIGNAL(destroyed(QObject *)),
                     this, SLOT(managerDestroyed(QObject *)));
+        disconnect(manager, SIGNAL(propertyDestroyed(QtProperty *)),
+                    this, SLOT(commitPolicyPropertyDestroyed(QtProperty *)));
         disconnectPropertyManager(manager);
         m_managers.remove(manager);
     }
@@ -225,6 +445,15 @@ protected:
     virtual void connectPropertyManager(PropertyManager *manager) = 0;
     virtual QWidget *createEditor(PropertyManager *manager, QtProperty *property,
                 QWidget *parent) = 0;
+    virtual bool paintEditor(PropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option)
+    {
+        Q_UNUSED(manager);
+        Q_UNUSED(property);
+        Q_UNUSED(painter);
+        Q_UNUSED(option);
+        return false;
+    }
     virtual void disconnectPropertyManager(PropertyManager *manager) = 0;
     void managerDestroyed(QObject *manager) override
     {
@@ -297,6 +526,7 @@ public:
     void removeSubTree(QtProperty* property,
         QtProperty* parentProperty);
     void createBrowserIndexes(QtProperty* property, QtProperty* parentProperty, QtProperty* afterProperty);
+    void reportMemory(QtMemoryReport* report) const;
     void removeBrowserIndexes(QtProperty* property, QtProperty* parentProperty);
     QtBrowserItem* createBrowserIndex(QtProperty* property, QtBrowserItem* parentIndex, QtBrowserItem* afterIndex);
     void removeBrowserIndex(QtBrowserItem* index);
@@ -316,7 +546,13 @@ public:
     QList<QtBrowserItem*> m_topLevelIndexes;
     QMap<QtProperty*, QList<QtBrowserItem*> > m_propertyToIndexes;
 
+    QSet<QtBrowserItem*> m_subPropertyRequests;
+    bool m_subPropertiesDeferred;
+
     QtBrowserItem* m_currentItem;
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters m_counters;
+#endif
 };
 class QtAbstractPropertyBrowser : public QWidget
 {
@@ -347,6 +583,13 @@ public:
     QtBrowserItem *currentItem() const;
     void setCurrentItem(QtBrowserItem *);
 
+    virtual QtMemoryReport memoryReport() const;
+
+#ifdef QT_PROPERTYBROWSER_INSTRUMENTATION
+    QtPropertyBrowserCounters counters() const;
+    void resetCounters();
+#endif
+
 Q_SIGNALS:
     void currentItemChanged(QtBrowserItem *);
 
@@ -364,6 +607,15 @@ protected:
     virtual void itemChanged(QtBrowserItem *item) = 0;
 
     virtual QWidget *createEditor(QtProperty *property, QWidget *parent);
+    virtual bool paintEditor(QtProperty *property, QPainter *painter,
+                const QStyleOptionViewItem &option);
+
+    void changeEvent(QEvent *event) override;
+
+    bool subPropertiesDeferred() const;
+    void setSubPropertiesDeferred(bool deferred);
+    bool subPropertiesRequested(QtBrowserItem *item) const;
+    void setSubPropertiesRequested(QtBrowserItem *item, bool requested);
 private:
 
     bool addFactory(QtAbstractPropertyManager *abstractManager,
@@ -0,0 +1,592 @@
+#include "qtpropertybrowserprofiler.h"
+#include <QtCore/QEvent>
+#include <QtGui/QPaintEvent>
+#include <QtGui/QPainter>
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+// Upper bounds, in milliseconds, of all but the last frame time bucket.
+static const int frameBucketBounds[QtPropertyBrowserProfilerPrivate::FrameBucketCount - 1] =
+    { 1, 2, 4, 8, 16, 33, 66 };
+
+static const int profilerMargin = 6;
+
+bool QtPropertyBrowserProfilerPrivate::isWatchable(const QWidget *widget) const
+{
+    return widget != q_ptr && !q_ptr->isAncestorOf(widget);
+}
+
+void QtPropertyBrowserProfilerPrivate::watchWidget(QWidget *widget)
+{
+    if (!isWatchable(widget))
+        return;
+    widget->installEventFilter(q_ptr);
+    const auto children = widget->findChildren<QWidget *>();
+    for (QWidget *child : children) {
+        if (isWatchable(child))
+            child->installEventFilter(q_ptr);
+    }
+}
+
+void QtPropertyBrowserProfilerPrivate::watchBrowser()
+{
+    if (!m_browser)
+        return;
+    watchWidget(m_browser);
+    m_window = m_browser->window();
+    m_window->installEventFilter(q_ptr);
+    watchManagers();
+}
+
+void QtPropertyBrowserProfilerPrivate::unwatchBrowser()
+{
+    if (m_window)
+        m_window->removeEventFilter(q_ptr);
+    if (m_browser) {
+        m_browser->removeEventFilter(q_ptr);
+        const auto children = m_browser->findChildren<QWidget *>();
+        for (QWidget *child : children)
+            child->removeEventFilter(q_ptr);
+    }
+    for (QtAbstractPropertyManager *manager : qAsConst(m_managers))
+        QObject::disconnect(manager, 0, q_ptr, 0);
+    m_managers.clear();
+    m_propertyUpdates.clear();
+    m_createdWidgets.clear();
+    m_window = 0;
+}
+
+void QtPropertyBrowserProfilerPrivate::watchManagers()
+{
+    if (!m_browser)
+        return;
+    const QList<QtProperty *> properties = m_browser->properties();
+    for (QtProperty *property : properties) {
+        QtAbstractPropertyManager *manager = property->propertyManager();
+        if (m_managers.contains(manager))
+            continue;
+        m_managers.insert(manager);
+        q_ptr->connect(manager, SIGNAL(propertyChanged(QtProperty*)),
+                    q_ptr, SLOT(slotPropertyChanged(QtProperty*)));
+        q_ptr->connect(manager, SIGNAL(propertyDestroyed(QtProperty*)),
+                    q_ptr, SLOT(slotPropertyDestroyed(QtProperty*)));
+        q_ptr->connect(manager, SIGNAL(destroyed(QObject*)),
+                    q_ptr, SLOT(slotManagerDestroyed(QObject*)));
+    }
+}
+
+void QtPropertyBrowserProfilerPrivate::beginFrame()
+{
+    // The window lays out and paints its dirty widgets while handling the
+    // update request, so the frame is timed from the request to the last
+    // browser paint. The call posted here only finalizes the frame, so
+    // events handled before it runs do not count.
+    m_inFrame = true;
+    m_framePainted = false;
+    m_frameStart = m_clock.nsecsElapsed();
+    QMetaObject::invokeMethod(q_ptr, [this]() { endFrame(); }, Qt::QueuedConnection);
+}
+
+void QtPropertyBrowserProfilerPrivate::endFrame()
+{
+    if (!m_inFrame)
+        return;
+    m_inFrame = false;
+    if (!m_framePainted)
+        return;
+
+    const qint64 msecs = (m_frameEnd - m_frameStart) / 1000000;
+    ++m_repaints;
+    const int *bucket = std::upper_bound(frameBucketBounds,
+                frameBucketBounds + FrameBucketCount - 1, int(qMin(msecs, qint64(1) << 30)));
+    ++m_frames[bucket - frameBucketBounds];
+}
+
+bool QtPropertyBrowserProfilerPrivate::isOverlayPaint(const QWidget *widget, const QPaintEvent *event) const
+{
+    // Repainting the translucent overlay repaints the browser beneath it.
+    // Paints covering nothing but the overlay are the profiler's own.
+    if (!m_overlay || !m_browser || q_ptr->parentWidget() != m_browser || !q_ptr->isVisible())
+        return false;
+    const QRect rect = event->region().boundingRect().translated(widget->mapTo(m_browser, QPoint(0, 0)));
+    return q_ptr->geometry().contains(rect);
+}
+
+void QtPropertyBrowserProfilerPrivate::updateOverlayGeometry()
+{
+    if (!m_browser)
+        return;
+    const QSize size = q_ptr->sizeHint().boundedTo(m_browser->size());
+    q_ptr->setGeometry(m_browser->width() - size.width() - profilerMargin, profilerMargin,
+                size.width(), size.height());
+}
+
+void QtPropertyBrowserProfilerPrivate::resetStatistics()
+{
+    m_lastSample = m_clock.nsecsElapsed();
+    m_updates = 0;
+    m_repaints = 0;
+    m_editorsCreated = 0;
+    m_editorsDestroyed = 0;
+    m_updateRate = 0;
+    m_repaintRate = 0;
+    m_editorCreateRate = 0;
+    m_editorDestroyRate = 0;
+    m_propertyUpdates.clear();
+    m_hotProperties.clear();
+    m_frames.fill(0);
+    m_frameHistory.clear();
+}
+
+void QtPropertyBrowserProfilerPrivate::slotSample()
+{
+    const qint64 now = m_clock.nsecsElapsed();
+    const double seconds = qMax(now - m_lastSample, qint64(1)) / 1e9;
+    m_lastSample = now;
+
+    m_updateRate = m_updates / seconds;
+    m_repaintRate = m_repaints / seconds;
+    m_editorCreateRate = m_editorsCreated / seconds;
+    m_editorDestroyRate = m_editorsDestroyed / seconds;
+    m_updates = 0;
+    m_repaints = 0;
+    m_editorsCreated = 0;
+    m_editorsDestroyed = 0;
+
+    // Only the properties shown by the browser compete for the top places.
+    QList<QPair<int, QtProperty *> > candidates;
+    candidates.reserve(m_propertyUpdates.size());
+    for (auto it = m_propertyUpdates.cbegin(); it != m_propertyUpdates.cend(); ++it)
+        candidates.append(qMakePair(it.value(), it.key()));
+    std::sort(candidates.begin(), candidates.end(),
+                [](const QPair<int, QtProperty *> &a, const QPair<int, QtProperty *> &b) {
+        return a.first > b.first;
+    });
+    m_hotProperties.clear();
+    for (const auto &candidate : qAsConst(candidates)) {
+        if (m_hotProperties.size() >= m_hotPropertyCount)
+            break;
+        if (m_browser && m_browser->items(candidate.second).isEmpty())
+            continue;
+        HotProperty hot;
+        hot.name = candidate.second->propertyName();
+        hot.updates = candidate.first;
+        m_hotProperties.append(hot);
+    }
+    m_propertyUpdates.clear();
+
+    m_frameHistory.append(m_frames);
+    if (m_frameHistory.size() > HistogramSampleCount)
+        m_frameHistory.removeFirst();
+    m_frames.fill(0);
+
+    watchManagers();
+    if (q_ptr->isVisible())
+        q_ptr->update();
+}
+
+void QtPropertyBrowserProfilerPrivate::slotPropertyChanged(QtProperty *property)
+{
+    ++m_updates;
+    ++m_propertyUpdates[property];
+}
+
+void QtPropertyBrowserProfilerPrivate::slotPropertyDestroyed(QtProperty *property)
+{
+    m_propertyUpdates.remove(property);
+}
+
+void QtPropertyBrowserProfilerPrivate::slotManagerDestroyed(QObject *manager)
+{
+    m_managers.remove(static_cast<QtAbstractPropertyManager *>(manager));
+}
+
+/*!
+    \class QtPropertyBrowserProfiler
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtPropertyBrowserProfiler class shows live performance
+    statistics of a property browser.
+
+    The profiler is attached to a browser with setBrowser(). It can be
+    placed in a layout or a dock widget like any other widget, or shown
+    on top of the browser by setting the overlay property.
+
+    Every sampleInterval() milliseconds it shows per second rates of
+    value updates reported by the managers of the browser's properties,
+    of repainted frames and of widgets created and destroyed inside the
+    browser, which are mostly editors. It also lists the
+    hotPropertyCount() properties shown by the browser that were
+    updated most often, and a histogram of the time from the window's
+    update request to the browser's last paint in that frame, over the
+    last ten samples. Repaints an overlay causes in the browser beneath it are
+    not counted.
+
+    Events are only counted as they pass, never consumed or delivered
+    again; all aggregation happens when sampling, so the cost of an
+    attached profiler stays small.
+
+    \sa QtAbstractPropertyBrowser
+*/
+
+/*!
+    Creates a profiler with the given \a parent.
+*/
+QtPropertyBrowserProfiler::QtPropertyBrowserProfiler(QWidget *parent)
+    : QWidget(parent), d_ptr(new QtPropertyBrowserProfilerPrivate)
+{
+    d_ptr->q_ptr = this;
+    d_ptr->m_clock.start();
+
+    d_ptr->m_sampleTimer = new QTimer(this);
+    d_ptr->m_sampleTimer->setInterval(1000);
+    connect(d_ptr->m_sampleTimer, SIGNAL(timeout()), this, SLOT(slotSample()));
+    d_ptr->m_sampleTimer->start();
+}
+
+/*!
+    Destroys the profiler.
+*/
+QtPropertyBrowserProfiler::~QtPropertyBrowserProfiler()
+{
+    d_ptr->unwatchBrowser();
+}
+
+/*!
+    Returns the profiled browser.
+
+    \sa setBrowser()
+*/
+QtAbstractPropertyBrowser *QtPropertyBrowserProfiler::browser() const
+{
+    return d_ptr->m_browser;
+}
+
+/*!
+    Starts profiling the given \a browser, and resets the statistics.
+    Passing 0 stops profiling.
+
+    \sa browser(), reset()
+*/
+void QtPropertyBrowserProfiler::setBrowser(QtAbstractPropertyBrowser *browser)
+{
+    Q_D(QtPropertyBrowserProfiler);
+    if (d->m_browser == browser)
+        return;
+
+    d->unwatchBrowser();
+    if (d->m_overlay && d->m_browser && parentWidget() == d->m_browser) {
+        hide();
+        setParent(0);
+    }
+    d->m_browser = browser;
+    d->resetStatistics();
+    if (d->m_overlay && browser) {
+        setParent(browser);
+        d->updateOverlayGeometry();
+        raise();
+        show();
+    }
+    d->watchBrowser();
+    update();
+}
+
+/*!
+    \property QtPropertyBrowserProfiler::sampleInterval
+    \brief the time between two samples in milliseconds
+
+    The default is 1000 milliseconds.
+*/
+int QtPropertyBrowserProfiler::sampleInterval() const
+{
+    return d_ptr->m_sampleTimer->interval();
+}
+
+void QtPropertyBrowserProfiler::setSampleInterval(int msec)
+{
+    d_ptr->m_sampleTimer->setInterval(qMax(100, msec));
+}
+
+/*!
+    \property QtPropertyBrowserProfiler::hotPropertyCount
+    \brief the number of most frequently updated properties listed
+
+    The default is 5.
+*/
+int QtPropertyBrowserProfiler::hotPropertyCount() const
+{
+    return d_ptr->m_hotPropertyCount;
+}
+
+void QtPropertyBrowserProfiler::setHotPropertyCount(int count)
+{
+    Q_D(QtPropertyBrowserProfiler);
+    count = qMax(0, count);
+    if (d->m_hotPropertyCount == count)
+        return;
+    d->m_hotPropertyCount = count;
+    updateGeometry();
+    if (d->m_overlay)
+        d->updateOverlayGeometry();
+    update();
+}
+
+/*!
+    \property QtPropertyBrowserProfiler::overlay
+    \brief whether the profiler is shown on top of the browser
+
+    An overlay is made a child of the browser, placed in its top right
+    corner and lets mouse events pass through. Turning the overlay off
+    hides the profiler and detaches it from the browser, so that it can
+    be placed elsewhere.
+
+    The default is false.
+*/
+bool QtPropertyBrowserProfiler::isOverlay() const
+{
+    return d_ptr->m_overlay;
+}
+
+void QtPropertyBrowserProfiler::setOverlay(bool overlay)
+{
+    Q_D(QtPropertyBrowserProfiler);
+    if (d->m_overlay == overlay)
+        return;
+
+    d->m_overlay = overlay;
+    setAttribute(Qt::WA_TransparentForMouseEvents, overlay);
+    if (!d->m_browser)
+        return;
+
+    if (overlay) {
+        setParent(d->m_browser);
+        d->updateOverlayGeometry();
+        raise();
+        show();
+    } else if (parentWidget() == d->m_browser) {
+        hide();
+        setParent(0);
+    }
+}
+
+/*!
+    Returns the number of value updates per second in the last sample.
+*/
+double QtPropertyBrowserProfiler::updateRate() const
+{
+    return d_ptr->m_updateRate;
+}
+
+/*!
+    Returns the number of repainted frames per second in the last
+    sample.
+*/
+double QtPropertyBrowserProfiler::repaintRate() const
+{
+    return d_ptr->m_repaintRate;
+}
+
+/*!
+    Returns the number of widgets created per second inside the browser
+    in the last sample.
+
+    \sa editorDestructionRate()
+*/
+double QtPropertyBrowserProfiler::editorCreationRate() const
+{
+    return d_ptr->m_editorCreateRate;
+}
+
+/*!
+    Returns the number of widgets destroyed per second inside the
+    browser in the last sample.
+
+    \sa editorCreationRate()
+*/
+double QtPropertyBrowserProfiler::editorDestructionRate() const
+{
+    return d_ptr->m_editorDestroyRate;
+}
+
+/*!
+    Returns the names and update counts of the most frequently updated
+    properties in the last sample, most frequent first.
+
+    \sa hotPropertyCount
+*/
+QList<QPair<QString, int> > QtPropertyBrowserProfiler::hotProperties() const
+{
+    QList<QPair<QString, int> > hot;
+    for (const QtPropertyBrowserProfilerPrivate::HotProperty &property : qAsConst(d_ptr->m_hotProperties))
+        hot.append(qMakePair(property.name, property.updates));
+    return hot;
+}
+
+/*!
+    Returns the number of frames in each frame time bucket over the
+    last ten samples.
+
+    \sa frameTimeBuckets()
+*/
+QList<int> QtPropertyBrowserProfiler::frameTimeHistogram() const
+{
+    QList<int> histogram(QtPropertyBrowserProfilerPrivate::FrameBucketCount, 0);
+    for (const QtPropertyBrowserProfilerPrivate::FrameHistogram &frames : qAsConst(d_ptr->m_frameHistory)) {
+        for (int i = 0; i < QtPropertyBrowserProfilerPrivate::FrameBucketCount; ++i)
+            histogram[i] += frames[i];
+    }
+    return histogram;
+}
+
+/*!
+    Returns the exclusive upper bounds in milliseconds of the frame
+    time buckets. The last bucket, which has no upper bound, is not
+    included.
+
+    \sa frameTimeHistogram()
+*/
+QList<int> QtPropertyBrowserProfiler::frameTimeBuckets()
+{
+    return QList<int>(frameBucketBounds,
+                frameBucketBounds + QtPropertyBrowserProfilerPrivate::FrameBucketCount - 1);
+}
+
+/*!
+    Clears all statistics.
+*/
+void QtPropertyBrowserProfiler::reset()
+{
+    d_ptr->resetStatistics();
+    update();
+}
+
+/*!
+    \reimp
+*/
+QSize QtPropertyBrowserProfiler::sizeHint() const
+{
+    const QFontMetrics metrics = fontMetrics();
+    const int lines = 5 + d_ptr->m_hotPropertyCount + 1;
+    const int histogramHeight = 4 * metrics.lineSpacing();
+    return QSize(32 * metrics.averageCharWidth() + 2 * profilerMargin,
+                lines * metrics.lineSpacing() + histogramHeight + 2 * profilerMargin);
+}
+
+/*!
+    \reimp
+*/
+bool QtPropertyBrowserProfiler::eventFilter(QObject *watched, QEvent *event)
+{
+    Q_D(QtPropertyBrowserProfiler);
+    const bool browserWidget = watched != d->m_window || d->m_window == d->m_browser;
+    switch (event->type()) {
+    case QEvent::UpdateRequest:
+        if (watched == d->m_window && !d->m_inFrame)
+            d->beginFrame();
+        break;
+    case QEvent::Paint:
+        if (!browserWidget
+                || d->isOverlayPaint(static_cast<QWidget *>(watched), static_cast<QPaintEvent *>(event)))
+            break;
+        if (!d->m_inFrame) {
+            ++d->m_repaints;
+        } else {
+            d->m_framePainted = true;
+            d->m_frameEnd = d->m_clock.nsecsElapsed();
+        }
+        break;
+    case QEvent::ChildAdded:
+        if (browserWidget) {
+            QObject *child = static_cast<QChildEvent *>(event)->child();
+            if (child->isWidgetType() && d->isWatchable(static_cast<QWidget *>(child))) {
+                // Children of created widgets, like the line edit of a
+                // spin box, are part of the same editor.
+                const bool editor = !d->m_createdWidgets.contains(watched);
+                d->m_createdWidgets.insert(child, editor);
+                if (editor)
+                    ++d->m_editorsCreated;
+                child->installEventFilter(this);
+            }
+        }
+        break;
+    case QEvent::ChildRemoved:
+        if (browserWidget) {
+            const auto it = d->m_createdWidgets.find(static_cast<QChildEvent *>(event)->child());
+            if (it != d->m_createdWidgets.end()) {
+                if (it.value())
+                    ++d->m_editorsDestroyed;
+                d->m_createdWidgets.erase(it);
+            }
+        }
+        break;
+    case QEvent::Resize:
+        if (watched == d->m_browser && d->m_overlay)
+            d->updateOverlayGeometry();
+        break;
+    default:
+        break;
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+/*!
+    \reimp
+*/
+void QtPropertyBrowserProfiler::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+    Q_D(QtPropertyBrowserProfiler);
+
+    QPainter painter(this);
+    QColor background = palette().color(QPalette::ToolTipBase);
+    if (d->m_overlay)
+        background.setAlpha(220);
+    painter.fillRect(rect(), background);
+    painter.setPen(palette().color(QPalette::ToolTipText));
+
+    const QFontMetrics metrics = fontMetrics();
+    const int line = metrics.lineSpacing();
+    const int textWidth = width() - 2 * profilerMargin;
+    int y = profilerMargin + metrics.ascent();
+
+    painter.drawText(profilerMargin, y, tr("Updates/s: %1").arg(d->m_updateRate, 0, 'f', 1));
+    y += line;
+    painter.drawText(profilerMargin, y, tr("Repaints/s: %1").arg(d->m_repaintRate, 0, 'f', 1));
+    y += line;
+    painter.drawText(profilerMargin, y, tr("Editors/s: +%1 / -%2")
+                .arg(d->m_editorCreateRate, 0, 'f', 1).arg(d->m_editorDestroyRate, 0, 'f', 1));
+    y += line;
+
+    painter.drawText(profilerMargin, y, tr("Hottest properties:"));
+    y += line;
+    for (const QtPropertyBrowserProfilerPrivate::HotProperty &hot : qAsConst(d->m_hotProperties)) {
+        const QString text = QString::number(hot.updates) + QLatin1String("  ") + hot.name;
+        painter.drawText(2 * profilerMargin, y,
+                    metrics.elidedText(text, Qt::ElideRight, textWidth - profilerMargin));
+        y += line;
+    }
+    y += line * (d->m_hotPropertyCount - d->m_hotProperties.size());
+
+    painter.drawText(profilerMargin, y, tr("Frame times (ms):"));
+    y += line;
+
+    const QList<int> histogram = frameTimeHistogram();
+    const int maxFrames = qMax(1, *std::max_element(histogram.cbegin(), histogram.cend()));
+    const int barAreaHeight = 3 * line;
+    const int bucketWidth = textWidth / QtPropertyBrowserProfilerPrivate::FrameBucketCount;
+    const int baseline = y - metrics.ascent() + barAreaHeight;
+    const QColor barColor = palette().color(QPalette::Highlight);
+    for (int i = 0; i < QtPropertyBrowserProfilerPrivate::FrameBucketCount; ++i) {
+        const int x = profilerMargin + i * bucketWidth;
+        const int barHeight = histogram.at(i) * barAreaHeight / maxFrames;
+        painter.fillRect(x + 1, baseline - barHeight, bucketWidth - 2, barHeight, barColor);
+        const QString label = i < QtPropertyBrowserProfilerPrivate::FrameBucketCount - 1
+                    ? QString::number(frameBucketBounds[i])
+                    : QLatin1String(">");
+        painter.drawText(QRect(x, baseline, bucketWidth, line), Qt::AlignHCenter | Qt::AlignTop, label);
+    }
+}
+
+QT_END_NAMESPACE
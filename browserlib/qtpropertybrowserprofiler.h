@@ -0,0 +1,124 @@
+#ifndef QTPROPERTYBROWSERPROFILER_H
+#define QTPROPERTYBROWSERPROFILER_H
+#include "qtpropertybrowser.h"
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QPointer>
+#include <QtCore/QSet>
+#include <QtCore/QTimer>
+#include <array>
+
+QT_BEGIN_NAMESPACE
+
+class QtPropertyBrowserProfiler;
+
+class QtPropertyBrowserProfilerPrivate
+{
+    QtPropertyBrowserProfiler *q_ptr;
+    Q_DECLARE_PUBLIC(QtPropertyBrowserProfiler)
+public:
+    enum { FrameBucketCount = 8, HistogramSampleCount = 10 };
+    typedef std::array<int, FrameBucketCount> FrameHistogram;
+
+    struct HotProperty
+    {
+        QString name;
+        int updates;
+    };
+
+    bool isWatchable(const QWidget *widget) const;
+    void watchWidget(QWidget *widget);
+    void watchBrowser();
+    void unwatchBrowser();
+    void watchManagers();
+    void beginFrame();
+    void endFrame();
+    bool isOverlayPaint(const QWidget *widget, const QPaintEvent *event) const;
+    void updateOverlayGeometry();
+    void resetStatistics();
+
+    void slotSample();
+    void slotPropertyChanged(QtProperty *property);
+    void slotPropertyDestroyed(QtProperty *property);
+    void slotManagerDestroyed(QObject *manager);
+
+    QPointer<QtAbstractPropertyBrowser> m_browser;
+    QPointer<QWidget> m_window;
+    QSet<QtAbstractPropertyManager *> m_managers;
+    QHash<QtProperty *, int> m_propertyUpdates;
+    QHash<const QObject *, bool> m_createdWidgets;
+    QTimer *m_sampleTimer;
+    QElapsedTimer m_clock;
+    qint64 m_lastSample{0};
+
+    int m_updates{0};
+    int m_repaints{0};
+    int m_editorsCreated{0};
+    int m_editorsDestroyed{0};
+    double m_updateRate{0};
+    double m_repaintRate{0};
+    double m_editorCreateRate{0};
+    double m_editorDestroyRate{0};
+    QList<HotProperty> m_hotProperties;
+
+    bool m_inFrame{false};
+    bool m_framePainted{false};
+    qint64 m_frameStart{0};
+    qint64 m_frameEnd{0};
+    FrameHistogram m_frames{};
+    QList<FrameHistogram> m_frameHistory;
+
+    int m_hotPropertyCount{5};
+    bool m_overlay{false};
+};
+
+class QtPropertyBrowserProfiler : public QWidget
+{
+    Q_OBJECT
+    Q_PROPERTY(int sampleInterval READ sampleInterval WRITE setSampleInterval)
+    Q_PROPERTY(int hotPropertyCount READ hotPropertyCount WRITE setHotPropertyCount)
+    Q_PROPERTY(bool overlay READ isOverlay WRITE setOverlay)
+public:
+    explicit QtPropertyBrowserProfiler(QWidget *parent = 0);
+    ~QtPropertyBrowserProfiler();
+
+    QtAbstractPropertyBrowser *browser() const;
+    void setBrowser(QtAbstractPropertyBrowser *browser);
+
+    int sampleInterval() const;
+    void setSampleInterval(int msec);
+    int hotPropertyCount() const;
+    void setHotPropertyCount(int count);
+    bool isOverlay() const;
+    void setOverlay(bool overlay);
+
+    double updateRate() const;
+    double repaintRate() const;
+    double editorCreationRate() const;
+    double editorDestructionRate() const;
+    QList<QPair<QString, int> > hotProperties() const;
+    QList<int> frameTimeHistogram() const;
+    static QList<int> frameTimeBuckets();
+
+    QSize sizeHint() const override;
+
+public Q_SLOTS:
+    void reset();
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    QScopedPointer<class QtPropertyBrowserProfilerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtPropertyBrowserProfiler)
+    Q_DISABLE_COPY_MOVE(QtPropertyBrowserProfiler)
+    Q_PRIVATE_SLOT(d_func(), void slotSample())
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *))
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyDestroyed(QtProperty *))
+    Q_PRIVATE_SLOT(d_func(), void slotManagerDestroyed(QObject *))
+};
+
+QT_END_NAMESPACE
+
+#endif
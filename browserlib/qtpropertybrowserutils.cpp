@@ -49,74 +49,94 @@
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+struct CursorShapeEntry
+{
+    Qt::CursorShape shape;
+    const char *name;
+    const char *iconFile;
+};
+
+// The value of a cursor shape is its index in this table.
+const CursorShapeEntry cursorShapeTable[] = {
+    { Qt::ArrowCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Arrow"), "cursor-arrow.png" },
+    { Qt::UpArrowCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Up Arrow"), "cursor-uparrow.png" },
+    { Qt::CrossCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Cross"), "cursor-cross.png" },
+    { Qt::WaitCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Wait"), "cursor-wait.png" },
+    { Qt::IBeamCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "IBeam"), "cursor-ibeam.png" },
+    { Qt::SizeVerCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Size Vertical"), "cursor-sizev.png" },
+    { Qt::SizeHorCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Size Horizontal"), "cursor-sizeh.png" },
+    { Qt::SizeFDiagCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Size Backslash"), "cursor-sizef.png" },
+    { Qt::SizeBDiagCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Size Slash"), "cursor-sizeb.png" },
+    { Qt::SizeAllCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Size All"), "cursor-sizeall.png" },
+    { Qt::BlankCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Blank"), 0 },
+    { Qt::SplitVCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Split Vertical"), "cursor-vsplit.png" },
+    { Qt::SplitHCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Split Horizontal"), "cursor-hsplit.png" },
+    { Qt::PointingHandCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Pointing Hand"), "cursor-hand.png" },
+    { Qt::ForbiddenCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Forbidden"), "cursor-forbidden.png" },
+    { Qt::OpenHandCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Open Hand"), "cursor-openhand.png" },
+    { Qt::ClosedHandCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Closed Hand"), "cursor-closedhand.png" },
+    { Qt::WhatsThisCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "What's This"), "cursor-whatsthis.png" },
+    { Qt::BusyCursor, QT_TRANSLATE_NOOP("QtCursorDatabase", "Busy"), "cursor-busy.png" }
+};
+
+const int cursorShapeCount = int(sizeof(cursorShapeTable) / sizeof(cursorShapeTable[0]));
+}
+
 QtCursorDatabase::QtCursorDatabase()
 {
-    appendCursor(Qt::ArrowCursor, QCoreApplication::translate("QtCursorDatabase", "Arrow"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-arrow.png")));
-    appendCursor(Qt::UpArrowCursor, QCoreApplication::translate("QtCursorDatabase", "Up Arrow"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-uparrow.png")));
-    appendCursor(Qt::CrossCursor, QCoreApplication::translate("QtCursorDatabase", "Cross"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-cross.png")));
-    appendCursor(Qt::WaitCursor, QCoreApplication::translate("QtCursorDatabase", "Wait"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-wait.png")));
-    appendCursor(Qt::IBeamCursor, QCoreApplication::translate("QtCursorDatabase", "IBeam"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-ibeam.png")));
-    appendCursor(Qt::SizeVerCursor, QCoreApplication::translate("QtCursorDatabase", "Size Vertical"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-sizev.png")));
-    appendCursor(Qt::SizeHorCursor, QCoreApplication::translate("QtCursorDatabase", "Size Horizontal"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-sizeh.png")));
-    appendCursor(Qt::SizeFDiagCursor, QCoreApplication::translate("QtCursorDatabase", "Size Backslash"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-sizef.png")));
-    appendCursor(Qt::SizeBDiagCursor, QCoreApplication::translate("QtCursorDatabase", "Size Slash"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-sizeb.png")));
-    appendCursor(Qt::SizeAllCursor, QCoreApplication::translate("QtCursorDatabase", "Size All"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-sizeall.png")));
-    appendCursor(Qt::BlankCursor, QCoreApplication::translate("QtCursorDatabase", "Blank"),
-                 QIcon());
-    appendCursor(Qt::SplitVCursor, QCoreApplication::translate("QtCursorDatabase", "Split Vertical"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-vsplit.png")));
-    appendCursor(Qt::SplitHCursor, QCoreApplication::translate("QtCursorDatabase", "Split Horizontal"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-hsplit.png")));
-    appendCursor(Qt::PointingHandCursor, QCoreApplication::translate("QtCursorDatabase", "Pointing Hand"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-hand.png")));
-    appendCursor(Qt::ForbiddenCursor, QCoreApplication::translate("QtCursorDatabase", "Forbidden"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-forbidden.png")));
-    appendCursor(Qt::OpenHandCursor, QCoreApplication::translate("QtCursorDatabase", "Open Hand"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-openhand.png")));
-    appendCursor(Qt::ClosedHandCursor, QCoreApplication::translate("QtCursorDatabase", "Closed Hand"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-closedhand.png")));
-    appendCursor(Qt::WhatsThisCursor, QCoreApplication::translate("QtCursorDatabase", "What's This"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-whatsthis.png")));
-    appendCursor(Qt::BusyCursor, QCoreApplication::translate("QtCursorDatabase", "Busy"),
-                 QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/cursor-busy.png")));
+}
+
+// Make sure icons are removed as soon as QApplication is destroyed, otherwise,
+// handles are leaked on X11.
+static void clearCursorDatabase();
+Q_GLOBAL_STATIC(QtCursorDatabase, cursorDatabase)
+
+static void clearCursorDatabase()
+{
+    cursorDatabase()->clear();
+}
+
+QtCursorDatabase *QtCursorDatabase::instance()
+{
+    if (!cursorDatabase.exists())
+        qAddPostRoutine(clearCursorDatabase);
+    return cursorDatabase();
 }
 
 void QtCursorDatabase::clear()
 {
-    m_cursorNames.clear();
     m_cursorIcons.clear();
-    m_valueToCursorShape.clear();
-    m_cursorShapeToValue.clear();
 }
 
-void QtCursorDatabase::appendCursor(Qt::CursorShape shape, const QString &name, const QIcon &icon)
+QIcon QtCursorDatabase::valueToIcon(int value) const
 {
-    if (m_cursorShapeToValue.contains(shape))
-        return;
-    const int value = m_cursorNames.count();
-    m_cursorNames.append(name);
-    m_cursorIcons.insert(value, icon);
-    m_valueToCursorShape.insert(value, shape);
-    m_cursorShapeToValue.insert(shape, value);
+    if (value < 0 || value >= cursorShapeCount)
+        return QIcon();
+
+    auto it = m_cursorIcons.find(value);
+    if (it == m_cursorIcons.end()) {
+        QIcon icon;
+        if (const char *iconFile = cursorShapeTable[value].iconFile)
+            icon = QIcon(QLatin1String(":/qt-project.org/qtpropertybrowser/images/") + QLatin1String(iconFile));
+        it = m_cursorIcons.insert(value, icon);
+    }
+    return it.value();
 }
 
 QStringList QtCursorDatabase::cursorShapeNames() const
 {
-    return m_cursorNames;
+    QStringList names;
+    names.reserve(cursorShapeCount);
+    for (const CursorShapeEntry &entry : cursorShapeTable)
+        names.append(QCoreApplication::translate("QtCursorDatabase", entry.name));
+    return names;
 }
 
 QMap<int, QIcon> QtCursorDatabase::cursorShapeIcons() const
 {
+    for (int value = 0; value < cursorShapeCount; ++value)
+        valueToIcon(value);
     return m_cursorIcons;
 }
 
@@ -124,22 +144,23 @@ QString QtCursorDatabase::cursorToShapeName(const QCursor &cursor) const
 {
     int val = cursorToValue(cursor);
     if (val >= 0)
-        return m_cursorNames.at(val);
+        return QCoreApplication::translate("QtCursorDatabase", cursorShapeTable[val].name);
     return QString();
 }
 
 QIcon QtCursorDatabase::cursorToShapeIcon(const QCursor &cursor) const
 {
-    int val = cursorToValue(cursor);
-    return m_cursorIcons.value(val);
+    return valueToIcon(cursorToValue(cursor));
 }
 
 int QtCursorDatabase::cursorToValue(const QCursor &cursor) const
 {
 #ifndef QT_NO_CURSOR
-    Qt::CursorShape shape = cursor.shape();
-    if (m_cursorShapeToValue.contains(shape))
-        return m_cursorShapeToValue[shape];
+    const Qt::CursorShape shape = cursor.shape();
+    for (int value = 0; value < cursorShapeCount; ++value) {
+        if (cursorShapeTable[value].shape == shape)
+            return value;
+    }
 #endif
     return -1;
 }
@@ -147,8 +168,8 @@ int QtCursorDatabase::cursorToValue(const QCursor &cursor) const
 #ifndef QT_NO_CURSOR
 QCursor QtCursorDatabase::valueToCursor(int value) const
 {
-    if (m_valueToCursorShape.contains(value))
-        return QCursor(m_valueToCursorShape[value]);
+    if (value >= 0 && value < cursorShapeCount)
+        return QCursor(cursorShapeTable[value].shape);
     return QCursor();
 }
 #endif
@@ -68,6 +68,8 @@ public:
     QtCursorDatabase();
     void clear();
 
+    static QtCursorDatabase *instance();
+
     QStringList cursorShapeNames() const;
     QMap<int, QIcon> cursorShapeIcons() const;
     QString cursorToShapeName(const QCursor &cursor) const;
@@ -77,11 +79,10 @@ public:
     QCursor valueToCursor(int value) const;
 #endif
 private:
-    void appendCursor(Qt::CursorShape shape, const QString &name, const QIcon &icon);
-    QStringList m_cursorNames;
-    QMap<int, QIcon> m_cursorIcons;
-    QMap<int, Qt::CursorShape> m_valueToCursorShape;
-    QMap<Qt::CursorShape, int> m_cursorShapeToValue;
+    QIcon valueToIcon(int value) const;
+
+    // Icons are loaded on first request and kept until clear().
+    mutable QMap<int, QIcon> m_cursorIcons;
 };
 
 class QtPropertyBrowserUtils
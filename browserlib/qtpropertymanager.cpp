@@ -37,16 +37,28 @@
 **
 ****************************************************************************/
 #include "qtpropertymanager.h"
+#include "qpoint3dmath.h"
 
 
+#include <QtCore/QAtomicInt>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QThreadPool>
+#include <charconv>
 #include <limits>
 #include <limits.h>
 #include <float.h>
+#include <string.h>
 
 #if defined(Q_CC_MSVC)
 #    pragma warning(disable: 4786) /* MS VS 6: truncating debug info after 255 characters */
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define QT_PROPERTYBROWSER_SSE2
+#endif
+
 QT_BEGIN_NAMESPACE
 
 // Match the exact signature of qBound for VS 6.
@@ -133,6 +145,43 @@ static Value getMaximum(const QMap<const QtProperty *, PrivateData> &propertyMap
     return getData<Value>(propertyMap, &PrivateData::maxVal, property, defaultValue);
 }
 
+// Heap memory held by a manager's data for one property, beyond the
+// size of the data itself.
+template <class Value>
+static qint64 valueHeapBytes(const Value &)
+{
+    return 0;
+}
+
+static qint64 valueHeapBytes(const QtIntArrayPropertyManagerPrivate::Data &data)
+{
+    return QtMemoryReport::listBytes(data.val);
+}
+
+static qint64 valueHeapBytes(const QtDoubleArrayPropertyManagerPrivate::Data &data)
+{
+    return QtMemoryReport::listBytes(data.val);
+}
+
+static qint64 valueHeapBytes(const QtStringPropertyManagerPrivate::Data &data)
+{
+    return QtMemoryReport::stringBytes(data.val);
+}
+
+template <class Value>
+static void reportValueMemory(const QtAbstractPropertyManager *manager,
+            const QMap<const QtProperty *, Value> &propertyMap,
+            const QtProperty *property, QtMemoryReport *report)
+{
+    const auto it = propertyMap.constFind(property);
+    if (it == propertyMap.constEnd())
+        return;
+    const QString type = QString::fromLatin1(manager->metaObject()->className());
+    report->add(QtMemoryReport::ManagerData, type, property, sizeof(Value) + valueHeapBytes(it.value()));
+    report->add(QtMemoryReport::MapNodes, type, property,
+                QtMemoryReport::mapNodeBytes<const QtProperty *, Value>() - sizeof(Value));
+}
+
 template <class ValueChangeParameter, class Value, class PropertyManager>
 static void setSimpleValue(QMap<const QtProperty *, Value> &propertyMap,
             PropertyManager *manager,
@@ -294,44 +343,59 @@ static QList<QLocale::Country> sortCountries(const QList<QLocale::Country> &coun
     return nameToCountry.values();
 }
 
-void QtMetaEnumProvider::initLocale()
+void QtMetaEnumProvider::initLocale() const
 {
+    if (m_localeInitialized)
+        return;
+    m_localeInitialized = true;
+
+    // A single pass over the locale database collects the countries of every
+    // language, instead of one countriesForLanguage() scan per language.
+    QList<QList<QLocale::Country> > countriesByLanguage(QLocale::LastLanguage + 1);
+    const QList<QLocale> locales = QLocale::matchingLocales(QLocale::AnyLanguage, QLocale::AnyScript, QLocale::AnyCountry);
+    for (const QLocale &locale : locales) {
+        QList<QLocale::Country> &countries = countriesByLanguage[locale.language()];
+        if (!countries.contains(locale.country()))
+            countries.append(locale.country());
+    }
+
+    const QLocale system = QLocale::system();
+    QList<QLocale::Country> &systemCountries = countriesByLanguage[system.language()];
+    if (systemCountries.isEmpty())
+        systemCountries << system.country();
+
     QMultiMap<QString, QLocale::Language> nameToLanguage;
     for (int l = QLocale::C, last = QLocale::LastLanguage; l <= last; ++l) {
         const QLocale::Language language = static_cast<QLocale::Language>(l);
-        QLocale locale(language);
-        if (locale.language() == language)
+        if (!countriesByLanguage.at(l).isEmpty())
             nameToLanguage.insert(QLocale::languageToString(language), language);
     }
 
-    const QLocale system = QLocale::system();
-    if (!nameToLanguage.contains(QLocale::languageToString(system.language())))
-        nameToLanguage.insert(QLocale::languageToString(system.language()), system.language());
-
-    const auto languages = nameToLanguage.values();
-    for (QLocale::Language language : languages) {
-        QList<QLocale::Country> countries;
-        countries = QLocale::countriesForLanguage(language);
-        if (countries.isEmpty() && language == system.language())
-            countries << system.country();
-
-        if (!countries.isEmpty() && !m_languageToIndex.contains(language)) {
-            countries = sortCountries(countries);
-            int langIdx = m_languageEnumNames.count();
-            m_indexToLanguage[langIdx] = language;
-            m_languageToIndex[language] = langIdx;
-            QStringList countryNames;
-            int countryIdx = 0;
-            for (QLocale::Country country : qAsConst(countries)) {
-                countryNames << QLocale::countryToString(country);
-                m_indexToCountry[langIdx][countryIdx] = country;
-                m_countryToIndex[language][country] = countryIdx;
-                ++countryIdx;
-            }
-            m_languageEnumNames << QLocale::languageToString(language);
-            m_countryEnumNames[language] = countryNames;
-        }
+    m_languageToIndex.fill(-1, QLocale::LastLanguage + 1);
+    m_indexToLanguage.reserve(nameToLanguage.count());
+    m_countryTables.reserve(nameToLanguage.count());
+    for (auto it = nameToLanguage.cbegin(), end = nameToLanguage.cend(); it != end; ++it) {
+        const QLocale::Language language = it.value();
+        m_languageToIndex[language] = m_indexToLanguage.count();
+        m_indexToLanguage.append(language);
+        m_languageEnumNames.append(it.key());
+        CountryTable table;
+        table.countries = countriesByLanguage.at(language);
+        m_countryTables.append(table);
+    }
+}
+
+const QtMetaEnumProvider::CountryTable &QtMetaEnumProvider::countryTable(int languageIndex) const
+{
+    CountryTable &table = m_countryTables[languageIndex];
+    if (!table.sorted) {
+        table.sorted = true;
+        table.countries = sortCountries(table.countries);
+        table.countryNames.reserve(table.countries.count());
+        for (QLocale::Country country : qAsConst(table.countries))
+            table.countryNames << QLocale::countryToString(country);
     }
+    return table;
 }
 
 QtMetaEnumProvider::QtMetaEnumProvider()
@@ -344,8 +408,23 @@ QtMetaEnumProvider::QtMetaEnumProvider()
     const int keyCount = m_policyEnum.keyCount();
     for (int i = 0; i < keyCount; i++)
         m_policyEnumNames << QLatin1String(m_policyEnum.key(i));
+}
+
+QStringList QtMetaEnumProvider::languageEnumNames() const
+{
+    initLocale();
+    return m_languageEnumNames;
+}
 
+QStringList QtMetaEnumProvider::countryEnumNames(QLocale::Language language) const
+{
     initLocale();
+    if (language < 0 || language >= m_languageToIndex.count())
+        return QStringList();
+    const int languageIndex = m_languageToIndex.at(language);
+    if (languageIndex < 0)
+        return QStringList();
+    return countryTable(languageIndex).countryNames;
 }
 
 QSizePolicy::Policy QtMetaEnumProvider::indexToSizePolicy(int index) const
@@ -364,12 +443,16 @@ int QtMetaEnumProvider::sizePolicyToIndex(QSizePolicy::Policy policy) const
 
 void QtMetaEnumProvider::indexToLocale(int languageIndex, int countryIndex, QLocale::Language *language, QLocale::Country *country) const
 {
+    initLocale();
     QLocale::Language l = QLocale::C;
     QLocale::Country c = QLocale::AnyCountry;
-    if (m_indexToLanguage.contains(languageIndex)) {
-        l = m_indexToLanguage[languageIndex];
-        if (m_indexToCountry.contains(languageIndex) && m_indexToCountry[languageIndex].contains(countryIndex))
-            c = m_indexToCountry[languageIndex][countryIndex];
+    if (languageIndex >= 0 && languageIndex < m_indexToLanguage.count()) {
+        l = m_indexToLanguage.at(languageIndex);
+        if (country) {
+            const QList<QLocale::Country> &countries = countryTable(languageIndex).countries;
+            if (countryIndex >= 0 && countryIndex < countries.count())
+                c = countries.at(countryIndex);
+        }
     }
     if (language)
         *language = l;
@@ -379,13 +462,13 @@ void QtMetaEnumProvider::indexToLocale(int languageIndex, int countryIndex, QLoc
 
 void QtMetaEnumProvider::localeToIndex(QLocale::Language language, QLocale::Country country, int *languageIndex, int *countryIndex) const
 {
+    initLocale();
     int l = -1;
     int c = -1;
-    if (m_languageToIndex.contains(language)) {
-        l = m_languageToIndex[language];
-        if (m_countryToIndex.contains(language) && m_countryToIndex[language].contains(country))
-            c = m_countryToIndex[language][country];
-    }
+    if (language >= 0 && language < m_languageToIndex.count())
+        l = m_languageToIndex.at(language);
+    if (l >= 0 && countryIndex)
+        c = countryTable(l).countries.indexOf(country);
 
     if (languageIndex)
         *languageIndex = l;
@@ -594,6 +677,7 @@ QString QtIntPropertyManager::valueText(const QtProperty *property) const
 */
 void QtIntPropertyManager::setValue(QtProperty *property, int val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     void (QtIntPropertyManagerPrivate::*setSubPropertyValue)(QtProperty *, int) = 0;
     setValueInRange<int, QtIntPropertyManagerPrivate, QtIntPropertyManager, int>(this, d_ptr.data(),
                 &QtIntPropertyManager::propertyChanged,
@@ -689,6 +773,30 @@ void QtIntPropertyManager::setSingleStep(QtProperty *property, int step)
     emit singleStepChanged(property, data.singleStep);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtIntPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtIntPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtIntPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toInt());
+}
+
 /*!
     \reimp
 */
@@ -868,6 +976,7 @@ QString QtDoublePropertyManager::valueText(const QtProperty *property) const
 */
 void QtDoublePropertyManager::setValue(QtProperty *property, double val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     void (QtDoublePropertyManagerPrivate::*setSubPropertyValue)(QtProperty *, double) = 0;
     setValueInRange<double, QtDoublePropertyManagerPrivate, QtDoublePropertyManager, double>(this, d_ptr.data(),
                 &QtDoublePropertyManager::propertyChanged,
@@ -932,6 +1041,7 @@ void QtDoublePropertyManager::setDecimals(QtProperty *property, int prec)
 
     it.value() = data;
 
+    emit propertyChanged(property);
     emit decimalsChanged(property, data.decimals);
 }
 
@@ -995,6 +1105,30 @@ void QtDoublePropertyManager::setRange(QtProperty *property, double minVal, doub
                 property, minVal, maxVal, setSubPropertyRange);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtDoublePropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtDoublePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtDoublePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toDouble());
+}
+
 /*!
     \reimp
 */
@@ -1011,55 +1145,361 @@ void QtDoublePropertyManager::uninitializeProperty(QtProperty *property)
     d_ptr->m_values.remove(property);
 }
 
-// QtStringPropertyManager
+// Array kernels shared by QtIntArrayPropertyManager and QtDoubleArrayPropertyManager.
+// Arrays may hold hundreds of thousands of elements, so the range checks
+// and clamps process two doubles or four ints per SSE2 instruction. The
+// scalar tails match qBound(), including its handling of NaN.
+static bool arrayInRange(const int *values, qsizetype count, int minVal, int maxVal)
+{
+    qsizetype i = 0;
+#ifdef QT_PROPERTYBROWSER_SSE2
+    const __m128i lo = _mm_set1_epi32(minVal);
+    const __m128i hi = _mm_set1_epi32(maxVal);
+    __m128i outside = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+        outside = _mm_or_si128(outside, _mm_or_si128(_mm_cmplt_epi32(v, lo), _mm_cmpgt_epi32(v, hi)));
+    }
+    if (_mm_movemask_epi8(outside))
+        return false;
+#endif
+    for (; i < count; ++i) {
+        if (values[i] < minVal || values[i] > maxVal)
+            return false;
+    }
+    return true;
+}
+
+static bool arrayInRange(const double *values, qsizetype count, double minVal, double maxVal)
+{
+    qsizetype i = 0;
+#ifdef QT_PROPERTYBROWSER_SSE2
+    const __m128d lo = _mm_set1_pd(minVal);
+    const __m128d hi = _mm_set1_pd(maxVal);
+    __m128d inside = _mm_castsi128_pd(_mm_set1_epi32(-1));
+    for (; i + 2 <= count; i += 2) {
+        const __m128d v = _mm_loadu_pd(values + i);
+        // NaN compares false and therefore counts as outside, as in qBound().
+        inside = _mm_and_pd(inside, _mm_and_pd(_mm_cmpge_pd(v, lo), _mm_cmple_pd(v, hi)));
+    }
+    if (_mm_movemask_pd(inside) != 0x3)
+        return false;
+#endif
+    for (; i < count; ++i) {
+        if (!(values[i] >= minVal && values[i] <= maxVal))
+            return false;
+    }
+    return true;
+}
+
+static void boundArray(int *values, qsizetype count, int minVal, int maxVal)
+{
+    qsizetype i = 0;
+#ifdef QT_PROPERTYBROWSER_SSE2
+    const __m128i lo = _mm_set1_epi32(minVal);
+    const __m128i hi = _mm_set1_epi32(maxVal);
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+        __m128i mask = _mm_cmpgt_epi32(v, hi);
+        v = _mm_or_si128(_mm_and_si128(mask, hi), _mm_andnot_si128(mask, v));
+        mask = _mm_cmplt_epi32(v, lo);
+        v = _mm_or_si128(_mm_and_si128(mask, lo), _mm_andnot_si128(mask, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(values + i), v);
+    }
+#endif
+    for (; i < count; ++i)
+        values[i] = qBound(minVal, values[i], maxVal);
+}
+
+static void boundArray(double *values, qsizetype count, double minVal, double maxVal)
+{
+    qsizetype i = 0;
+#ifdef QT_PROPERTYBROWSER_SSE2
+    const __m128d lo = _mm_set1_pd(minVal);
+    const __m128d hi = _mm_set1_pd(maxVal);
+    for (; i + 2 <= count; i += 2) {
+        // minpd/maxpd return the second operand if either is NaN, so a NaN
+        // passes through the minimum and becomes minVal, like qBound().
+        const __m128d v = _mm_loadu_pd(values + i);
+        _mm_storeu_pd(values + i, _mm_max_pd(_mm_min_pd(hi, v), lo));
+    }
+#endif
+    for (; i < count; ++i)
+        values[i] = qBound(minVal, values[i], maxVal);
+}
+
+template <class Value, class PropertyManagerPrivate, class PropertyManager>
+static void setArrayValues(PropertyManager *manager, PropertyManagerPrivate *managerPrivate,
+            QtProperty *property, const QList<Value> &vals)
+{
+    const auto it = managerPrivate->m_values.find(property);
+    if (it == managerPrivate->m_values.end())
+        return;
+
+    auto &data = it.value();
+
+    // Shares the caller's storage unless something has to be clamped.
+    QList<Value> newVals = vals;
+    if (!arrayInRange(newVals.constData(), newVals.size(), data.minVal, data.maxVal))
+        boundArray(newVals.data(), newVals.size(), data.minVal, data.maxVal);
+
+    if (data.val == newVals)
+        return;
+
+    data.val = newVals;
+
+    emit manager->propertyChanged(property);
+    emit manager->valuesChanged(property, data.val);
+}
+
+template <class Value, class PropertyManagerPrivate, class PropertyManager>
+static void setArrayValue(PropertyManager *manager, PropertyManagerPrivate *managerPrivate,
+            QtProperty *property, int index, Value val)
+{
+    const auto it = managerPrivate->m_values.find(property);
+    if (it == managerPrivate->m_values.end())
+        return;
+
+    auto &data = it.value();
+
+    if (index < 0 || index >= data.val.size())
+        return;
+
+    val = qBound(data.minVal, val, data.maxVal);
+    if (data.val.at(index) == val)
+        return;
+
+    data.val[index] = val;
+
+    emit manager->propertyChanged(property);
+    emit manager->valueChanged(property, index, val);
+}
+
+template <class Value, class PropertyManagerPrivate, class PropertyManager>
+static void setArrayRange(PropertyManager *manager, PropertyManagerPrivate *managerPrivate,
+            QtProperty *property, Value minVal, Value maxVal)
+{
+    const auto it = managerPrivate->m_values.find(property);
+    if (it == managerPrivate->m_values.end())
+        return;
+
+    auto &data = it.value();
+
+    orderBorders(minVal, maxVal);
+    if (data.minVal == minVal && data.maxVal == maxVal)
+        return;
+
+    data.minVal = minVal;
+    data.maxVal = maxVal;
+
+    emit manager->rangeChanged(property, data.minVal, data.maxVal);
+
+    if (arrayInRange(data.val.constData(), data.val.size(), data.minVal, data.maxVal))
+        return;
+
+    boundArray(data.val.data(), data.val.size(), data.minVal, data.maxVal);
+
+    emit manager->propertyChanged(property);
+    emit manager->valuesChanged(property, data.val);
+}
+
+// Builds the value text of the numeric managers from a translated
+// template such as "(%1, %2)". The template is translated and split at
+// its placeholders only once per value text generation, the numbers are
+// converted with std::to_chars into stack buffers and the result is
+// assembled with a single allocation.
+class QtNumericValueText
+{
+public:
+    QtNumericValueText(const char *context, const char *sourceText)
+        : m_context(context), m_sourceText(sourceText) {}
+
+    QString operator()(std::initializer_list<int> values) const
+    {
+        return format(values, [](char *first, char *last, int value) {
+            return std::to_chars(first, last, value);
+        });
+    }
+
+    QString operator()(std::initializer_list<double> values, int decimals) const
+    {
+        return format(values, [decimals](char *first, char *last, double value) {
+#ifdef __cpp_lib_to_chars
+            return std::to_chars(first, last, value, std::chars_format::fixed, decimals);
+#else
+            // Standard libraries without floating-point std::to_chars
+            // use Qt's conversion, which does not depend on the C locale.
+            const QByteArray text = QByteArray::number(value, 'f', decimals);
+            if (text.size() > last - first)
+                return std::to_chars_result{last, std::errc::value_too_large};
+            memcpy(first, text.constData(), size_t(text.size()));
+            return std::to_chars_result{first + text.size(), std::errc()};
+#endif
+        });
+    }
+
+private:
+    enum { MaxArguments = 4 };
+    // Large enough for any double in fixed notation with up to 13 decimals.
+    enum { NumberBufferSize = std::numeric_limits<double>::max_exponent10 + 32 };
+
+    struct Segment
+    {
+        QString text;
+        int argument; // -1 if the segment has no trailing placeholder
+    };
+
+    struct Number
+    {
+        char data[NumberBufferSize];
+        qsizetype size;
+    };
+
+    void resolve() const
+    {
+        const int generation = QtAbstractPropertyManagerPrivate::valueTextGeneration.loadAcquire();
+        if (generation == m_generation)
+            return;
+
+        m_segments.clear();
+        const QString translated = QCoreApplication::translate(m_context, m_sourceText);
+        QString text;
+        for (qsizetype i = 0; i < translated.size(); ++i) {
+            const QChar c = translated.at(i);
+            if (c == QLatin1Char('%') && i + 1 < translated.size()
+                    && translated.at(i + 1) >= QLatin1Char('1')
+                    && translated.at(i + 1) < QLatin1Char(char('1' + MaxArguments))) {
+                m_segments.append({text, translated.at(++i).unicode() - '1'});
+                text.clear();
+            } else {
+                text += c;
+            }
+        }
+        if (!text.isEmpty())
+            m_segments.append({text, -1});
+        m_generation = generation;
+    }
+
+    template <class Value, class Convert>
+    QString format(std::initializer_list<Value> values, Convert convert) const
+    {
+        Q_ASSERT(values.size() <= MaxArguments);
+        resolve();
+
+        Number numbers[MaxArguments];
+        qsizetype count = 0;
+        for (const Value &value : values) {
+            Number &number = numbers[count++];
+            const std::to_chars_result res = convert(number.data, number.data + NumberBufferSize, value);
+            number.size = res.ec == std::errc() ? res.ptr - number.data : 0;
+        }
+
+        qsizetype size = 0;
+        for (const Segment &segment : qAsConst(m_segments)) {
+            size += segment.text.size();
+            if (segment.argument >= 0 && segment.argument < count)
+                size += numbers[segment.argument].size;
+        }
+
+        QString result;
+        result.reserve(size);
+        for (const Segment &segment : qAsConst(m_segments)) {
+            result += segment.text;
+            if (segment.argument >= 0 && segment.argument < count) {
+                const Number &number = numbers[segment.argument];
+                result += QLatin1String(number.data, number.size);
+            }
+        }
+        return result;
+    }
+
+    const char *const m_context;
+    const char *const m_sourceText;
+    mutable QList<Segment> m_segments;
+    mutable int m_generation{-1};
+};
+
+// Summarizes an array as its size and first few elements.
+template <class Value, class Formatter>
+static QString arrayValueText(const QList<Value> &values, Formatter format)
+{
+    enum { MaxShownValues = 4 };
+    const qsizetype shown = qMin(values.size(), qsizetype(MaxShownValues));
+    QString elements;
+    for (qsizetype i = 0; i < shown; ++i) {
+        if (i)
+            elements += QLatin1String(", ");
+        elements += format(values.at(i));
+    }
+    if (values.size() > shown)
+        elements += QLatin1String(", ...");
+    return QCoreApplication::translate("QtArrayPropertyManager", "[%1] (%n value(s))", 0, int(values.size())).arg(elements);
+}
+
+// QtIntArrayPropertyManager
 /*!
-    \class QtStringPropertyManager
+    \class QtIntArrayPropertyManager
     \internal
     \inmodule QtDesigner
-    \since 4.4
 
-    \brief The QtStringPropertyManager provides and manages QString properties.
+    \brief The QtIntArrayPropertyManager provides and manages int array properties.
 
-    A string property's value can be retrieved using the value()
-    function, and set using the setValue() slot.
+    An int array property holds a whole array of values in one
+    contiguous list, which can be retrieved using the values() function
+    and set using the setValues() slot. Single elements can be accessed
+    with value() and setValue(). This is much cheaper than using one
+    QtIntPropertyManager property per element.
 
-    The current value can be checked against a regular expression. To
-    set the regular expression use the setRegExp() slot, use the
-    regExp() function to retrieve the currently set expression.
+    All elements of a property share one range, defined by a minimum
+    and a maximum value. The range can be retrieved using the minimum()
+    and maximum() functions, and set using the setMinimum(),
+    setMaximum() and setRange() slots. Values outside the range are
+    clamped.
 
-    In addition, QtStringPropertyManager provides the valueChanged() signal
-    which is emitted whenever a property created by this manager
-    changes, and the regExpChanged() signal which is emitted whenever
-    such a property changes its currently set regular expression.
+    In addition, QtIntArrayPropertyManager provides the valuesChanged()
+    signal which is emitted when the array is replaced or clamped as a
+    whole, the valueChanged() signal which is emitted when a single
+    element changes, and the rangeChanged() signal which is emitted
+    whenever the range changes.
 
-    \sa QtAbstractPropertyManager, QtLineEditFactory
+    \sa QtAbstractPropertyManager, QtIntArrayEditorFactory, QtDoubleArrayPropertyManager
 */
 
 /*!
-    \fn void QtStringPropertyManager::valueChanged(QtProperty *property, const QString &value)
+    \fn void QtIntArrayPropertyManager::valuesChanged(QtProperty *property, const QList<int> &values)
 
-    This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the
-    new \a value as parameters.
+    This signal is emitted whenever the array of a property created by
+    this manager is replaced or clamped as a whole, passing a pointer to
+    the \a property and the new \a values as parameters.
+
+    \sa setValues(), setRange()
+*/
+
+/*!
+    \fn void QtIntArrayPropertyManager::valueChanged(QtProperty *property, int index, int value)
+
+    This signal is emitted whenever a single element of a property
+    created by this manager changes, passing a pointer to the \a
+    property, the element's \a index and its new \a value as parameters.
 
     \sa setValue()
 */
 
 /*!
-    \fn void QtStringPropertyManager::regExpChanged(QtProperty *property, const QRegularExpression &regExp)
+    \fn void QtIntArrayPropertyManager::rangeChanged(QtProperty *property, int minimum, int maximum)
 
     This signal is emitted whenever a property created by this manager
-    changes its currenlty set regular expression, passing a pointer to
-    the \a property and the new \a regExp as parameters.
+    changes its range of valid values, passing a pointer to the
+    \a property and the new \a minimum and \a maximum values.
 
-    \sa setRegExp()
+    \sa setRange()
 */
 
 /*!
     Creates a manager with the given \a parent.
 */
-QtStringPropertyManager::QtStringPropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtStringPropertyManagerPrivate)
+QtIntArrayPropertyManager::QtIntArrayPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtIntArrayPropertyManagerPrivate)
 {
     d_ptr->q_ptr = this;
 }
@@ -1067,191 +1507,254 @@ QtStringPropertyManager::QtStringPropertyManager(QObject *parent)
 /*!
     Destroys this manager, and all the properties it has created.
 */
-QtStringPropertyManager::~QtStringPropertyManager()
+QtIntArrayPropertyManager::~QtIntArrayPropertyManager()
 {
     clear();
 }
 
 /*!
-    Returns the given \a property's value.
+    Returns the given \a property's values.
 
-    If the given property is not managed by this manager, this
-    function returns an empty string.
+    The list is implicitly shared, so this function does not copy the
+    elements.
+
+    \sa setValues()
+*/
+QList<int> QtIntArrayPropertyManager::values(const QtProperty *property) const
+{
+    return getValue<QList<int> >(d_ptr->m_values, property);
+}
+
+/*!
+    Returns the number of elements of the given \a property.
+*/
+int QtIntArrayPropertyManager::count(const QtProperty *property) const
+{
+    const auto it = d_ptr->m_values.constFind(property);
+    return it == d_ptr->m_values.constEnd() ? 0 : int(it.value().val.size());
+}
+
+/*!
+    Returns the element at \a index of the given \a property, or 0 if
+    \a index is out of range.
 
     \sa setValue()
 */
-QString QtStringPropertyManager::value(const QtProperty *property) const
+int QtIntArrayPropertyManager::value(const QtProperty *property, int index) const
 {
-    return getValue<QString>(d_ptr->m_values, property);
+    const auto it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return 0;
+    return it.value().val.value(index, 0);
 }
 
 /*!
-    Returns the given \a property's currently set regular expression.
+    Returns the given \a property's minimum value.
 
-    If the given \a property is not managed by this manager, this
-    function returns an empty expression.
+    \sa setMinimum(), maximum(), setRange()
+*/
+int QtIntArrayPropertyManager::minimum(const QtProperty *property) const
+{
+    return getMinimum<int>(d_ptr->m_values, property, 0);
+}
 
-    \sa setRegExp()
+/*!
+    Returns the given \a property's maximum value.
+
+    \sa setMaximum(), minimum(), setRange()
 */
-QRegularExpression QtStringPropertyManager::regExp(const QtProperty *property) const
+int QtIntArrayPropertyManager::maximum(const QtProperty *property) const
 {
-    return getData<QRegularExpression>(d_ptr->m_values, &QtStringPropertyManagerPrivate::Data::regExp, property, QRegularExpression());
+    return getMaximum<int>(d_ptr->m_values, property, 0);
 }
 
 /*!
     \reimp
 */
-QString QtStringPropertyManager::valueText(const QtProperty *property) const
+QString QtIntArrayPropertyManager::valueText(const QtProperty *property) const
 {
-    const QtStringPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    const auto it = d_ptr->m_values.constFind(property);
     if (it == d_ptr->m_values.constEnd())
         return QString();
-    return it.value().val;
+    return arrayValueText(it.value().val, [](int v) { return QString::number(v); });
 }
 
 /*!
-    \fn void QtStringPropertyManager::setValue(QtProperty *property, const QString &value)
-
-    Sets the value of the given \a property to \a value.
+    Replaces the values of the given \a property with \a vals.
 
-    If the specified \a value doesn't match the given \a property's
-    regular expression, this function does nothing.
+    Values outside the property's range are clamped.
 
-    \sa value(), setRegExp(), valueChanged()
+    \sa values(), valuesChanged()
 */
-void QtStringPropertyManager::setValue(QtProperty *property, const QString &val)
+void QtIntArrayPropertyManager::setValues(QtProperty *property, const QList<int> &vals)
 {
-    const QtStringPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
-    if (it == d_ptr->m_values.end())
-        return;
-
-    QtStringPropertyManagerPrivate::Data data = it.value();
-
-    if (data.val == val)
-        return;
-
-    if (data.regExp.isValid() && !data.regExp.pattern().isEmpty()
-        && !data.regExp.match(val).hasMatch()) {
-        return;
-    }
-
-    data.val = val;
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setArrayValues<int>(this, d_ptr.data(), property, vals);
+}
 
-    it.value() = data;
+/*!
+    Sets the element at \a index of the given \a property to \a val.
+    The size of the array is not changed, i.e. \a index must be valid.
 
-    emit propertyChanged(property);
-    emit valueChanged(property, data.val);
+    \sa value(), valueChanged()
+*/
+void QtIntArrayPropertyManager::setValue(QtProperty *property, int index, int val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setArrayValue<int>(this, d_ptr.data(), property, index, val);
 }
 
 /*!
-    Sets the regular expression of the given \a property to \a regExp.
+    Sets the minimum value for the given \a property to \a minVal.
 
-    \sa regExp(), setValue(), regExpChanged()
+    When setting the minimum value, the maximum value and the elements
+    are adjusted if necessary.
+
+    \sa minimum(), setRange(), rangeChanged()
 */
-void QtStringPropertyManager::setRegExp(QtProperty *property, const QRegularExpression &regExp)
+void QtIntArrayPropertyManager::setMinimum(QtProperty *property, int minVal)
 {
-    const QtStringPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
-    if (it == d_ptr->m_values.end())
-        return;
+    setRange(property, minVal, qMax(minVal, maximum(property)));
+}
 
-    QtStringPropertyManagerPrivate::Data data = it.value() ;
+/*!
+    Sets the maximum value for the given \a property to \a maxVal.
 
-    if (data.regExp == regExp)
-        return;
+    When setting the maximum value, the minimum value and the elements
+    are adjusted if necessary.
 
-    data.regExp = regExp;
+    \sa maximum(), setRange(), rangeChanged()
+*/
+void QtIntArrayPropertyManager::setMaximum(QtProperty *property, int maxVal)
+{
+    setRange(property, qMin(minimum(property), maxVal), maxVal);
+}
 
-    it.value() = data;
+/*!
+    Sets the range of valid values of the given \a property to
+    \a minVal - \a maxVal. Elements outside the new range are clamped.
 
-    emit regExpChanged(property, data.regExp);
+    \sa setMinimum(), setMaximum(), rangeChanged()
+*/
+void QtIntArrayPropertyManager::setRange(QtProperty *property, int minVal, int maxVal)
+{
+    setArrayRange<int>(this, d_ptr.data(), property, minVal, maxVal);
 }
 
 /*!
     \reimp
 */
-void QtStringPropertyManager::initializeProperty(QtProperty *property)
+QVariant QtIntArrayPropertyManager::journalValue(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = QtStringPropertyManagerPrivate::Data();
+    return QVariant::fromValue(values(property));
 }
 
 /*!
     \reimp
 */
-void QtStringPropertyManager::uninitializeProperty(QtProperty *property)
+void QtIntArrayPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
 {
-    d_ptr->m_values.remove(property);
+    reportValueMemory(this, d_ptr->m_values, property, report);
 }
 
-
-//     Return an icon containing a check box indicator
-static QIcon drawCheckBox(bool value)
+/*!
+    \reimp
+*/
+void QtIntArrayPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
 {
-    QStyleOptionButton opt;
-    opt.state |= value ? QStyle::State_On : QStyle::State_Off;
-    opt.state |= QStyle::State_Enabled;
-    const QStyle *style = QApplication::style();
-    // Figure out size of an indicator and make sure it is not scaled down in a list view item
-    // by making the pixmap as big as a list view icon and centering the indicator in it.
-    // (if it is smaller, it can't be helped)
-    const int indicatorWidth = style->pixelMetric(QStyle::PM_IndicatorWidth, &opt);
-    const int indicatorHeight = style->pixelMetric(QStyle::PM_IndicatorHeight, &opt);
-    const int listViewIconSize = indicatorWidth;
-    const int pixmapWidth = indicatorWidth;
-    const int pixmapHeight = qMax(indicatorHeight, listViewIconSize);
-
-    opt.rect = QRect(0, 0, indicatorWidth, indicatorHeight);
-    QPixmap pixmap = QPixmap(pixmapWidth, pixmapHeight);
-    pixmap.fill(Qt::transparent);
-    {
-        // Center?
-        const int xoff = (pixmapWidth  > indicatorWidth)  ? (pixmapWidth  - indicatorWidth)  / 2 : 0;
-        const int yoff = (pixmapHeight > indicatorHeight) ? (pixmapHeight - indicatorHeight) / 2 : 0;
-        QPainter painter(&pixmap);
-        painter.translate(xoff, yoff);
-        style->drawPrimitive(QStyle::PE_IndicatorCheckBox, &opt, &painter);
-    }
-    return QIcon(pixmap);
+    setValues(property, value.value<QList<int> >());
 }
 
+/*!
+    \reimp
+*/
+void QtIntArrayPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QtIntArrayPropertyManagerPrivate::Data();
+}
 
-// QtBoolPropertyManager
-QtBoolPropertyManagerPrivate::QtBoolPropertyManagerPrivate() :
-    m_checkedIcon(drawCheckBox(true)),
-    m_uncheckedIcon(drawCheckBox(false))
+/*!
+    \reimp
+*/
+void QtIntArrayPropertyManager::uninitializeProperty(QtProperty *property)
 {
+    d_ptr->m_values.remove(property);
 }
 
+// QtDoubleArrayPropertyManager
 /*!
-    \class QtBoolPropertyManager
+    \class QtDoubleArrayPropertyManager
     \internal
     \inmodule QtDesigner
-    \since 4.4
 
-    \brief The QtBoolPropertyManager class provides and manages boolean properties.
+    \brief The QtDoubleArrayPropertyManager provides and manages double array properties.
 
-    The property's value can be retrieved using the value() function,
-    and set using the setValue() slot.
+    A double array property holds a whole array of values in one
+    contiguous list, which can be retrieved using the values() function
+    and set using the setValues() slot. Single elements can be accessed
+    with value() and setValue(). This is much cheaper than using one
+    QtDoublePropertyManager property per element.
 
-    In addition, QtBoolPropertyManager provides the valueChanged() signal
-    which is emitted whenever a property created by this manager
-    changes.
+    All elements of a property share one range and one precision. The
+    range can be retrieved using the minimum() and maximum() functions,
+    and set using the setMinimum(), setMaximum() and setRange() slots.
+    Values outside the range are clamped. The precision is used when
+    displaying the values and can be set with setDecimals().
 
-    \sa QtAbstractPropertyManager, QtCheckBoxFactory
+    In addition, QtDoubleArrayPropertyManager provides the valuesChanged()
+    signal which is emitted when the array is replaced or clamped as a
+    whole, the valueChanged() signal which is emitted when a single
+    element changes, and the rangeChanged() and decimalsChanged()
+    signals.
+
+    \sa QtAbstractPropertyManager, QtDoubleArrayEditorFactory, QtIntArrayPropertyManager
 */
 
 /*!
-    \fn void QtBoolPropertyManager::valueChanged(QtProperty *property, bool value)
+    \fn void QtDoubleArrayPropertyManager::valuesChanged(QtProperty *property, const QList<double> &values)
+
+    This signal is emitted whenever the array of a property created by
+    this manager is replaced or clamped as a whole, passing a pointer to
+    the \a property and the new \a values as parameters.
+
+    \sa setValues(), setRange()
+*/
+
+/*!
+    \fn void QtDoubleArrayPropertyManager::valueChanged(QtProperty *property, int index, double value)
+
+    This signal is emitted whenever a single element of a property
+    created by this manager changes, passing a pointer to the \a
+    property, the element's \a index and its new \a value as parameters.
+
+    \sa setValue()
+*/
+
+/*!
+    \fn void QtDoubleArrayPropertyManager::rangeChanged(QtProperty *property, double minimum, double maximum)
 
     This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the
-    new \a value as parameters.
+    changes its range of valid values, passing a pointer to the
+    \a property and the new \a minimum and \a maximum values.
+
+    \sa setRange()
+*/
+
+/*!
+    \fn void QtDoubleArrayPropertyManager::decimalsChanged(QtProperty *property, int prec)
+
+    This signal is emitted whenever a property created by this manager
+    changes its precision of value, passing a pointer to the
+    \a property and the new \a prec value
+
+    \sa setDecimals()
 */
 
 /*!
     Creates a manager with the given \a parent.
 */
-QtBoolPropertyManager::QtBoolPropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtBoolPropertyManagerPrivate)
+QtDoubleArrayPropertyManager::QtDoubleArrayPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtDoubleArrayPropertyManagerPrivate)
 {
     d_ptr->q_ptr = this;
 }
@@ -1259,531 +1762,640 @@ QtBoolPropertyManager::QtBoolPropertyManager(QObject *parent)
 /*!
     Destroys this manager, and all the properties it has created.
 */
-QtBoolPropertyManager::~QtBoolPropertyManager()
+QtDoubleArrayPropertyManager::~QtDoubleArrayPropertyManager()
 {
     clear();
 }
 
 /*!
-    Returns the given \a property's value.
+    Returns the given \a property's values.
 
-    If the given \a property is not managed by \e this manager, this
-    function returns false.
+    The list is implicitly shared, so this function does not copy the
+    elements.
 
-    \sa setValue()
+    \sa setValues()
 */
-bool QtBoolPropertyManager::value(const QtProperty *property) const
+QList<double> QtDoubleArrayPropertyManager::values(const QtProperty *property) const
 {
-    return d_ptr->m_values.value(property, false);
+    return getValue<QList<double> >(d_ptr->m_values, property);
 }
 
 /*!
-    \reimp
+    Returns the number of elements of the given \a property.
 */
-QString QtBoolPropertyManager::valueText(const QtProperty *property) const
+int QtDoubleArrayPropertyManager::count(const QtProperty *property) const
 {
-    const QMap<const QtProperty *, bool>::const_iterator it = d_ptr->m_values.constFind(property);
-    if (it == d_ptr->m_values.constEnd())
-        return QString();
-
-    static const QString trueText = tr("True");
-    static const QString falseText = tr("False");
-    return it.value() ? trueText : falseText;
+    const auto it = d_ptr->m_values.constFind(property);
+    return it == d_ptr->m_values.constEnd() ? 0 : int(it.value().val.size());
 }
 
 /*!
-    \reimp
+    Returns the element at \a index of the given \a property, or 0 if
+    \a index is out of range.
+
+    \sa setValue()
 */
-QIcon QtBoolPropertyManager::valueIcon(const QtProperty *property) const
+double QtDoubleArrayPropertyManager::value(const QtProperty *property, int index) const
 {
-    const QMap<const QtProperty *, bool>::const_iterator it = d_ptr->m_values.constFind(property);
+    const auto it = d_ptr->m_values.constFind(property);
     if (it == d_ptr->m_values.constEnd())
-        return QIcon();
-
-    return it.value() ? d_ptr->m_checkedIcon : d_ptr->m_uncheckedIcon;
+        return 0.0;
+    return it.value().val.value(index, 0.0);
 }
 
 /*!
-    \fn void QtBoolPropertyManager::setValue(QtProperty *property, bool value)
-
-    Sets the value of the given \a property to \a value.
+    Returns the given \a property's minimum value.
 
-    \sa value()
+    \sa setMinimum(), maximum(), setRange()
 */
-void QtBoolPropertyManager::setValue(QtProperty *property, bool val)
+double QtDoubleArrayPropertyManager::minimum(const QtProperty *property) const
 {
-    setSimpleValue<bool, bool, QtBoolPropertyManager>(d_ptr->m_values, this,
-                &QtBoolPropertyManager::propertyChanged,
-                &QtBoolPropertyManager::valueChanged,
-                property, val);
+    return getMinimum<double>(d_ptr->m_values, property, 0.0);
 }
 
 /*!
-    \reimp
+    Returns the given \a property's maximum value.
+
+    \sa setMaximum(), minimum(), setRange()
 */
-void QtBoolPropertyManager::initializeProperty(QtProperty *property)
+double QtDoubleArrayPropertyManager::maximum(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = false;
+    return getMaximum<double>(d_ptr->m_values, property, 0.0);
 }
 
 /*!
-    \reimp
-*/
-void QtBoolPropertyManager::uninitializeProperty(QtProperty *property)
-{
-    d_ptr->m_values.remove(property);
-}
+    Returns the given \a property's precision, in decimals.
 
-// QtDatePropertyManager
-QtDatePropertyManagerPrivate::QtDatePropertyManagerPrivate(QtDatePropertyManager *q) :
-    q_ptr(q),
-    m_format(QtPropertyBrowserUtils::dateFormat())
+    \sa setDecimals()
+*/
+int QtDoubleArrayPropertyManager::decimals(const QtProperty *property) const
 {
+    return getData<int>(d_ptr->m_values, &QtDoubleArrayPropertyManagerPrivate::Data::decimals, property, 0);
 }
 
 /*!
-    \class QtDatePropertyManager
-    \internal
-    \inmodule QtDesigner
-    \since 4.4
-
-    \brief The QtDatePropertyManager provides and manages QDate properties.
-
-    A date property has a current value, and a range specifying the
-    valid dates. The range is defined by a minimum and a maximum
-    value.
-
-    The property's values can be retrieved using the minimum(),
-    maximum() and value() functions, and can be set using the
-    setMinimum(), setMaximum() and setValue() slots. Alternatively,
-    the range can be defined in one go using the setRange() slot.
-
-    In addition, QtDatePropertyManager provides the valueChanged() signal
-    which is emitted whenever a property created by this manager
-    changes, and the rangeChanged() signal which is emitted whenever
-    such a property changes its range of valid dates.
-
-    \sa QtAbstractPropertyManager, QtDateEditFactory, QtDateTimePropertyManager
+    \reimp
 */
+QString QtDoubleArrayPropertyManager::valueText(const QtProperty *property) const
+{
+    const auto it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    const int prec = it.value().decimals;
+    return arrayValueText(it.value().val, [prec](double v) { return QString::number(v, 'f', prec); });
+}
 
 /*!
-    \fn void QtDatePropertyManager::valueChanged(QtProperty *property, QDate value)
+    Replaces the values of the given \a property with \a vals.
 
-    This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the new
-    \a value as parameters.
+    Values outside the property's range are clamped.
 
-    \sa setValue()
+    \sa values(), valuesChanged()
 */
+void QtDoubleArrayPropertyManager::setValues(QtProperty *property, const QList<double> &vals)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setArrayValues<double>(this, d_ptr.data(), property, vals);
+}
 
 /*!
-    \fn void QtDatePropertyManager::rangeChanged(QtProperty *property, QDate minimum, QDate maximum)
-
-    This signal is emitted whenever a property created by this manager
-    changes its range of valid dates, passing a pointer to the \a
-    property and the new \a minimum and \a maximum dates.
-
-    \sa setRange()
-*/
+    Sets the element at \a index of the given \a property to \a val.
+    The size of the array is not changed, i.e. \a index must be valid.
 
-/*!
-    Creates a manager with the given \a parent.
+    \sa value(), valueChanged()
 */
-QtDatePropertyManager::QtDatePropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtDatePropertyManagerPrivate(this))
+void QtDoubleArrayPropertyManager::setValue(QtProperty *property, int index, double val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setArrayValue<double>(this, d_ptr.data(), property, index, val);
 }
 
 /*!
-    Destroys this manager, and all the properties it has created.
+    Sets the minimum value for the given \a property to \a minVal.
+
+    When setting the minimum value, the maximum value and the elements
+    are adjusted if necessary.
+
+    \sa minimum(), setRange(), rangeChanged()
 */
-QtDatePropertyManager::~QtDatePropertyManager()
+void QtDoubleArrayPropertyManager::setMinimum(QtProperty *property, double minVal)
 {
-    clear();
+    setRange(property, minVal, qMax(minVal, maximum(property)));
 }
 
 /*!
-    Returns the given \a property's value.
+    Sets the maximum value for the given \a property to \a maxVal.
 
-    If the given \a property is not managed by \e this manager, this
-    function returns an invalid date.
+    When setting the maximum value, the minimum value and the elements
+    are adjusted if necessary.
 
-    \sa setValue()
+    \sa maximum(), setRange(), rangeChanged()
 */
-QDate QtDatePropertyManager::value(const QtProperty *property) const
+void QtDoubleArrayPropertyManager::setMaximum(QtProperty *property, double maxVal)
 {
-    return getValue<QDate>(d_ptr->m_values, property);
+    setRange(property, qMin(minimum(property), maxVal), maxVal);
 }
 
 /*!
-    Returns the given \a  property's  minimum date.
+    Sets the range of valid values of the given \a property to
+    \a minVal - \a maxVal. Elements outside the new range are clamped.
 
-    \sa maximum(), setRange()
+    \sa setMinimum(), setMaximum(), rangeChanged()
 */
-QDate QtDatePropertyManager::minimum(const QtProperty *property) const
+void QtDoubleArrayPropertyManager::setRange(QtProperty *property, double minVal, double maxVal)
 {
-    return getMinimum<QDate>(d_ptr->m_values, property);
+    setArrayRange<double>(this, d_ptr.data(), property, minVal, maxVal);
 }
 
 /*!
-    Returns the given \a property's maximum date.
+    \fn void QtDoubleArrayPropertyManager::setDecimals(QtProperty *property, int prec)
 
-    \sa minimum(), setRange()
-*/
-QDate QtDatePropertyManager::maximum(const QtProperty *property) const
-{
-    return getMaximum<QDate>(d_ptr->m_values, property);
-}
+    Sets the precision of the given \a property to \a prec.
 
-/*!
-    \reimp
+    The valid decimal range is 0-13. The default is 2.
+
+    \sa decimals()
 */
-QString QtDatePropertyManager::valueText(const QtProperty *property) const
+void QtDoubleArrayPropertyManager::setDecimals(QtProperty *property, int prec)
 {
-    const QtDatePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
-    if (it == d_ptr->m_values.constEnd())
-        return QString();
-    return it.value().val.toString(d_ptr->m_format);
-}
+    const QtDoubleArrayPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
 
-/*!
-    \fn void QtDatePropertyManager::setValue(QtProperty *property, QDate value)
+    prec = qBound(0, prec, 13);
 
-    Sets the value of the given \a property to \a value.
+    if (it.value().decimals == prec)
+        return;
 
-    If the specified \a value is not a valid date according to the
-    given \a property's range, the value is adjusted to the nearest
-    valid value within the range.
+    it.value().decimals = prec;
 
-    \sa value(), setRange(), valueChanged()
-*/
-void QtDatePropertyManager::setValue(QtProperty *property, QDate val)
-{
-    void (QtDatePropertyManagerPrivate::*setSubPropertyValue)(QtProperty *, QDate) = 0;
-    setValueInRange<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, const QDate>(this, d_ptr.data(),
-                &QtDatePropertyManager::propertyChanged,
-                &QtDatePropertyManager::valueChanged,
-                property, val, setSubPropertyValue);
+    emit decimalsChanged(property, prec);
+    emit propertyChanged(property);
 }
 
 /*!
-    Sets the minimum value for the given \a property to \a minVal.
-
-    When setting the minimum value, the maximum and current values are
-    adjusted if necessary (ensuring that the range remains valid and
-    that the current value is within in the range).
-
-    \sa minimum(), setRange()
+    \reimp
 */
-void QtDatePropertyManager::setMinimum(QtProperty *property, QDate minVal)
+QVariant QtDoubleArrayPropertyManager::journalValue(const QtProperty *property) const
 {
-    setMinimumValue<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, QDate, QtDatePropertyManagerPrivate::Data>(this, d_ptr.data(),
-                &QtDatePropertyManager::propertyChanged,
-                &QtDatePropertyManager::valueChanged,
-                &QtDatePropertyManager::rangeChanged,
-                property, minVal);
+    return QVariant::fromValue(values(property));
 }
 
 /*!
-    Sets the maximum value for the given \a property to \a maxVal.
-
-    When setting the maximum value, the minimum and current
-    values are adjusted if necessary (ensuring that the range remains
-    valid and that the current value is within in the range).
-
-    \sa maximum(), setRange()
+    \reimp
 */
-void QtDatePropertyManager::setMaximum(QtProperty *property, QDate maxVal)
+void QtDoubleArrayPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
 {
-    setMaximumValue<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, QDate, QtDatePropertyManagerPrivate::Data>(this, d_ptr.data(),
-                &QtDatePropertyManager::propertyChanged,
-                &QtDatePropertyManager::valueChanged,
-                &QtDatePropertyManager::rangeChanged,
-                property, maxVal);
+    reportValueMemory(this, d_ptr->m_values, property, report);
 }
 
 /*!
-    \fn void QtDatePropertyManager::setRange(QtProperty *property, QDate minimum, QDate maximum)
-
-    Sets the range of valid dates.
-
-    This is a convenience function defining the range of valid dates
-    in one go; setting the \a minimum and \a maximum values for the
-    given \a property with a single function call.
-
-    When setting a new date range, the current value is adjusted if
-    necessary (ensuring that the value remains in date range).
-
-    \sa setMinimum(), setMaximum(), rangeChanged()
+    \reimp
 */
-void QtDatePropertyManager::setRange(QtProperty *property, QDate minVal, QDate maxVal)
+void QtDoubleArrayPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
 {
-    void (QtDatePropertyManagerPrivate::*setSubPropertyRange)(QtProperty *, QDate, QDate, QDate) = 0;
-    setBorderValues<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, QDate>(this, d_ptr.data(),
-                &QtDatePropertyManager::propertyChanged,
-                &QtDatePropertyManager::valueChanged,
-                &QtDatePropertyManager::rangeChanged,
-                property, minVal, maxVal, setSubPropertyRange);
+    setValues(property, value.value<QList<double> >());
 }
 
 /*!
     \reimp
 */
-void QtDatePropertyManager::initializeProperty(QtProperty *property)
+void QtDoubleArrayPropertyManager::initializeProperty(QtProperty *property)
 {
-    d_ptr->m_values[property] = QtDatePropertyManagerPrivate::Data();
+    d_ptr->m_values[property] = QtDoubleArrayPropertyManagerPrivate::Data();
 }
 
 /*!
     \reimp
 */
-void QtDatePropertyManager::uninitializeProperty(QtProperty *property)
+void QtDoubleArrayPropertyManager::uninitializeProperty(QtProperty *property)
 {
     d_ptr->m_values.remove(property);
 }
 
-// QtTimePropertyManager
-QtTimePropertyManagerPrivate::QtTimePropertyManagerPrivate(QtTimePropertyManager *q) :
-    q_ptr(q),
-    m_format(QtPropertyBrowserUtils::timeFormat())
+// Range kernels shared by QtIntRangePropertyManager and QtDoubleRangePropertyManager.
+template <class Value, class PropertyManagerPrivate, class PropertyManager>
+static void setRangeValues(PropertyManager *manager, PropertyManagerPrivate *managerPrivate,
+            QtProperty *property, Value minVal, Value maxVal)
+{
+    const auto it = managerPrivate->m_values.find(property);
+    if (it == managerPrivate->m_values.end())
+        return;
+
+    auto &data = it.value();
+
+    orderBorders(minVal, maxVal);
+    minVal = qBound(data.minVal, minVal, data.maxVal);
+    maxVal = qBound(data.minVal, maxVal, data.maxVal);
+
+    if (data.lowerVal == minVal && data.upperVal == maxVal)
+        return;
+
+    data.lowerVal = minVal;
+    data.upperVal = maxVal;
+
+    emit manager->propertyChanged(property);
+    emit manager->valueChanged(property, data.lowerVal, data.upperVal);
+}
+
+template <class Value, class PropertyManagerPrivate, class PropertyManager>
+static void setRangeBorders(PropertyManager *manager, PropertyManagerPrivate *managerPrivate,
+            QtProperty *property, Value minVal, Value maxVal)
 {
+    const auto it = managerPrivate->m_values.find(property);
+    if (it == managerPrivate->m_values.end())
+        return;
+
+    auto &data = it.value();
+
+    orderBorders(minVal, maxVal);
+    if (data.minVal == minVal && data.maxVal == maxVal)
+        return;
+
+    data.minVal = minVal;
+    data.maxVal = maxVal;
+
+    emit manager->rangeChanged(property, data.minVal, data.maxVal);
+
+    const Value lowerVal = qBound(data.minVal, data.lowerVal, data.maxVal);
+    const Value upperVal = qBound(data.minVal, data.upperVal, data.maxVal);
+    if (data.lowerVal == lowerVal && data.upperVal == upperVal)
+        return;
+
+    data.lowerVal = lowerVal;
+    data.upperVal = upperVal;
+
+    emit manager->propertyChanged(property);
+    emit manager->valueChanged(property, data.lowerVal, data.upperVal);
 }
 
+// QtIntRangePropertyManager
 /*!
-    \class QtTimePropertyManager
+    \class QtIntRangePropertyManager
     \internal
     \inmodule QtDesigner
-    \since 4.4
 
-    \brief The QtTimePropertyManager provides and manages QTime properties.
+    \brief The QtIntRangePropertyManager provides and manages properties
+    holding a pair of int values, e.g. a threshold window.
 
-    A time property's value can be retrieved using the value()
-    function, and set using the setValue() slot.
+    A range property has a minimum value and a maximum value, which
+    are always stored and changed together. They can be retrieved
+    using the minimumValue() and maximumValue() functions, and set
+    using the setValues() slot; setMinimumValue() and
+    setMaximumValue() change only one end.
 
-    In addition, QtTimePropertyManager provides the valueChanged() signal
-    which is emitted whenever a property created by this manager
-    changes.
+    Both values are restricted to the range of valid values, defined
+    by a minimum and a maximum and retrieved using the minimum() and
+    maximum() functions. The valid range can be set using the
+    setMinimum(), setMaximum() and setRange() slots. The value
+    returned by minimumValue() is never greater than the one returned
+    by maximumValue().
 
-    \sa QtAbstractPropertyManager, QtTimeEditFactory
+    In addition, QtIntRangePropertyManager provides the valueChanged()
+    signal which is emitted once whenever either value changes, the
+    rangeChanged() signal which is emitted whenever the valid range
+    changes, and the singleStepChanged() signal.
+
+    \sa QtAbstractPropertyManager, QtIntRangeEditorFactory, QtDoubleRangePropertyManager
 */
 
 /*!
-    \fn void QtTimePropertyManager::valueChanged(QtProperty *property, QTime value)
+    \fn void QtIntRangePropertyManager::valueChanged(QtProperty *property, int minimumValue, int maximumValue)
 
     This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the
-    new \a value as parameters.
+    changes its value pair, passing a pointer to the \a property and
+    the new \a minimumValue and \a maximumValue as parameters.
 
-    \sa setValue()
+    \sa setValues()
+*/
+
+/*!
+    \fn void QtIntRangePropertyManager::rangeChanged(QtProperty *property, int minimum, int maximum)
+
+    This signal is emitted whenever a property created by this manager
+    changes its range of valid values, passing a pointer to the
+    \a property and the new \a minimum and \a maximum values.
+
+    \sa setRange()
+*/
+
+/*!
+    \fn void QtIntRangePropertyManager::singleStepChanged(QtProperty *property, int step)
+
+    This signal is emitted whenever a property created by this manager
+    changes its single step property, passing a pointer to the
+    \a property and the new \a step value
+
+    \sa setSingleStep()
 */
 
 /*!
     Creates a manager with the given \a parent.
 */
-QtTimePropertyManager::QtTimePropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtTimePropertyManagerPrivate(this))
+QtIntRangePropertyManager::QtIntRangePropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtIntRangePropertyManagerPrivate)
 {
+    d_ptr->q_ptr = this;
 }
 
 /*!
     Destroys this manager, and all the properties it has created.
 */
-QtTimePropertyManager::~QtTimePropertyManager()
+QtIntRangePropertyManager::~QtIntRangePropertyManager()
 {
     clear();
 }
 
 /*!
-    Returns the given \a property's value.
+    Returns the lower end of the given \a property's value pair.
 
     If the given property is not managed by this manager, this
-    function returns an invalid time object.
+    function returns 0.
 
-    \sa setValue()
+    \sa maximumValue(), setValues()
 */
-QTime QtTimePropertyManager::value(const QtProperty *property) const
+int QtIntRangePropertyManager::minimumValue(const QtProperty *property) const
 {
-    return d_ptr->m_values.value(property, QTime());
+    return getData<int>(d_ptr->m_values, &QtIntRangePropertyManagerPrivate::Data::lowerVal, property, 0);
 }
 
 /*!
-    \reimp
+    Returns the upper end of the given \a property's value pair.
+
+    If the given property is not managed by this manager, this
+    function returns 0.
+
+    \sa minimumValue(), setValues()
 */
-QString QtTimePropertyManager::valueText(const QtProperty *property) const
+int QtIntRangePropertyManager::maximumValue(const QtProperty *property) const
 {
-   const QtTimePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
-    if (it == d_ptr->m_values.constEnd())
-        return QString();
-    return it.value().toString(d_ptr->m_format);
+    return getData<int>(d_ptr->m_values, &QtIntRangePropertyManagerPrivate::Data::upperVal, property, 0);
 }
 
 /*!
-    \fn void QtTimePropertyManager::setValue(QtProperty *property, QTime value)
-
-    Sets the value of the given \a property to \a value.
+    Returns the given \a property's minimum valid value.
 
-    \sa value(), valueChanged()
+    \sa setMinimum(), maximum(), setRange()
 */
-void QtTimePropertyManager::setValue(QtProperty *property, QTime val)
+int QtIntRangePropertyManager::minimum(const QtProperty *property) const
 {
-    setSimpleValue<QTime, QTime, QtTimePropertyManager>(d_ptr->m_values, this,
-                &QtTimePropertyManager::propertyChanged,
-                &QtTimePropertyManager::valueChanged,
-                property, val);
+    return getMinimum<int>(d_ptr->m_values, property, 0);
 }
 
 /*!
-    \reimp
+    Returns the given \a property's maximum valid value.
+
+    \sa setMaximum(), minimum(), setRange()
 */
-void QtTimePropertyManager::initializeProperty(QtProperty *property)
+int QtIntRangePropertyManager::maximum(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = QTime::currentTime();
+    return getMaximum<int>(d_ptr->m_values, property, 0);
 }
 
 /*!
-    \reimp
+    Returns the given \a property's step value.
+
+    The step is typically used to increment or decrement a property value while pressing an arrow key.
+
+    \sa setSingleStep()
 */
-void QtTimePropertyManager::uninitializeProperty(QtProperty *property)
+int QtIntRangePropertyManager::singleStep(const QtProperty *property) const
 {
-    d_ptr->m_values.remove(property);
+    return getData<int>(d_ptr->m_values, &QtIntRangePropertyManagerPrivate::Data::singleStep, property, 0);
 }
 
-// QtDateTimePropertyManager
-
-
-
-QtDateTimePropertyManagerPrivate::QtDateTimePropertyManagerPrivate(QtDateTimePropertyManager *q) :
-    q_ptr(q),
-    m_format(QtPropertyBrowserUtils::dateTimeFormat())
+/*!
+    \reimp
+*/
+QString QtIntRangePropertyManager::valueText(const QtProperty *property) const
 {
+    const auto it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("[%1, %2]"));
+    return text({it.value().lowerVal, it.value().upperVal});
 }
 
-/*! \class QtDateTimePropertyManager
-    \internal
-    \inmodule QtDesigner
-    \since 4.4
-
-    \brief The QtDateTimePropertyManager provides and manages QDateTime properties.
+/*!
+    Sets the value pair of the given \a property to \a minVal and
+    \a maxVal, swapping them if \a minVal is greater than \a maxVal.
 
-    A date and time property has a current value which can be
-    retrieved using the value() function, and set using the setValue()
-    slot. In addition, QtDateTimePropertyManager provides the
-    valueChanged() signal which is emitted whenever a property created
-    by this manager changes.
+    Both values are adjusted to the property's range of valid values
+    if necessary. The valueChanged() signal is emitted once, even if
+    both values change.
 
-    \sa QtAbstractPropertyManager, QtDateTimeEditFactory, QtDatePropertyManager
+    \sa minimumValue(), maximumValue(), setRange(), valueChanged()
 */
+void QtIntRangePropertyManager::setValues(QtProperty *property, int minVal, int maxVal)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setRangeValues<int>(this, d_ptr.data(), property, minVal, maxVal);
+}
 
 /*!
-    \fn void QtDateTimePropertyManager::valueChanged(QtProperty *property, const QDateTime &value)
+    Sets the lower end of the given \a property's value pair to
+    \a minVal, which is adjusted so that it does not exceed the
+    upper end.
 
-    This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the new
-    \a value as parameters.
+    \sa minimumValue(), setValues()
 */
+void QtIntRangePropertyManager::setMinimumValue(QtProperty *property, int minVal)
+{
+    const int maxVal = maximumValue(property);
+    setValues(property, qMin(minVal, maxVal), maxVal);
+}
 
 /*!
-    Creates a manager with the given \a parent.
+    Sets the upper end of the given \a property's value pair to
+    \a maxVal, which is adjusted so that it is not less than the
+    lower end.
+
+    \sa maximumValue(), setValues()
 */
-QtDateTimePropertyManager::QtDateTimePropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtDateTimePropertyManagerPrivate(this))
+void QtIntRangePropertyManager::setMaximumValue(QtProperty *property, int maxVal)
 {
+    const int minVal = minimumValue(property);
+    setValues(property, minVal, qMax(minVal, maxVal));
 }
 
 /*!
-    Destroys this manager, and all the properties it has created.
+    Sets the minimum valid value for the given \a property to \a minVal.
+
+    When setting the minimum value, the maximum and the value pair
+    are adjusted if necessary.
+
+    \sa minimum(), setRange(), rangeChanged()
 */
-QtDateTimePropertyManager::~QtDateTimePropertyManager()
+void QtIntRangePropertyManager::setMinimum(QtProperty *property, int minVal)
 {
-    clear();
+    setRange(property, minVal, qMax(minVal, maximum(property)));
 }
 
 /*!
-    Returns the given \a property's value.
+    Sets the maximum valid value for the given \a property to \a maxVal.
 
-    If the given \a property is not managed by this manager, this
-    function returns an invalid QDateTime object.
+    When setting the maximum value, the minimum and the value pair
+    are adjusted if necessary.
 
-    \sa setValue()
+    \sa maximum(), setRange(), rangeChanged()
 */
-QDateTime QtDateTimePropertyManager::value(const QtProperty *property) const
+void QtIntRangePropertyManager::setMaximum(QtProperty *property, int maxVal)
 {
-    return d_ptr->m_values.value(property, QDateTime());
+    setRange(property, qMin(minimum(property), maxVal), maxVal);
 }
 
 /*!
-    \reimp
+    Sets the range of valid values of the given \a property to
+    \a minVal - \a maxVal. Values outside the new range are adjusted.
+
+    \sa setMinimum(), setMaximum(), rangeChanged()
 */
-QString QtDateTimePropertyManager::valueText(const QtProperty *property) const
+void QtIntRangePropertyManager::setRange(QtProperty *property, int minVal, int maxVal)
 {
-   const QtDateTimePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
-    if (it == d_ptr->m_values.constEnd())
-        return QString();
-    return it.value().toString(d_ptr->m_format);
+    setRangeBorders<int>(this, d_ptr.data(), property, minVal, maxVal);
 }
 
 /*!
-    \fn void QtDateTimePropertyManager::setValue(QtProperty *property, const QDateTime &value)
+    Sets the step value for the given \a property to \a step.
 
-    Sets the value of the given \a property to \a value.
+    The step is typically used to increment or decrement a property value while pressing an arrow key.
 
-    \sa value(), valueChanged()
+    \sa singleStep()
 */
-void QtDateTimePropertyManager::setValue(QtProperty *property, const QDateTime &val)
+void QtIntRangePropertyManager::setSingleStep(QtProperty *property, int step)
 {
-    setSimpleValue<const QDateTime &, QDateTime, QtDateTimePropertyManager>(d_ptr->m_values, this,
-                &QtDateTimePropertyManager::propertyChanged,
-                &QtDateTimePropertyManager::valueChanged,
-                property, val);
+    const QtIntRangePropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    if (step < 0)
+        step = 0;
+
+    if (it.value().singleStep == step)
+        return;
+
+    it.value().singleStep = step;
+
+    emit singleStepChanged(property, step);
 }
 
 /*!
     \reimp
 */
-void QtDateTimePropertyManager::initializeProperty(QtProperty *property)
+QVariant QtIntRangePropertyManager::journalValue(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = QDateTime::currentDateTime();
+    return QVariantList({minimumValue(property), maximumValue(property)});
 }
 
 /*!
     \reimp
 */
-void QtDateTimePropertyManager::uninitializeProperty(QtProperty *property)
+void QtIntRangePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtIntRangePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    const QVariantList values = value.toList();
+    if (values.size() == 2)
+        setValues(property, values.at(0).toInt(), values.at(1).toInt());
+}
+
+/*!
+    \reimp
+*/
+void QtIntRangePropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QtIntRangePropertyManagerPrivate::Data();
+}
+
+/*!
+    \reimp
+*/
+void QtIntRangePropertyManager::uninitializeProperty(QtProperty *property)
 {
     d_ptr->m_values.remove(property);
 }
 
-// QtKeySequencePropertyManager
-/*! \class QtKeySequencePropertyManager
+// QtDoubleRangePropertyManager
+/*!
+    \class QtDoubleRangePropertyManager
     \internal
     \inmodule QtDesigner
-    \since 4.4
 
-    \brief The QtKeySequencePropertyManager provides and manages QKeySequence properties.
+    \brief The QtDoubleRangePropertyManager provides and manages properties
+    holding a pair of double values, e.g. a time window.
 
-    A key sequence's value can be retrieved using the value()
-    function, and set using the setValue() slot.
+    A range property has a minimum value and a maximum value, which
+    are always stored and changed together. They can be retrieved
+    using the minimumValue() and maximumValue() functions, and set
+    using the setValues() slot; setMinimumValue() and
+    setMaximumValue() change only one end.
 
-    In addition, QtKeySequencePropertyManager provides the valueChanged() signal
-    which is emitted whenever a property created by this manager
-    changes.
+    Both values are restricted to the range of valid values, defined
+    by a minimum and a maximum and retrieved using the minimum() and
+    maximum() functions. The valid range can be set using the
+    setMinimum(), setMaximum() and setRange() slots. The precision of
+    the displayed values is given by decimals().
 
-    \sa QtAbstractPropertyManager
+    In addition, QtDoubleRangePropertyManager provides the
+    valueChanged() signal which is emitted once whenever either value
+    changes, the rangeChanged() signal which is emitted whenever the
+    valid range changes, as well as the singleStepChanged() and
+    decimalsChanged() signals.
+
+    \sa QtAbstractPropertyManager, QtDoubleRangeEditorFactory, QtIntRangePropertyManager
 */
 
 /*!
-    \fn void QtKeySequencePropertyManager::valueChanged(QtProperty *property, const QKeySequence &value)
+    \fn void QtDoubleRangePropertyManager::valueChanged(QtProperty *property, double minimumValue, double maximumValue)
 
     This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the new
-    \a value as parameters.
+    changes its value pair, passing a pointer to the \a property and
+    the new \a minimumValue and \a maximumValue as parameters.
+
+    \sa setValues()
+*/
+
+/*!
+    \fn void QtDoubleRangePropertyManager::rangeChanged(QtProperty *property, double minimum, double maximum)
+
+    This signal is emitted whenever a property created by this manager
+    changes its range of valid values, passing a pointer to the
+    \a property and the new \a minimum and \a maximum values.
+
+    \sa setRange()
+*/
+
+/*!
+    \fn void QtDoubleRangePropertyManager::singleStepChanged(QtProperty *property, double step)
+
+    This signal is emitted whenever a property created by this manager
+    changes its single step property, passing a pointer to the
+    \a property and the new \a step value
+
+    \sa setSingleStep()
+*/
+
+/*!
+    \fn void QtDoubleRangePropertyManager::decimalsChanged(QtProperty *property, int prec)
+
+    This signal is emitted whenever a property created by this manager
+    changes its precision of value, passing a pointer to the
+    \a property and the new \a prec value
+
+    \sa setDecimals()
 */
 
 /*!
     Creates a manager with the given \a parent.
 */
-QtKeySequencePropertyManager::QtKeySequencePropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtKeySequencePropertyManagerPrivate)
+QtDoubleRangePropertyManager::QtDoubleRangePropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtDoubleRangePropertyManagerPrivate)
 {
     d_ptr->q_ptr = this;
 }
@@ -1791,226 +2403,408 @@ QtKeySequencePropertyManager::QtKeySequencePropertyManager(QObject *parent)
 /*!
     Destroys this manager, and all the properties it has created.
 */
-QtKeySequencePropertyManager::~QtKeySequencePropertyManager()
+QtDoubleRangePropertyManager::~QtDoubleRangePropertyManager()
 {
     clear();
 }
 
 /*!
-    Returns the given \a property's value.
+    Returns the lower end of the given \a property's value pair.
 
-    If the given \a property is not managed by this manager, this
-    function returns an empty QKeySequence object.
+    If the given property is not managed by this manager, this
+    function returns 0.
 
-    \sa setValue()
+    \sa maximumValue(), setValues()
 */
-QKeySequence QtKeySequencePropertyManager::value(const QtProperty *property) const
+double QtDoubleRangePropertyManager::minimumValue(const QtProperty *property) const
 {
-    return d_ptr->m_values.value(property, QKeySequence());
+    return getData<double>(d_ptr->m_values, &QtDoubleRangePropertyManagerPrivate::Data::lowerVal, property, 0.0);
 }
 
 /*!
-    \reimp
+    Returns the upper end of the given \a property's value pair.
+
+    If the given property is not managed by this manager, this
+    function returns 0.
+
+    \sa minimumValue(), setValues()
 */
-QString QtKeySequencePropertyManager::valueText(const QtProperty *property) const
+double QtDoubleRangePropertyManager::maximumValue(const QtProperty *property) const
 {
-    const QtKeySequencePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
-    if (it == d_ptr->m_values.constEnd())
-        return QString();
-    return it.value().toString(QKeySequence::NativeText);
+    return getData<double>(d_ptr->m_values, &QtDoubleRangePropertyManagerPrivate::Data::upperVal, property, 0.0);
 }
 
 /*!
-    \fn void QtKeySequencePropertyManager::setValue(QtProperty *property, const QKeySequence &value)
+    Returns the given \a property's minimum valid value.
 
-    Sets the value of the given \a property to \a value.
+    \sa setMinimum(), maximum(), setRange()
+*/
+double QtDoubleRangePropertyManager::minimum(const QtProperty *property) const
+{
+    return getMinimum<double>(d_ptr->m_values, property, 0.0);
+}
 
-    \sa value(), valueChanged()
+/*!
+    Returns the given \a property's maximum valid value.
+
+    \sa setMaximum(), minimum(), setRange()
 */
-void QtKeySequencePropertyManager::setValue(QtProperty *property, const QKeySequence &val)
+double QtDoubleRangePropertyManager::maximum(const QtProperty *property) const
 {
-    setSimpleValue<const QKeySequence &, QKeySequence, QtKeySequencePropertyManager>(d_ptr->m_values, this,
-                &QtKeySequencePropertyManager::propertyChanged,
-                &QtKeySequencePropertyManager::valueChanged,
-                property, val);
+    return getMaximum<double>(d_ptr->m_values, property, 0.0);
 }
 
 /*!
-    \reimp
+    Returns the given \a property's step value.
+
+    The step is typically used to increment or decrement a property value while pressing an arrow key.
+
+    \sa setSingleStep()
 */
-void QtKeySequencePropertyManager::initializeProperty(QtProperty *property)
+double QtDoubleRangePropertyManager::singleStep(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = QKeySequence();
+    return getData<double>(d_ptr->m_values, &QtDoubleRangePropertyManagerPrivate::Data::singleStep, property, 0);
+}
+
+/*!
+    Returns the given \a property's precision, in decimals.
+
+    \sa setDecimals()
+*/
+int QtDoubleRangePropertyManager::decimals(const QtProperty *property) const
+{
+    return getData<int>(d_ptr->m_values, &QtDoubleRangePropertyManagerPrivate::Data::decimals, property, 0);
 }
 
 /*!
     \reimp
 */
-void QtKeySequencePropertyManager::uninitializeProperty(QtProperty *property)
+QString QtDoubleRangePropertyManager::valueText(const QtProperty *property) const
 {
-    d_ptr->m_values.remove(property);
+    const auto it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    const int prec = it.value().decimals;
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("[%1, %2]"));
+    return text({it.value().lowerVal, it.value().upperVal}, prec);
 }
 
-// QtCharPropertyManager
-/*! \class QtCharPropertyManager
-    \internal
-    \inmodule QtDesigner
-    \since 4.4
+/*!
+    Sets the value pair of the given \a property to \a minVal and
+    \a maxVal, swapping them if \a minVal is greater than \a maxVal.
 
-    \brief The QtCharPropertyManager provides and manages QChar properties.
+    Both values are adjusted to the property's range of valid values
+    if necessary. The valueChanged() signal is emitted once, even if
+    both values change.
 
-    A char's value can be retrieved using the value()
-    function, and set using the setValue() slot.
+    \sa minimumValue(), maximumValue(), setRange(), valueChanged()
+*/
+void QtDoubleRangePropertyManager::setValues(QtProperty *property, double minVal, double maxVal)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setRangeValues<double>(this, d_ptr.data(), property, minVal, maxVal);
+}
 
-    In addition, QtCharPropertyManager provides the valueChanged() signal
-    which is emitted whenever a property created by this manager
-    changes.
+/*!
+    Sets the lower end of the given \a property's value pair to
+    \a minVal, which is adjusted so that it does not exceed the
+    upper end.
 
-    \sa QtAbstractPropertyManager
+    \sa minimumValue(), setValues()
 */
+void QtDoubleRangePropertyManager::setMinimumValue(QtProperty *property, double minVal)
+{
+    const double maxVal = maximumValue(property);
+    setValues(property, qMin(minVal, maxVal), maxVal);
+}
 
 /*!
-    \fn void QtCharPropertyManager::valueChanged(QtProperty *property, const QChar &value)
+    Sets the upper end of the given \a property's value pair to
+    \a maxVal, which is adjusted so that it is not less than the
+    lower end.
 
-    This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the new
-    \a value as parameters.
+    \sa maximumValue(), setValues()
 */
+void QtDoubleRangePropertyManager::setMaximumValue(QtProperty *property, double maxVal)
+{
+    const double minVal = minimumValue(property);
+    setValues(property, minVal, qMax(minVal, maxVal));
+}
 
 /*!
-    Creates a manager with the given \a parent.
+    Sets the minimum valid value for the given \a property to \a minVal.
+
+    When setting the minimum value, the maximum and the value pair
+    are adjusted if necessary.
+
+    \sa minimum(), setRange(), rangeChanged()
 */
-QtCharPropertyManager::QtCharPropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtCharPropertyManagerPrivate)
+void QtDoubleRangePropertyManager::setMinimum(QtProperty *property, double minVal)
 {
-    d_ptr->q_ptr = this;
+    setRange(property, minVal, qMax(minVal, maximum(property)));
 }
 
 /*!
-    Destroys this manager, and all the properties it has created.
+    Sets the maximum valid value for the given \a property to \a maxVal.
+
+    When setting the maximum value, the minimum and the value pair
+    are adjusted if necessary.
+
+    \sa maximum(), setRange(), rangeChanged()
 */
-QtCharPropertyManager::~QtCharPropertyManager()
+void QtDoubleRangePropertyManager::setMaximum(QtProperty *property, double maxVal)
 {
-    clear();
+    setRange(property, qMin(minimum(property), maxVal), maxVal);
 }
 
 /*!
-    Returns the given \a property's value.
+    Sets the range of valid values of the given \a property to
+    \a minVal - \a maxVal. Values outside the new range are adjusted.
 
-    If the given \a property is not managed by this manager, this
-    function returns an null QChar object.
-
-    \sa setValue()
+    \sa setMinimum(), setMaximum(), rangeChanged()
 */
-QChar QtCharPropertyManager::value(const QtProperty *property) const
+void QtDoubleRangePropertyManager::setRange(QtProperty *property, double minVal, double maxVal)
 {
-    return d_ptr->m_values.value(property, QChar());
+    setRangeBorders<double>(this, d_ptr.data(), property, minVal, maxVal);
 }
 
 /*!
-    \reimp
+    Sets the step value for the given \a property to \a step.
+
+    The step is typically used to increment or decrement a property value while pressing an arrow key.
+
+    \sa singleStep()
 */
-QString QtCharPropertyManager::valueText(const QtProperty *property) const
+void QtDoubleRangePropertyManager::setSingleStep(QtProperty *property, double step)
 {
-   const QtCharPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
-    if (it == d_ptr->m_values.constEnd())
-        return QString();
-    const QChar c = it.value();
-    return c.isNull() ? QString() : QString(c);
+    const QtDoubleRangePropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    if (step < 0)
+        step = 0;
+
+    if (it.value().singleStep == step)
+        return;
+
+    it.value().singleStep = step;
+
+    emit singleStepChanged(property, step);
 }
 
 /*!
-    \fn void QtCharPropertyManager::setValue(QtProperty *property, const QChar &value)
+    \fn void QtDoubleRangePropertyManager::setDecimals(QtProperty *property, int prec)
 
-    Sets the value of the given \a property to \a value.
+    Sets the precision of the given \a property to \a prec.
 
-    \sa value(), valueChanged()
+    The valid decimal range is 0-13. The default is 2.
+
+    \sa decimals()
 */
-void QtCharPropertyManager::setValue(QtProperty *property, const QChar &val)
+void QtDoubleRangePropertyManager::setDecimals(QtProperty *property, int prec)
 {
-    setSimpleValue<const QChar &, QChar, QtCharPropertyManager>(d_ptr->m_values, this,
-                &QtCharPropertyManager::propertyChanged,
-                &QtCharPropertyManager::valueChanged,
-                property, val);
+    const QtDoubleRangePropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    prec = qBound(0, prec, 13);
+
+    if (it.value().decimals == prec)
+        return;
+
+    it.value().decimals = prec;
+
+    emit decimalsChanged(property, prec);
+    emit propertyChanged(property);
 }
 
 /*!
     \reimp
 */
-void QtCharPropertyManager::initializeProperty(QtProperty *property)
+QVariant QtDoubleRangePropertyManager::journalValue(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = QChar();
+    return QVariantList({minimumValue(property), maximumValue(property)});
 }
 
 /*!
     \reimp
 */
-void QtCharPropertyManager::uninitializeProperty(QtProperty *property)
+void QtDoubleRangePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
 {
-    d_ptr->m_values.remove(property);
+    reportValueMemory(this, d_ptr->m_values, property, report);
 }
 
-// QtLocalePropertyManager
-QtLocalePropertyManagerPrivate::QtLocalePropertyManagerPrivate()
+/*!
+    \reimp
+*/
+void QtDoubleRangePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
 {
+    const QVariantList values = value.toList();
+    if (values.size() == 2)
+        setValues(property, values.at(0).toDouble(), values.at(1).toDouble());
 }
 
-void QtLocalePropertyManagerPrivate::slotEnumChanged(QtProperty *property, int value)
+/*!
+    \reimp
+*/
+void QtDoubleRangePropertyManager::initializeProperty(QtProperty *property)
 {
-    if (QtProperty *prop = m_languageToProperty.value(property, 0)) {
-        const QLocale loc = m_values[prop];
-        QLocale::Language newLanguage = loc.language();
-        QLocale::Country newCountry = loc.country();
-        metaEnumProvider()->indexToLocale(value, 0, &newLanguage, 0);
-        QLocale newLoc(newLanguage, newCountry);
-        q_ptr->setValue(prop, newLoc);
-    } else if (QtProperty *prop = m_countryToProperty.value(property, 0)) {
-        const QLocale loc = m_values[prop];
-        QLocale::Language newLanguage = loc.language();
-        QLocale::Country newCountry = loc.country();
-        metaEnumProvider()->indexToLocale(m_enumPropertyManager->value(m_propertyToLanguage.value(prop)), value, &newLanguage, &newCountry);
-        QLocale newLoc(newLanguage, newCountry);
-        q_ptr->setValue(prop, newLoc);
-    }
+    d_ptr->m_values[property] = QtDoubleRangePropertyManagerPrivate::Data();
 }
 
-void QtLocalePropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
+/*!
+    \reimp
+*/
+void QtDoubleRangePropertyManager::uninitializeProperty(QtProperty *property)
 {
-    if (QtProperty *subProp = m_languageToProperty.value(property, 0)) {
-        m_propertyToLanguage[subProp] = 0;
-        m_languageToProperty.remove(property);
-    } else if (QtProperty *subProp = m_countryToProperty.value(property, 0)) {
-        m_propertyToCountry[subProp] = 0;
-        m_countryToProperty.remove(property);
+    d_ptr->m_values.remove(property);
+}
+
+// Shares one instance of each distinct pattern between all string
+// properties. Copies of a QRegularExpression share its compiled and
+// JIT-optimized form, so the pattern is only compiled for the first
+// property using it. Only accessed from the GUI thread.
+class QtRegularExpressionCache
+{
+public:
+    static QRegularExpression acquire(const QRegularExpression &regExp)
+    {
+        if (regExp.pattern().isEmpty())
+            return regExp;
+        Entry &entry = entries()[keyOf(regExp)];
+        if (entry.refCount++ == 0) {
+            entry.regExp = regExp;
+            entry.regExp.optimize();
+        }
+        return entry.regExp;
+    }
+
+    static void release(const QRegularExpression &regExp)
+    {
+        if (regExp.pattern().isEmpty())
+            return;
+        const auto it = entries().find(keyOf(regExp));
+        if (it != entries().end() && --it.value().refCount == 0)
+            entries().erase(it);
+    }
+
+private:
+    typedef QPair<QString, int> Key;
+    struct Entry
+    {
+        QRegularExpression regExp;
+        int refCount{0};
+    };
+
+    static Key keyOf(const QRegularExpression &regExp)
+    {
+        return Key(regExp.pattern(), int(regExp.patternOptions().toInt()));
+    }
+
+    static QHash<Key, Entry> &entries()
+    {
+        static QHash<Key, Entry> cache;
+        return cache;
+    }
+};
+
+// A match running on a worker thread. The job is cancelled and the
+// manager pointer reset when the result is no longer wanted.
+struct QtStringValidationJob
+{
+    QAtomicInt cancelled;
+    QMutex mutex;
+    QtStringPropertyManager *manager{nullptr};
+    QString value;
+};
+
+void QtStringPropertyManagerPrivate::startValidation(QtProperty *property, Data &data, const QString &val)
+{
+    QSharedPointer<QtStringValidationJob> job(new QtStringValidationJob);
+    job->manager = q_ptr;
+    job->value = val;
+    data.validationJob = job;
+    const QRegularExpression regExp = data.regExp;
+    QThreadPool::globalInstance()->start([job, regExp, property]() {
+        // Jobs superseded while waiting in the pool skip the match.
+        if (job->cancelled.loadAcquire())
+            return;
+        const bool matched = regExp.match(job->value).hasMatch();
+        QMutexLocker locker(&job->mutex);
+        if (!job->manager)
+            return;
+        QtStringPropertyManager *manager = job->manager;
+        QMetaObject::invokeMethod(manager, [manager, property, job, matched]() {
+            manager->d_func()->validationFinished(property, job, matched);
+        }, Qt::QueuedConnection);
+    });
+}
+
+bool QtStringPropertyManagerPrivate::cancelValidation(Data &data)
+{
+    if (!data.validationJob)
+        return false;
+    data.validationJob->cancelled.storeRelease(1);
+    QMutexLocker locker(&data.validationJob->mutex);
+    data.validationJob->manager = nullptr;
+    locker.unlock();
+    data.validationJob.reset();
+    return true;
+}
+
+void QtStringPropertyManagerPrivate::validationFinished(QtProperty *property,
+            const QSharedPointer<QtStringValidationJob> &job, bool matched)
+{
+    const PropertyValueMap::iterator it = m_values.find(property);
+    if (it == m_values.end() || it.value().validationJob != job)
+        return;
+
+    it.value().validationJob.reset();
+    const bool changed = matched && it.value().val != job->value;
+    if (changed)
+        it.value().val = job->value;
+
+    if (changed) {
+        emit q_ptr->propertyChanged(property);
+        emit q_ptr->valueChanged(property, job->value);
     }
+    emit q_ptr->validationPendingChanged(property, false);
 }
 
+// QtStringPropertyManager
 /*!
-    \class QtLocalePropertyManager
+    \class QtStringPropertyManager
     \internal
     \inmodule QtDesigner
     \since 4.4
 
-    \brief The QtLocalePropertyManager provides and manages QLocale properties.
+    \brief The QtStringPropertyManager provides and manages QString properties.
 
-    A locale property has nested \e language and \e country
-    subproperties. The top-level property's value can be retrieved
-    using the value() function, and set using the setValue() slot.
+    A string property's value can be retrieved using the value()
+    function, and set using the setValue() slot.
 
-    The subproperties are created by QtEnumPropertyManager object.
-    These submanager can be retrieved using the subEnumPropertyManager()
-    function. In order to provide editing widgets for the subproperties
-    in a property browser widget, this manager must be associated with editor factory.
+    The current value can be checked against a regular expression. To
+    set the regular expression use the setRegExp() slot, use the
+    regExp() function to retrieve the currently set expression.
 
-    In addition, QtLocalePropertyManager provides the valueChanged()
-    signal which is emitted whenever a property created by this
-    manager changes.
+    Properties using the same pattern share one compiled expression.
+    Values at least asyncValidationThreshold() characters long are
+    matched on a worker thread: setValue() returns at once, and the
+    value changes when the match succeeds. isValidationPending() tells
+    whether such a check is running.
 
-    \sa QtAbstractPropertyManager, QtEnumPropertyManager
+    In addition, QtStringPropertyManager provides the valueChanged() signal
+    which is emitted whenever a property created by this manager
+    changes, the regExpChanged() signal which is emitted whenever
+    such a property changes its currently set regular expression, and
+    the validationPendingChanged() signal which is emitted when a
+    background check starts or ends.
+
+    \sa QtAbstractPropertyManager, QtLineEditFactory
 */
 
 /*!
-    \fn void QtLocalePropertyManager::valueChanged(QtProperty *property, const QLocale &value)
+    \fn void QtStringPropertyManager::valueChanged(QtProperty *property, const QString &value)
 
     This signal is emitted whenever a property created by this manager
     changes its value, passing a pointer to the \a property and the
@@ -2019,186 +2813,1653 @@ void QtLocalePropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
     \sa setValue()
 */
 
+/*!
+    \fn void QtStringPropertyManager::regExpChanged(QtProperty *property, const QRegularExpression &regExp)
+
+    This signal is emitted whenever a property created by this manager
+    changes its currenlty set regular expression, passing a pointer to
+    the \a property and the new \a regExp as parameters.
+
+    \sa setRegExp()
+*/
+
+/*!
+    \fn void QtStringPropertyManager::validationPendingChanged(QtProperty *property, bool pending)
+
+    This signal is emitted whenever a background check of a value for
+    the given \a property starts or ends, passing whether a check is
+    \a pending as parameter.
+
+    \sa isValidationPending(), setAsyncValidationThreshold()
+*/
+
 /*!
     Creates a manager with the given \a parent.
 */
-QtLocalePropertyManager::QtLocalePropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtLocalePropertyManagerPrivate)
+QtStringPropertyManager::QtStringPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtStringPropertyManagerPrivate)
 {
     d_ptr->q_ptr = this;
-
-    d_ptr->m_enumPropertyManager = new QtEnumPropertyManager(this);
-    connect(d_ptr->m_enumPropertyManager, SIGNAL(valueChanged(QtProperty*,int)),
-                this, SLOT(slotEnumChanged(QtProperty*,int)));
-
-    connect(d_ptr->m_enumPropertyManager, SIGNAL(propertyDestroyed(QtProperty*)),
-                this, SLOT(slotPropertyDestroyed(QtProperty*)));
 }
 
 /*!
     Destroys this manager, and all the properties it has created.
 */
-QtLocalePropertyManager::~QtLocalePropertyManager()
+QtStringPropertyManager::~QtStringPropertyManager()
 {
     clear();
 }
 
 /*!
-    Returns the manager that creates the nested \e language
-    and \e country subproperties.
+    Returns the given \a property's value.
 
-    In order to provide editing widgets for the mentioned subproperties
-    in a property browser widget, this manager must be associated with
-    an editor factory.
+    If the given property is not managed by this manager, this
+    function returns an empty string.
 
-    \sa QtAbstractPropertyBrowser::setFactoryForManager()
+    \sa setValue()
 */
-QtEnumPropertyManager *QtLocalePropertyManager::subEnumPropertyManager() const
+QString QtStringPropertyManager::value(const QtProperty *property) const
 {
-    return d_ptr->m_enumPropertyManager;
+    return getValue<QString>(d_ptr->m_values, property);
 }
 
 /*!
-    Returns the given \a property's value.
+    Returns the given \a property's currently set regular expression.
 
-    If the given property is not managed by this manager, this
-    function returns the default locale.
+    If the given \a property is not managed by this manager, this
+    function returns an empty expression.
 
-    \sa setValue()
+    \sa setRegExp()
 */
-QLocale QtLocalePropertyManager::value(const QtProperty *property) const
+QRegularExpression QtStringPropertyManager::regExp(const QtProperty *property) const
 {
-    return d_ptr->m_values.value(property, QLocale());
+    return getData<QRegularExpression>(d_ptr->m_values, &QtStringPropertyManagerPrivate::Data::regExp, property, QRegularExpression());
+}
+
+/*!
+    Returns whether a value set for the given \a property is being
+    checked against its regular expression in the background.
+
+    \sa validationPendingChanged(), asyncValidationThreshold()
+*/
+bool QtStringPropertyManager::isValidationPending(const QtProperty *property) const
+{
+    const auto it = d_ptr->m_values.constFind(property);
+    return it != d_ptr->m_values.constEnd() && it.value().validationJob;
+}
+
+/*!
+    Returns the length from which values are checked against the
+    regular expression on a worker thread.
+
+    \sa setAsyncValidationThreshold()
+*/
+int QtStringPropertyManager::asyncValidationThreshold() const
+{
+    return d_ptr->m_asyncValidationThreshold;
+}
+
+/*!
+    Sets the length from which values are checked against the regular
+    expression on a worker thread to \a length characters. Shorter
+    values are checked right away. A \a length of 0 or less makes all
+    checks synchronous. The default is 4096.
+
+    \sa asyncValidationThreshold(), isValidationPending()
+*/
+void QtStringPropertyManager::setAsyncValidationThreshold(int length)
+{
+    d_ptr->m_asyncValidationThreshold = length;
 }
 
 /*!
     \reimp
 */
-QString QtLocalePropertyManager::valueText(const QtProperty *property) const
+QString QtStringPropertyManager::valueText(const QtProperty *property) const
 {
-    const QtLocalePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    const QtStringPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
     if (it == d_ptr->m_values.constEnd())
         return QString();
+    return it.value().val;
+}
 
-    const QLocale loc = it.value();
+/*!
+    \fn void QtStringPropertyManager::setValue(QtProperty *property, const QString &value)
 
-    int langIdx = 0;
-    int countryIdx = 0;
-    const QtMetaEnumProvider *me = metaEnumProvider();
-    me->localeToIndex(loc.language(), loc.country(), &langIdx, &countryIdx);
-    if (langIdx < 0) {
-        qWarning("QtLocalePropertyManager::valueText: Unknown language %d", loc.language());
-        return tr("<Invalid>");
+    Sets the value of the given \a property to \a value.
+
+    If the specified \a value doesn't match the given \a property's
+    regular expression, this function does nothing.
+
+    Values at least asyncValidationThreshold() characters long are
+    checked on a worker thread, and the property changes once the check
+    succeeds. Setting another value meanwhile discards the pending one.
+
+    \sa value(), setRegExp(), valueChanged()
+*/
+void QtStringPropertyManager::setValue(QtProperty *property, const QString &val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    const QtStringPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    QtStringPropertyManagerPrivate::Data data = it.value();
+
+    const bool wasPending = d_ptr->cancelValidation(data);
+    bool accepted = data.val != val;
+
+    if (accepted && data.regExp.isValid() && !data.regExp.pattern().isEmpty()) {
+        if (d_ptr->m_asyncValidationThreshold > 0 && val.size() >= d_ptr->m_asyncValidationThreshold) {
+            d_ptr->startValidation(property, data, val);
+            it.value() = data;
+            if (!wasPending)
+                emit validationPendingChanged(property, true);
+            return;
+        }
+        accepted = data.regExp.match(val).hasMatch();
     }
-    const QString languageName = me->languageEnumNames().at(langIdx);
-    if (countryIdx < 0) {
-        qWarning("QtLocalePropertyManager::valueText: Unknown country %d for %s", loc.country(), qPrintable(languageName));
-        return languageName;
+
+    if (accepted)
+        data.val = val;
+
+    it.value() = data;
+
+    if (accepted) {
+        emit propertyChanged(property);
+        emit valueChanged(property, data.val);
     }
-    const QString countryName = me->countryEnumNames(loc.language()).at(countryIdx);
-    return tr("%1, %2").arg(languageName, countryName);
+    if (wasPending)
+        emit validationPendingChanged(property, false);
 }
 
 /*!
-    \fn void QtLocalePropertyManager::setValue(QtProperty *property, const QLocale &value)
-
-    Sets the value of the given \a property to \a value. Nested
-    properties are updated automatically.
+    Sets the regular expression of the given \a property to \a regExp.
 
-    \sa value(), valueChanged()
+    \sa regExp(), setValue(), regExpChanged()
 */
-void QtLocalePropertyManager::setValue(QtProperty *property, const QLocale &val)
+void QtStringPropertyManager::setRegExp(QtProperty *property, const QRegularExpression &regExp)
 {
-    const QtLocalePropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    const QtStringPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
 
-    const QLocale loc = it.value();
-    if (loc == val)
+    QtStringPropertyManagerPrivate::Data data = it.value() ;
+
+    if (data.regExp == regExp)
         return;
 
-    it.value() = val;
+    QtRegularExpressionCache::release(data.regExp);
+    data.regExp = QtRegularExpressionCache::acquire(regExp);
 
-    int langIdx = 0;
-    int countryIdx = 0;
-    metaEnumProvider()->localeToIndex(val.language(), val.country(), &langIdx, &countryIdx);
-    if (loc.language() != val.language()) {
-        d_ptr->m_enumPropertyManager->setValue(d_ptr->m_propertyToLanguage.value(property), langIdx);
-        d_ptr->m_enumPropertyManager->setEnumNames(d_ptr->m_propertyToCountry.value(property),
-                    metaEnumProvider()->countryEnumNames(val.language()));
-    }
-    d_ptr->m_enumPropertyManager->setValue(d_ptr->m_propertyToCountry.value(property), countryIdx);
+    it.value() = data;
 
-    emit propertyChanged(property);
-    emit valueChanged(property, val);
+    emit regExpChanged(property, data.regExp);
+
+    // Check a value still waiting for the previous expression again.
+    const QSharedPointer<QtStringValidationJob> job = d_ptr->m_values.value(property).validationJob;
+    if (job)
+        setValue(property, job->value);
 }
 
 /*!
     \reimp
 */
-void QtLocalePropertyManager::initializeProperty(QtProperty *property)
+QVariant QtStringPropertyManager::journalValue(const QtProperty *property) const
 {
-    QLocale val;
-    d_ptr->m_values[property] = val;
+    return value(property);
+}
 
-    int langIdx = 0;
-    int countryIdx = 0;
-    metaEnumProvider()->localeToIndex(val.language(), val.country(), &langIdx, &countryIdx);
+/*!
+    \reimp
+*/
+void QtStringPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
 
-    QtProperty *languageProp = d_ptr->m_enumPropertyManager->addProperty();
-    languageProp->setPropertyName(tr("Language"));
-    d_ptr->m_enumPropertyManager->setEnumNames(languageProp, metaEnumProvider()->languageEnumNames());
-    d_ptr->m_enumPropertyManager->setValue(languageProp, langIdx);
-    d_ptr->m_propertyToLanguage[property] = languageProp;
-    d_ptr->m_languageToProperty[languageProp] = property;
-    property->addSubProperty(languageProp);
+/*!
+    \reimp
+*/
+void QtStringPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toString());
+}
 
-    QtProperty *countryProp = d_ptr->m_enumPropertyManager->addProperty();
-    countryProp->setPropertyName(tr("Country"));
-    d_ptr->m_enumPropertyManager->setEnumNames(countryProp, metaEnumProvider()->countryEnumNames(val.language()));
-    d_ptr->m_enumPropertyManager->setValue(countryProp, countryIdx);
-    d_ptr->m_propertyToCountry[property] = countryProp;
-    d_ptr->m_countryToProperty[countryProp] = property;
-    property->addSubProperty(countryProp);
+/*!
+    \reimp
+*/
+void QtStringPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QtStringPropertyManagerPrivate::Data();
 }
 
 /*!
     \reimp
 */
-void QtLocalePropertyManager::uninitializeProperty(QtProperty *property)
+void QtStringPropertyManager::uninitializeProperty(QtProperty *property)
+{
+    const QtStringPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    d_ptr->cancelValidation(it.value());
+    QtRegularExpressionCache::release(it.value().regExp);
+    d_ptr->m_values.erase(it);
+}
+
+
+//     Return an icon containing a check box indicator
+static QIcon drawCheckBox(bool value)
+{
+    QStyleOptionButton opt;
+    opt.state |= value ? QStyle::State_On : QStyle::State_Off;
+    opt.state |= QStyle::State_Enabled;
+    const QStyle *style = QApplication::style();
+    // Figure out size of an indicator and make sure it is not scaled down in a list view item
+    // by making the pixmap as big as a list view icon and centering the indicator in it.
+    // (if it is smaller, it can't be helped)
+    const int indicatorWidth = style->pixelMetric(QStyle::PM_IndicatorWidth, &opt);
+    const int indicatorHeight = style->pixelMetric(QStyle::PM_IndicatorHeight, &opt);
+    const int listViewIconSize = indicatorWidth;
+    const int pixmapWidth = indicatorWidth;
+    const int pixmapHeight = qMax(indicatorHeight, listViewIconSize);
+
+    opt.rect = QRect(0, 0, indicatorWidth, indicatorHeight);
+    QPixmap pixmap = QPixmap(pixmapWidth, pixmapHeight);
+    pixmap.fill(Qt::transparent);
+    {
+        // Center?
+        const int xoff = (pixmapWidth  > indicatorWidth)  ? (pixmapWidth  - indicatorWidth)  / 2 : 0;
+        const int yoff = (pixmapHeight > indicatorHeight) ? (pixmapHeight - indicatorHeight) / 2 : 0;
+        QPainter painter(&pixmap);
+        painter.translate(xoff, yoff);
+        style->drawPrimitive(QStyle::PE_IndicatorCheckBox, &opt, &painter);
+    }
+    return QIcon(pixmap);
+}
+
+
+// QtBoolPropertyManager
+QtBoolPropertyManagerPrivate::QtBoolPropertyManagerPrivate() :
+    m_checkedIcon(drawCheckBox(true)),
+    m_uncheckedIcon(drawCheckBox(false))
+{
+}
+
+/*!
+    \class QtBoolPropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtBoolPropertyManager class provides and manages boolean properties.
+
+    The property's value can be retrieved using the value() function,
+    and set using the setValue() slot.
+
+    In addition, QtBoolPropertyManager provides the valueChanged() signal
+    which is emitted whenever a property created by this manager
+    changes.
+
+    \sa QtAbstractPropertyManager, QtCheckBoxFactory
+*/
+
+/*!
+    \fn void QtBoolPropertyManager::valueChanged(QtProperty *property, bool value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the
+    new \a value as parameters.
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtBoolPropertyManager::QtBoolPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtBoolPropertyManagerPrivate)
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtBoolPropertyManager::~QtBoolPropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given \a property is not managed by \e this manager, this
+    function returns false.
+
+    \sa setValue()
+*/
+bool QtBoolPropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, false);
+}
+
+/*!
+    \reimp
+*/
+QString QtBoolPropertyManager::valueText(const QtProperty *property) const
+{
+    const QMap<const QtProperty *, bool>::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+
+    static const QString trueText = tr("True");
+    static const QString falseText = tr("False");
+    return it.value() ? trueText : falseText;
+}
+
+/*!
+    \reimp
+*/
+QIcon QtBoolPropertyManager::valueIcon(const QtProperty *property) const
+{
+    const QMap<const QtProperty *, bool>::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QIcon();
+
+    return it.value() ? d_ptr->m_checkedIcon : d_ptr->m_uncheckedIcon;
+}
+
+/*!
+    \fn void QtBoolPropertyManager::setValue(QtProperty *property, bool value)
+
+    Sets the value of the given \a property to \a value.
+
+    \sa value()
+*/
+void QtBoolPropertyManager::setValue(QtProperty *property, bool val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setSimpleValue<bool, bool, QtBoolPropertyManager>(d_ptr->m_values, this,
+                &QtBoolPropertyManager::propertyChanged,
+                &QtBoolPropertyManager::valueChanged,
+                property, val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtBoolPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtBoolPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtBoolPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toBool());
+}
+
+/*!
+    \reimp
+*/
+void QtBoolPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = false;
+}
+
+/*!
+    \reimp
+*/
+void QtBoolPropertyManager::uninitializeProperty(QtProperty *property)
+{
+    d_ptr->m_values.remove(property);
+}
+
+// QtDatePropertyManager
+QtDatePropertyManagerPrivate::QtDatePropertyManagerPrivate(QtDatePropertyManager *q) :
+    q_ptr(q),
+    m_format(QtPropertyBrowserUtils::dateFormat())
+{
+}
+
+/*!
+    \class QtDatePropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtDatePropertyManager provides and manages QDate properties.
+
+    A date property has a current value, and a range specifying the
+    valid dates. The range is defined by a minimum and a maximum
+    value.
+
+    The property's values can be retrieved using the minimum(),
+    maximum() and value() functions, and can be set using the
+    setMinimum(), setMaximum() and setValue() slots. Alternatively,
+    the range can be defined in one go using the setRange() slot.
+
+    In addition, QtDatePropertyManager provides the valueChanged() signal
+    which is emitted whenever a property created by this manager
+    changes, and the rangeChanged() signal which is emitted whenever
+    such a property changes its range of valid dates.
+
+    \sa QtAbstractPropertyManager, QtDateEditFactory, QtDateTimePropertyManager
+*/
+
+/*!
+    \fn void QtDatePropertyManager::valueChanged(QtProperty *property, QDate value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the new
+    \a value as parameters.
+
+    \sa setValue()
+*/
+
+/*!
+    \fn void QtDatePropertyManager::rangeChanged(QtProperty *property, QDate minimum, QDate maximum)
+
+    This signal is emitted whenever a property created by this manager
+    changes its range of valid dates, passing a pointer to the \a
+    property and the new \a minimum and \a maximum dates.
+
+    \sa setRange()
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtDatePropertyManager::QtDatePropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtDatePropertyManagerPrivate(this))
+{
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtDatePropertyManager::~QtDatePropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given \a property is not managed by \e this manager, this
+    function returns an invalid date.
+
+    \sa setValue()
+*/
+QDate QtDatePropertyManager::value(const QtProperty *property) const
+{
+    return getValue<QDate>(d_ptr->m_values, property);
+}
+
+/*!
+    Returns the given \a  property's  minimum date.
+
+    \sa maximum(), setRange()
+*/
+QDate QtDatePropertyManager::minimum(const QtProperty *property) const
+{
+    return getMinimum<QDate>(d_ptr->m_values, property);
+}
+
+/*!
+    Returns the given \a property's maximum date.
+
+    \sa minimum(), setRange()
+*/
+QDate QtDatePropertyManager::maximum(const QtProperty *property) const
+{
+    return getMaximum<QDate>(d_ptr->m_values, property);
+}
+
+/*!
+    \reimp
+*/
+QString QtDatePropertyManager::valueText(const QtProperty *property) const
+{
+    const QtDatePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    return it.value().val.toString(d_ptr->m_format);
+}
+
+/*!
+    \fn void QtDatePropertyManager::setValue(QtProperty *property, QDate value)
+
+    Sets the value of the given \a property to \a value.
+
+    If the specified \a value is not a valid date according to the
+    given \a property's range, the value is adjusted to the nearest
+    valid value within the range.
+
+    \sa value(), setRange(), valueChanged()
+*/
+void QtDatePropertyManager::setValue(QtProperty *property, QDate val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    void (QtDatePropertyManagerPrivate::*setSubPropertyValue)(QtProperty *, QDate) = 0;
+    setValueInRange<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, const QDate>(this, d_ptr.data(),
+                &QtDatePropertyManager::propertyChanged,
+                &QtDatePropertyManager::valueChanged,
+                property, val, setSubPropertyValue);
+}
+
+/*!
+    Sets the minimum value for the given \a property to \a minVal.
+
+    When setting the minimum value, the maximum and current values are
+    adjusted if necessary (ensuring that the range remains valid and
+    that the current value is within in the range).
+
+    \sa minimum(), setRange()
+*/
+void QtDatePropertyManager::setMinimum(QtProperty *property, QDate minVal)
+{
+    setMinimumValue<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, QDate, QtDatePropertyManagerPrivate::Data>(this, d_ptr.data(),
+                &QtDatePropertyManager::propertyChanged,
+                &QtDatePropertyManager::valueChanged,
+                &QtDatePropertyManager::rangeChanged,
+                property, minVal);
+}
+
+/*!
+    Sets the maximum value for the given \a property to \a maxVal.
+
+    When setting the maximum value, the minimum and current
+    values are adjusted if necessary (ensuring that the range remains
+    valid and that the current value is within in the range).
+
+    \sa maximum(), setRange()
+*/
+void QtDatePropertyManager::setMaximum(QtProperty *property, QDate maxVal)
+{
+    setMaximumValue<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, QDate, QtDatePropertyManagerPrivate::Data>(this, d_ptr.data(),
+                &QtDatePropertyManager::propertyChanged,
+                &QtDatePropertyManager::valueChanged,
+                &QtDatePropertyManager::rangeChanged,
+                property, maxVal);
+}
+
+/*!
+    \fn void QtDatePropertyManager::setRange(QtProperty *property, QDate minimum, QDate maximum)
+
+    Sets the range of valid dates.
+
+    This is a convenience function defining the range of valid dates
+    in one go; setting the \a minimum and \a maximum values for the
+    given \a property with a single function call.
+
+    When setting a new date range, the current value is adjusted if
+    necessary (ensuring that the value remains in date range).
+
+    \sa setMinimum(), setMaximum(), rangeChanged()
+*/
+void QtDatePropertyManager::setRange(QtProperty *property, QDate minVal, QDate maxVal)
+{
+    void (QtDatePropertyManagerPrivate::*setSubPropertyRange)(QtProperty *, QDate, QDate, QDate) = 0;
+    setBorderValues<QDate, QtDatePropertyManagerPrivate, QtDatePropertyManager, QDate>(this, d_ptr.data(),
+                &QtDatePropertyManager::propertyChanged,
+                &QtDatePropertyManager::valueChanged,
+                &QtDatePropertyManager::rangeChanged,
+                property, minVal, maxVal, setSubPropertyRange);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtDatePropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtDatePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtDatePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toDate());
+}
+
+/*!
+    \reimp
+*/
+void QtDatePropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QtDatePropertyManagerPrivate::Data();
+}
+
+/*!
+    \reimp
+*/
+void QtDatePropertyManager::uninitializeProperty(QtProperty *property)
+{
+    d_ptr->m_values.remove(property);
+}
+
+// QtTimePropertyManager
+QtTimePropertyManagerPrivate::QtTimePropertyManagerPrivate(QtTimePropertyManager *q) :
+    q_ptr(q),
+    m_format(QtPropertyBrowserUtils::timeFormat())
+{
+}
+
+/*!
+    \class QtTimePropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtTimePropertyManager provides and manages QTime properties.
+
+    A time property's value can be retrieved using the value()
+    function, and set using the setValue() slot.
+
+    In addition, QtTimePropertyManager provides the valueChanged() signal
+    which is emitted whenever a property created by this manager
+    changes.
+
+    \sa QtAbstractPropertyManager, QtTimeEditFactory
+*/
+
+/*!
+    \fn void QtTimePropertyManager::valueChanged(QtProperty *property, QTime value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the
+    new \a value as parameters.
+
+    \sa setValue()
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtTimePropertyManager::QtTimePropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtTimePropertyManagerPrivate(this))
+{
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtTimePropertyManager::~QtTimePropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given property is not managed by this manager, this
+    function returns an invalid time object.
+
+    \sa setValue()
+*/
+QTime QtTimePropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, QTime());
+}
+
+/*!
+    \reimp
+*/
+QString QtTimePropertyManager::valueText(const QtProperty *property) const
+{
+   const QtTimePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    return it.value().toString(d_ptr->m_format);
+}
+
+/*!
+    \fn void QtTimePropertyManager::setValue(QtProperty *property, QTime value)
+
+    Sets the value of the given \a property to \a value.
+
+    \sa value(), valueChanged()
+*/
+void QtTimePropertyManager::setValue(QtProperty *property, QTime val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setSimpleValue<QTime, QTime, QtTimePropertyManager>(d_ptr->m_values, this,
+                &QtTimePropertyManager::propertyChanged,
+                &QtTimePropertyManager::valueChanged,
+                property, val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtTimePropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtTimePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtTimePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toTime());
+}
+
+/*!
+    \reimp
+*/
+void QtTimePropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QTime::currentTime();
+}
+
+/*!
+    \reimp
+*/
+void QtTimePropertyManager::uninitializeProperty(QtProperty *property)
+{
+    d_ptr->m_values.remove(property);
+}
+
+// QtDateTimePropertyManager
+
+
+
+QtDateTimePropertyManagerPrivate::QtDateTimePropertyManagerPrivate(QtDateTimePropertyManager *q) :
+    q_ptr(q),
+    m_format(QtPropertyBrowserUtils::dateTimeFormat())
+{
+}
+
+/*! \class QtDateTimePropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtDateTimePropertyManager provides and manages QDateTime properties.
+
+    A date and time property has a current value which can be
+    retrieved using the value() function, and set using the setValue()
+    slot. In addition, QtDateTimePropertyManager provides the
+    valueChanged() signal which is emitted whenever a property created
+    by this manager changes.
+
+    \sa QtAbstractPropertyManager, QtDateTimeEditFactory, QtDatePropertyManager
+*/
+
+/*!
+    \fn void QtDateTimePropertyManager::valueChanged(QtProperty *property, const QDateTime &value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the new
+    \a value as parameters.
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtDateTimePropertyManager::QtDateTimePropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtDateTimePropertyManagerPrivate(this))
+{
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtDateTimePropertyManager::~QtDateTimePropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given \a property is not managed by this manager, this
+    function returns an invalid QDateTime object.
+
+    \sa setValue()
+*/
+QDateTime QtDateTimePropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, QDateTime());
+}
+
+/*!
+    \reimp
+*/
+QString QtDateTimePropertyManager::valueText(const QtProperty *property) const
+{
+   const QtDateTimePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    return it.value().toString(d_ptr->m_format);
+}
+
+/*!
+    \fn void QtDateTimePropertyManager::setValue(QtProperty *property, const QDateTime &value)
+
+    Sets the value of the given \a property to \a value.
+
+    \sa value(), valueChanged()
+*/
+void QtDateTimePropertyManager::setValue(QtProperty *property, const QDateTime &val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setSimpleValue<const QDateTime &, QDateTime, QtDateTimePropertyManager>(d_ptr->m_values, this,
+                &QtDateTimePropertyManager::propertyChanged,
+                &QtDateTimePropertyManager::valueChanged,
+                property, val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtDateTimePropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtDateTimePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtDateTimePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toDateTime());
+}
+
+/*!
+    \reimp
+*/
+void QtDateTimePropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QDateTime::currentDateTime();
+}
+
+/*!
+    \reimp
+*/
+void QtDateTimePropertyManager::uninitializeProperty(QtProperty *property)
+{
+    d_ptr->m_values.remove(property);
+}
+
+// QtKeySequencePropertyManager
+/*! \class QtKeySequencePropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtKeySequencePropertyManager provides and manages QKeySequence properties.
+
+    A key sequence's value can be retrieved using the value()
+    function, and set using the setValue() slot.
+
+    In addition, QtKeySequencePropertyManager provides the valueChanged() signal
+    which is emitted whenever a property created by this manager
+    changes.
+
+    \sa QtAbstractPropertyManager
+*/
+
+/*!
+    \fn void QtKeySequencePropertyManager::valueChanged(QtProperty *property, const QKeySequence &value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the new
+    \a value as parameters.
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtKeySequencePropertyManager::QtKeySequencePropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtKeySequencePropertyManagerPrivate)
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtKeySequencePropertyManager::~QtKeySequencePropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given \a property is not managed by this manager, this
+    function returns an empty QKeySequence object.
+
+    \sa setValue()
+*/
+QKeySequence QtKeySequencePropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, QKeySequence());
+}
+
+/*!
+    \reimp
+*/
+QString QtKeySequencePropertyManager::valueText(const QtProperty *property) const
+{
+    const QtKeySequencePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    return it.value().toString(QKeySequence::NativeText);
+}
+
+/*!
+    \fn void QtKeySequencePropertyManager::setValue(QtProperty *property, const QKeySequence &value)
+
+    Sets the value of the given \a property to \a value.
+
+    \sa value(), valueChanged()
+*/
+void QtKeySequencePropertyManager::setValue(QtProperty *property, const QKeySequence &val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setSimpleValue<const QKeySequence &, QKeySequence, QtKeySequencePropertyManager>(d_ptr->m_values, this,
+                &QtKeySequencePropertyManager::propertyChanged,
+                &QtKeySequencePropertyManager::valueChanged,
+                property, val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtKeySequencePropertyManager::journalValue(const QtProperty *property) const
+{
+    return QVariant::fromValue(value(property));
+}
+
+/*!
+    \reimp
+*/
+void QtKeySequencePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtKeySequencePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QKeySequence>());
+}
+
+/*!
+    \reimp
+*/
+void QtKeySequencePropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QKeySequence();
+}
+
+/*!
+    \reimp
+*/
+void QtKeySequencePropertyManager::uninitializeProperty(QtProperty *property)
+{
+    d_ptr->m_values.remove(property);
+}
+
+// QtCharPropertyManager
+/*! \class QtCharPropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtCharPropertyManager provides and manages QChar properties.
+
+    A char's value can be retrieved using the value()
+    function, and set using the setValue() slot.
+
+    In addition, QtCharPropertyManager provides the valueChanged() signal
+    which is emitted whenever a property created by this manager
+    changes.
+
+    \sa QtAbstractPropertyManager
+*/
+
+/*!
+    \fn void QtCharPropertyManager::valueChanged(QtProperty *property, const QChar &value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the new
+    \a value as parameters.
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtCharPropertyManager::QtCharPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtCharPropertyManagerPrivate)
+{
+    d_ptr->q_ptr = this;
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtCharPropertyManager::~QtCharPropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given \a property is not managed by this manager, this
+    function returns an null QChar object.
+
+    \sa setValue()
+*/
+QChar QtCharPropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, QChar());
+}
+
+/*!
+    \reimp
+*/
+QString QtCharPropertyManager::valueText(const QtProperty *property) const
+{
+   const QtCharPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    const QChar c = it.value();
+    return c.isNull() ? QString() : QString(c);
+}
+
+/*!
+    \fn void QtCharPropertyManager::setValue(QtProperty *property, const QChar &value)
+
+    Sets the value of the given \a property to \a value.
+
+    \sa value(), valueChanged()
+*/
+void QtCharPropertyManager::setValue(QtProperty *property, const QChar &val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    setSimpleValue<const QChar &, QChar, QtCharPropertyManager>(d_ptr->m_values, this,
+                &QtCharPropertyManager::propertyChanged,
+                &QtCharPropertyManager::valueChanged,
+                property, val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtCharPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtCharPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtCharPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toChar());
+}
+
+/*!
+    \reimp
+*/
+void QtCharPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QChar();
+}
+
+/*!
+    \reimp
+*/
+void QtCharPropertyManager::uninitializeProperty(QtProperty *property)
+{
+    d_ptr->m_values.remove(property);
+}
+
+// QtLocalePropertyManager
+QtLocalePropertyManagerPrivate::QtLocalePropertyManagerPrivate()
+{
+}
+
+void QtLocalePropertyManagerPrivate::slotEnumChanged(QtProperty *property, int value)
+{
+    if (QtProperty *prop = m_languageToProperty.value(property, 0)) {
+        const QLocale loc = m_values[prop];
+        QLocale::Language newLanguage = loc.language();
+        QLocale::Country newCountry = loc.country();
+        metaEnumProvider()->indexToLocale(value, 0, &newLanguage, 0);
+        QLocale newLoc(newLanguage, newCountry);
+        q_ptr->setValue(prop, newLoc);
+    } else if (QtProperty *prop = m_countryToProperty.value(property, 0)) {
+        const QLocale loc = m_values[prop];
+        QLocale::Language newLanguage = loc.language();
+        QLocale::Country newCountry = loc.country();
+        metaEnumProvider()->indexToLocale(m_enumPropertyManager->value(m_propertyToLanguage.value(prop)), value, &newLanguage, &newCountry);
+        QLocale newLoc(newLanguage, newCountry);
+        q_ptr->setValue(prop, newLoc);
+    }
+}
+
+void QtLocalePropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
+{
+    if (QtProperty *subProp = m_languageToProperty.value(property, 0)) {
+        m_propertyToLanguage[subProp] = 0;
+        m_languageToProperty.remove(property);
+    } else if (QtProperty *subProp = m_countryToProperty.value(property, 0)) {
+        m_propertyToCountry[subProp] = 0;
+        m_countryToProperty.remove(property);
+    }
+}
+
+/*!
+    \class QtLocalePropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtLocalePropertyManager provides and manages QLocale properties.
+
+    A locale property has nested \e language and \e country
+    subproperties. The top-level property's value can be retrieved
+    using the value() function, and set using the setValue() slot.
+
+    The subproperties are created by QtEnumPropertyManager object.
+    These submanager can be retrieved using the subEnumPropertyManager()
+    function. In order to provide editing widgets for the subproperties
+    in a property browser widget, this manager must be associated with editor factory.
+
+    In addition, QtLocalePropertyManager provides the valueChanged()
+    signal which is emitted whenever a property created by this
+    manager changes.
+
+    \sa QtAbstractPropertyManager, QtEnumPropertyManager
+*/
+
+/*!
+    \fn void QtLocalePropertyManager::valueChanged(QtProperty *property, const QLocale &value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the
+    new \a value as parameters.
+
+    \sa setValue()
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtLocalePropertyManager::QtLocalePropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtLocalePropertyManagerPrivate)
+{
+    d_ptr->q_ptr = this;
+
+    d_ptr->m_enumPropertyManager = new QtEnumPropertyManager(this);
+    connect(d_ptr->m_enumPropertyManager, SIGNAL(valueChanged(QtProperty*,int)),
+                this, SLOT(slotEnumChanged(QtProperty*,int)));
+
+    connect(d_ptr->m_enumPropertyManager, SIGNAL(propertyDestroyed(QtProperty*)),
+                this, SLOT(slotPropertyDestroyed(QtProperty*)));
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtLocalePropertyManager::~QtLocalePropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the manager that creates the nested \e language
+    and \e country subproperties.
+
+    In order to provide editing widgets for the mentioned subproperties
+    in a property browser widget, this manager must be associated with
+    an editor factory.
+
+    \sa QtAbstractPropertyBrowser::setFactoryForManager()
+*/
+QtEnumPropertyManager *QtLocalePropertyManager::subEnumPropertyManager() const
+{
+    return d_ptr->m_enumPropertyManager;
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given property is not managed by this manager, this
+    function returns the default locale.
+
+    \sa setValue()
+*/
+QLocale QtLocalePropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, QLocale());
+}
+
+/*!
+    \reimp
+*/
+QString QtLocalePropertyManager::valueText(const QtProperty *property) const
+{
+    const QtLocalePropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+
+    const QLocale loc = it.value();
+
+    int langIdx = 0;
+    int countryIdx = 0;
+    const QtMetaEnumProvider *me = metaEnumProvider();
+    me->localeToIndex(loc.language(), loc.country(), &langIdx, &countryIdx);
+    if (langIdx < 0) {
+        qWarning("QtLocalePropertyManager::valueText: Unknown language %d", loc.language());
+        return tr("<Invalid>");
+    }
+    const QString languageName = me->languageEnumNames().at(langIdx);
+    if (countryIdx < 0) {
+        qWarning("QtLocalePropertyManager::valueText: Unknown country %d for %s", loc.country(), qPrintable(languageName));
+        return languageName;
+    }
+    const QString countryName = me->countryEnumNames(loc.language()).at(countryIdx);
+    return tr("%1, %2").arg(languageName, countryName);
+}
+
+/*!
+    \fn void QtLocalePropertyManager::setValue(QtProperty *property, const QLocale &value)
+
+    Sets the value of the given \a property to \a value. Nested
+    properties are updated automatically.
+
+    \sa value(), valueChanged()
+*/
+void QtLocalePropertyManager::setValue(QtProperty *property, const QLocale &val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    const QtLocalePropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    const QLocale loc = it.value();
+    if (loc == val)
+        return;
+
+    it.value() = val;
+
+    int langIdx = 0;
+    int countryIdx = 0;
+    metaEnumProvider()->localeToIndex(val.language(), val.country(), &langIdx, &countryIdx);
+    if (loc.language() != val.language()) {
+        d_ptr->m_enumPropertyManager->setValue(d_ptr->m_propertyToLanguage.value(property), langIdx);
+        d_ptr->m_enumPropertyManager->setEnumNames(d_ptr->m_propertyToCountry.value(property),
+                    metaEnumProvider()->countryEnumNames(val.language()));
+    }
+    d_ptr->m_enumPropertyManager->setValue(d_ptr->m_propertyToCountry.value(property), countryIdx);
+
+    emit propertyChanged(property);
+    emit valueChanged(property, val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtLocalePropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtLocalePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtLocalePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toLocale());
+}
+
+/*!
+    \reimp
+*/
+void QtLocalePropertyManager::initializeProperty(QtProperty *property)
+{
+    QLocale val;
+    d_ptr->m_values[property] = val;
+
+    int langIdx = 0;
+    int countryIdx = 0;
+    metaEnumProvider()->localeToIndex(val.language(), val.country(), &langIdx, &countryIdx);
+
+    QtProperty *languageProp = d_ptr->m_enumPropertyManager->addProperty();
+    languageProp->setPropertyName(tr("Language"));
+    d_ptr->m_enumPropertyManager->setEnumNames(languageProp, metaEnumProvider()->languageEnumNames());
+    d_ptr->m_enumPropertyManager->setValue(languageProp, langIdx);
+    d_ptr->m_propertyToLanguage[property] = languageProp;
+    d_ptr->m_languageToProperty[languageProp] = property;
+    property->addSubProperty(languageProp);
+
+    QtProperty *countryProp = d_ptr->m_enumPropertyManager->addProperty();
+    countryProp->setPropertyName(tr("Country"));
+    d_ptr->m_enumPropertyManager->setEnumNames(countryProp, metaEnumProvider()->countryEnumNames(val.language()));
+    d_ptr->m_enumPropertyManager->setValue(countryProp, countryIdx);
+    d_ptr->m_propertyToCountry[property] = countryProp;
+    d_ptr->m_countryToProperty[countryProp] = property;
+    property->addSubProperty(countryProp);
+}
+
+/*!
+    \reimp
+*/
+void QtLocalePropertyManager::uninitializeProperty(QtProperty *property)
 {
     QtProperty *languageProp = d_ptr->m_propertyToLanguage[property];
     if (languageProp) {
         d_ptr->m_languageToProperty.remove(languageProp);
         delete languageProp;
     }
-    d_ptr->m_propertyToLanguage.remove(property);
+    d_ptr->m_propertyToLanguage.remove(property);
+
+    QtProperty *countryProp = d_ptr->m_propertyToCountry[property];
+    if (countryProp) {
+        d_ptr->m_countryToProperty.remove(countryProp);
+        delete countryProp;
+    }
+    d_ptr->m_propertyToCountry.remove(property);
+
+    d_ptr->m_values.remove(property);
+}
+
+// QtPointPropertyManager
+void QtPointPropertyManagerPrivate::slotIntChanged(QtProperty *property, int value)
+{
+    if (QtProperty *xprop = m_xToProperty.value(property, 0)) {
+        QPoint p = m_values[xprop];
+        p.setX(value);
+        q_ptr->setValue(xprop, p);
+    } else if (QtProperty *yprop = m_yToProperty.value(property, 0)) {
+        QPoint p = m_values[yprop];
+        p.setY(value);
+        q_ptr->setValue(yprop, p);
+    }
+}
+
+void QtPointPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
+{
+    if (QtProperty *pointProp = m_xToProperty.value(property, 0)) {
+        m_propertyToX[pointProp] = 0;
+        m_xToProperty.remove(property);
+    } else if (QtProperty *pointProp = m_yToProperty.value(property, 0)) {
+        m_propertyToY[pointProp] = 0;
+        m_yToProperty.remove(property);
+    }
+}
+
+/*! \class QtPointPropertyManager
+    \internal
+    \inmodule QtDesigner
+    \since 4.4
+
+    \brief The QtPointPropertyManager provides and manages QPoint properties.
+
+    A point property has nested \e x and \e y subproperties. The
+    top-level property's value can be retrieved using the value()
+    function, and set using the setValue() slot.
+
+    The subproperties are created by a QtIntPropertyManager object. This
+    manager can be retrieved using the subIntPropertyManager() function. In
+    order to provide editing widgets for the subproperties in a
+    property browser widget, this manager must be associated with an
+    editor factory.
+
+    In addition, QtPointPropertyManager provides the valueChanged() signal which
+    is emitted whenever a property created by this manager changes.
+
+    \sa QtAbstractPropertyManager, QtIntPropertyManager, QtPointFPropertyManager
+*/
+
+/*!
+    \fn void QtPointPropertyManager::valueChanged(QtProperty *property, const QPoint &value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the
+    new \a value as parameters.
+
+    \sa setValue()
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtPointPropertyManager::QtPointPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtPointPropertyManagerPrivate)
+{
+    d_ptr->q_ptr = this;
+
+    d_ptr->m_intPropertyManager = new QtIntPropertyManager(this);
+    connect(d_ptr->m_intPropertyManager, SIGNAL(valueChanged(QtProperty*,int)),
+                this, SLOT(slotIntChanged(QtProperty*,int)));
+    connect(d_ptr->m_intPropertyManager, SIGNAL(propertyDestroyed(QtProperty*)),
+                this, SLOT(slotPropertyDestroyed(QtProperty*)));
+}
+
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtPointPropertyManager::~QtPointPropertyManager()
+{
+    clear();
+}
+
+/*!
+    Returns the manager that creates the nested \e x and \e y
+    subproperties.
+
+    In order to provide editing widgets for the subproperties in a
+    property browser widget, this manager must be associated with an
+    editor factory.
+
+    \sa QtAbstractPropertyBrowser::setFactoryForManager()
+*/
+QtIntPropertyManager *QtPointPropertyManager::subIntPropertyManager() const
+{
+    return d_ptr->m_intPropertyManager;
+}
+
+/*!
+    Returns the given \a property's value.
+
+    If the given \a property is not managed by this manager, this
+    function returns a point with coordinates (0, 0).
+
+    \sa setValue()
+*/
+QPoint QtPointPropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, QPoint());
+}
+
+/*!
+    \reimp
+*/
+QString QtPointPropertyManager::valueText(const QtProperty *property) const
+{
+    const QtPointPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    const QPoint v = it.value();
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("(%1, %2)"));
+    return text({v.x(), v.y()});
+}
+
+/*!
+    \fn void QtPointPropertyManager::setValue(QtProperty *property, const QPoint &value)
+
+    Sets the value of the given \a property to \a value. Nested
+    properties are updated automatically.
+
+    \sa value(), valueChanged()
+*/
+void QtPointPropertyManager::setValue(QtProperty *property, const QPoint &val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    const QtPointPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    if (it.value() == val)
+        return;
+
+    it.value() = val;
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToX[property], val.x());
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToY[property], val.y());
+
+    emit propertyChanged(property);
+    emit valueChanged(property, val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtPointPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtPointPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtPointPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toPoint());
+}
+
+/*!
+    \reimp
+*/
+void QtPointPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QPoint(0, 0);
+
+    QtProperty *xProp = d_ptr->m_intPropertyManager->addProperty();
+    xProp->setPropertyName(tr("X"));
+    d_ptr->m_intPropertyManager->setValue(xProp, 0);
+    d_ptr->m_propertyToX[property] = xProp;
+    d_ptr->m_xToProperty[xProp] = property;
+    property->addSubProperty(xProp);
+
+    QtProperty *yProp = d_ptr->m_intPropertyManager->addProperty();
+    yProp->setPropertyName(tr("Y"));
+    d_ptr->m_intPropertyManager->setValue(yProp, 0);
+    d_ptr->m_propertyToY[property] = yProp;
+    d_ptr->m_yToProperty[yProp] = property;
+    property->addSubProperty(yProp);
+}
+
+/*!
+    \reimp
+*/
+void QtPointPropertyManager::uninitializeProperty(QtProperty *property)
+{
+    QtProperty *xProp = d_ptr->m_propertyToX[property];
+    if (xProp) {
+        d_ptr->m_xToProperty.remove(xProp);
+        delete xProp;
+    }
+    d_ptr->m_propertyToX.remove(property);
 
-    QtProperty *countryProp = d_ptr->m_propertyToCountry[property];
-    if (countryProp) {
-        d_ptr->m_countryToProperty.remove(countryProp);
-        delete countryProp;
+    QtProperty *yProp = d_ptr->m_propertyToY[property];
+    if (yProp) {
+        d_ptr->m_yToProperty.remove(yProp);
+        delete yProp;
     }
-    d_ptr->m_propertyToCountry.remove(property);
+    d_ptr->m_propertyToY.remove(property);
 
     d_ptr->m_values.remove(property);
 }
 
-// QtPointPropertyManager
-void QtPointPropertyManagerPrivate::slotIntChanged(QtProperty *property, int value)
+//########## start of QtPoint3DPropertyManager implementation
+void QtPoint3DPropertyManagerPrivate::slotIntChanged(QtProperty *property, int value)
 {
     if (QtProperty *xprop = m_xToProperty.value(property, 0)) {
-        QPoint p = m_values[xprop];
+        QPoint3D p = m_values[xprop];
         p.setX(value);
         q_ptr->setValue(xprop, p);
     } else if (QtProperty *yprop = m_yToProperty.value(property, 0)) {
-        QPoint p = m_values[yprop];
+        QPoint3D p = m_values[yprop];
         p.setY(value);
         q_ptr->setValue(yprop, p);
+    }else if (QtProperty *zprop = m_zToProperty.value(property, 0)) {
+        QPoint3D p = m_values[zprop];
+        p.setZ(value);
+        q_ptr->setValue(zprop, p);
     }
 }
 
-void QtPointPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
+void QtPoint3DPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
 {
     if (QtProperty *pointProp = m_xToProperty.value(property, 0)) {
         m_propertyToX[pointProp] = 0;
@@ -2206,47 +4467,74 @@ void QtPointPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
     } else if (QtProperty *pointProp = m_yToProperty.value(property, 0)) {
         m_propertyToY[pointProp] = 0;
         m_yToProperty.remove(property);
+    }else if (QtProperty *pointProp = m_zToProperty.value(property, 0)) {
+        m_propertyToZ[pointProp] = 0;
+        m_zToProperty.remove(property);
     }
 }
 
-/*! \class QtPointPropertyManager
-    \internal
-    \inmodule QtDesigner
-    \since 4.4
+QList<QPoint3D> QtPoint3DPropertyManagerPrivate::values(const QList<QtProperty *> &properties) const
+{
+    QList<QPoint3D> result;
+    result.reserve(properties.size());
+    for (QtProperty *property : properties)
+        result.append(m_values.value(property));
+    return result;
+}
 
-    \brief The QtPointPropertyManager provides and manages QPoint properties.
+void QtPoint3DPropertyManagerPrivate::createSubProperties(QtProperty *property)
+{
+    const auto it = m_values.constFind(property);
+    if (it == m_values.constEnd() || m_propertyToX.value(property, 0))
+        return;
 
-    A point property has nested \e x and \e y subproperties. The
-    top-level property's value can be retrieved using the value()
-    function, and set using the setValue() slot.
+    const auto val = it.value();
 
-    The subproperties are created by a QtIntPropertyManager object. This
-    manager can be retrieved using the subIntPropertyManager() function. In
-    order to provide editing widgets for the subproperties in a
-    property browser widget, this manager must be associated with an
-    editor factory.
+    QtProperty *xProp = m_intPropertyManager->addProperty();
+    xProp->setPropertyName(QtPoint3DPropertyManager::tr("X"));
+    m_intPropertyManager->setValue(xProp, val.x());
+    m_propertyToX[property] = xProp;
+    m_xToProperty[xProp] = property;
+    property->addSubProperty(xProp);
 
-    In addition, QtPointPropertyManager provides the valueChanged() signal which
-    is emitted whenever a property created by this manager changes.
+    QtProperty *yProp = m_intPropertyManager->addProperty();
+    yProp->setPropertyName(QtPoint3DPropertyManager::tr("Y"));
+    m_intPropertyManager->setValue(yProp, val.y());
+    m_propertyToY[property] = yProp;
+    m_yToProperty[yProp] = property;
+    property->addSubProperty(yProp);
 
-    \sa QtAbstractPropertyManager, QtIntPropertyManager, QtPointFPropertyManager
-*/
+    QtProperty *zProp = m_intPropertyManager->addProperty();
+    zProp->setPropertyName(QtPoint3DPropertyManager::tr("Z"));
+    m_intPropertyManager->setValue(zProp, val.z());
+    m_propertyToZ[property] = zProp;
+    m_zToProperty[zProp] = property;
+    property->addSubProperty(zProp);
+}
 
-/*!
-    \fn void QtPointPropertyManager::valueChanged(QtProperty *property, const QPoint &value)
+void QtPoint3DPropertyManagerPrivate::destroySubProperties(QtProperty *property)
+{
+    if (QtProperty *xProp = m_propertyToX.value(property, 0)) {
+        m_xToProperty.remove(xProp);
+        delete xProp;
+    }
+    m_propertyToX.remove(property);
 
-    This signal is emitted whenever a property created by this manager
-    changes its value, passing a pointer to the \a property and the
-    new \a value as parameters.
+    if (QtProperty *yProp = m_propertyToY.value(property, 0)) {
+        m_yToProperty.remove(yProp);
+        delete yProp;
+    }
+    m_propertyToY.remove(property);
 
-    \sa setValue()
-*/
+    if (QtProperty *zProp = m_propertyToZ.value(property, 0)) {
+        m_zToProperty.remove(zProp);
+        delete zProp;
+    }
+    m_propertyToZ.remove(property);
+}
 
-/*!
-    Creates a manager with the given \a parent.
-*/
-QtPointPropertyManager::QtPointPropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtPointPropertyManagerPrivate)
+QtPoint3DPropertyManager::QtPoint3DPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtPoint3DPropertyManagerPrivate)
 {
     d_ptr->q_ptr = this;
 
@@ -2257,143 +4545,252 @@ QtPointPropertyManager::QtPointPropertyManager(QObject *parent)
                 this, SLOT(slotPropertyDestroyed(QtProperty*)));
 }
 
+QtPoint3DPropertyManager::~QtPoint3DPropertyManager()
+{
+    clear();
+}
+
+QtIntPropertyManager *QtPoint3DPropertyManager::subIntPropertyManager() const
+{
+    return d_ptr->m_intPropertyManager;
+}
+
+QPoint3D QtPoint3DPropertyManager::value(const QtProperty *property) const
+{
+    return d_ptr->m_values.value(property, QPoint3D());
+}
+
+QString QtPoint3DPropertyManager::valueText(const QtProperty *property) const
+{
+    const QtPoint3DPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return QString();
+    const QPoint3D v = it.value();
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("(%1, %2, %3)"));
+    return text({v.x(), v.y(), v.z()});
+}
+
+void QtPoint3DPropertyManager::setValue(QtProperty *property, const QPoint3D &val)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    const QtPoint3DPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    if (it.value() == val)
+        return;
+
+    it.value() = val;
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToX.value(property, 0), val.x());
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToY.value(property, 0), val.y());
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToZ.value(property, 0), val.z());
+
+    emit propertyChanged(property);
+    emit valueChanged(property, val);
+}
+
+/*!
+    Sets the values of all \a properties at once, \a values holding the new
+    value of the property at the same index. Properties not managed by this
+    manager are skipped.
+
+    propertyChanged() is emitted for each property whose value changed, but
+    instead of one valueChanged() signal per property, valuesChanged() is
+    emitted once with the list of the changed properties.
+
+    \sa setValue()
+*/
+void QtPoint3DPropertyManager::setValues(const QList<QtProperty *> &properties, const QList<QPoint3D> &values)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    QList<QtProperty *> changed;
+    // The whole batch is undone and redone as one journal step.
+    beginJournalGroup();
+    const qsizetype count = qMin(properties.size(), values.size());
+    for (qsizetype i = 0; i < count; ++i) {
+        QtProperty *property = properties.at(i);
+        const QtPoint3DPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+        if (it == d_ptr->m_values.end())
+            continue;
+
+        const QPoint3D &val = values.at(i);
+        if (it.value() == val)
+            continue;
+
+        it.value() = val;
+        d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToX.value(property, 0), val.x());
+        d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToY.value(property, 0), val.y());
+        d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToZ.value(property, 0), val.z());
+
+        emit propertyChanged(property);
+        changed.append(property);
+    }
+    endJournalGroup();
+
+    if (!changed.isEmpty())
+        emit valuesChanged(changed);
+}
+
+/*!
+    Moves all \a properties by \a offset.
+
+    \sa setValues()
+*/
+void QtPoint3DPropertyManager::translate(const QList<QtProperty *> &properties, const QPoint3D &offset)
+{
+    QList<QPoint3D> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), offset);
+    setValues(properties, vals);
+}
+
+/*!
+    Scales all \a properties by \a factor relative to \a origin.
+
+    \sa setValues()
+*/
+void QtPoint3DPropertyManager::scale(const QList<QtProperty *> &properties, double factor, const QPoint3D &origin)
+{
+    QList<QPoint3D> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), -origin);
+    QPoint3DMath::scale(vals.data(), vals.size(), factor);
+    QPoint3DMath::translate(vals.data(), vals.size(), origin);
+    setValues(properties, vals);
+}
+
+/*!
+    Rotates all \a properties around \a origin by the Euler \a angles,
+    given in degrees.
+
+    \sa setValues()
+*/
+void QtPoint3DPropertyManager::rotate(const QList<QtProperty *> &properties, const QRotation3D &angles, const QPoint3D &origin)
+{
+    QList<QPoint3D> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), -origin);
+    QPoint3DMath::rotate(vals.data(), vals.size(), angles);
+    QPoint3DMath::translate(vals.data(), vals.size(), origin);
+    setValues(properties, vals);
+}
+
+/*!
+    \overload
+
+    Rotates all \a properties around \a origin by the quaternion \a rotation.
+*/
+void QtPoint3DPropertyManager::rotate(const QList<QtProperty *> &properties, const QQuaternion &rotation, const QPoint3D &origin)
+{
+    QList<QPoint3D> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), -origin);
+    QPoint3DMath::rotate(vals.data(), vals.size(), rotation);
+    QPoint3DMath::translate(vals.data(), vals.size(), origin);
+    setValues(properties, vals);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtPoint3DPropertyManager::journalValue(const QtProperty *property) const
+{
+    return QVariant::fromValue(value(property));
+}
+
+/*!
+    \reimp
+*/
+void QtPoint3DPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
 /*!
-    Destroys this manager, and all the properties it has created.
+    \reimp
 */
-QtPointPropertyManager::~QtPointPropertyManager()
+void QtPoint3DPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
 {
-    clear();
+    setValue(property, value.value<QPoint3D>());
 }
 
 /*!
-    Returns the manager that creates the nested \e x and \e y
-    subproperties.
-
-    In order to provide editing widgets for the subproperties in a
-    property browser widget, this manager must be associated with an
-    editor factory.
+    \reimp
 
-    \sa QtAbstractPropertyBrowser::setFactoryForManager()
+    Applies the step through setValues(), so that it is reported by one
+    valuesChanged() signal.
 */
-QtIntPropertyManager *QtPointPropertyManager::subIntPropertyManager() const
+void QtPoint3DPropertyManager::setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values)
 {
-    return d_ptr->m_intPropertyManager;
+    QList<QPoint3D> vals;
+    vals.reserve(values.size());
+    for (const QVariant &value : values)
+        vals.append(value.value<QPoint3D>());
+    setValues(properties, vals);
 }
 
 /*!
-    Returns the given \a property's value.
-
-    If the given \a property is not managed by this manager, this
-    function returns a point with coordinates (0, 0).
-
-    \sa setValue()
+    \reimp
 */
-QPoint QtPointPropertyManager::value(const QtProperty *property) const
+void QtPoint3DPropertyManager::initializeProperty(QtProperty *property)
 {
-    return d_ptr->m_values.value(property, QPoint());
+    d_ptr->m_values[property] = QPoint3D(0,0,0);
 }
 
 /*!
     \reimp
 */
-QString QtPointPropertyManager::valueText(const QtProperty *property) const
+void QtPoint3DPropertyManager::uninitializeProperty(QtProperty *property)
 {
-    const QtPointPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
-    if (it == d_ptr->m_values.constEnd())
-        return QString();
-    const QPoint v = it.value();
-    return tr("(%1, %2)").arg(QString::number(v.x()))
-                         .arg(QString::number(v.y()));
+    d_ptr->destroySubProperties(property);
+
+    d_ptr->m_values.remove(property);
 }
 
 /*!
-    \fn void QtPointPropertyManager::setValue(QtProperty *property, const QPoint &value)
-
-    Sets the value of the given \a property to \a value. Nested
-    properties are updated automatically.
+    \reimp
 
-    \sa value(), valueChanged()
+    The X, Y and Z subproperties are only created while they are
+    requested.
 */
-void QtPointPropertyManager::setValue(QtProperty *property, const QPoint &val)
+bool QtPoint3DPropertyManager::hasDeferredSubProperties(const QtProperty *property) const
 {
-    const QtPointPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
-    if (it == d_ptr->m_values.end())
-        return;
-
-    if (it.value() == val)
-        return;
-
-    it.value() = val;
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToX[property], val.x());
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToY[property], val.y());
-
-    emit propertyChanged(property);
-    emit valueChanged(property, val);
+    return d_ptr->m_values.contains(property);
 }
 
 /*!
     \reimp
 */
-void QtPointPropertyManager::initializeProperty(QtProperty *property)
+void QtPoint3DPropertyManager::createDeferredSubProperties(QtProperty *property)
 {
-    d_ptr->m_values[property] = QPoint(0, 0);
-
-    QtProperty *xProp = d_ptr->m_intPropertyManager->addProperty();
-    xProp->setPropertyName(tr("X"));
-    d_ptr->m_intPropertyManager->setValue(xProp, 0);
-    d_ptr->m_propertyToX[property] = xProp;
-    d_ptr->m_xToProperty[xProp] = property;
-    property->addSubProperty(xProp);
-
-    QtProperty *yProp = d_ptr->m_intPropertyManager->addProperty();
-    yProp->setPropertyName(tr("Y"));
-    d_ptr->m_intPropertyManager->setValue(yProp, 0);
-    d_ptr->m_propertyToY[property] = yProp;
-    d_ptr->m_yToProperty[yProp] = property;
-    property->addSubProperty(yProp);
+    d_ptr->createSubProperties(property);
 }
 
 /*!
     \reimp
 */
-void QtPointPropertyManager::uninitializeProperty(QtProperty *property)
+void QtPoint3DPropertyManager::destroyDeferredSubProperties(QtProperty *property)
 {
-    QtProperty *xProp = d_ptr->m_propertyToX[property];
-    if (xProp) {
-        d_ptr->m_xToProperty.remove(xProp);
-        delete xProp;
-    }
-    d_ptr->m_propertyToX.remove(property);
-
-    QtProperty *yProp = d_ptr->m_propertyToY[property];
-    if (yProp) {
-        d_ptr->m_yToProperty.remove(yProp);
-        delete yProp;
-    }
-    d_ptr->m_propertyToY.remove(property);
-
-    d_ptr->m_values.remove(property);
+    d_ptr->destroySubProperties(property);
 }
 
-//########## start of QtPoint3DPropertyManager implementation
-void QtPoint3DPropertyManagerPrivate::slotIntChanged(QtProperty *property, int value)
+//########## end of QtPoint3DPropertyManager implementation
+
+//########## start of QtRotation3DPropertyManager implementation
+void QtRotation3DPropertyManagerPrivate::slotIntChanged(QtProperty *property, int value)
 {
     if (QtProperty *xprop = m_xToProperty.value(property, 0)) {
-        QPoint3D p = m_values[xprop];
+        QRotation3D p = m_values[xprop];
         p.setX(value);
         q_ptr->setValue(xprop, p);
     } else if (QtProperty *yprop = m_yToProperty.value(property, 0)) {
-        QPoint3D p = m_values[yprop];
+        QRotation3D p = m_values[yprop];
         p.setY(value);
         q_ptr->setValue(yprop, p);
     }else if (QtProperty *zprop = m_zToProperty.value(property, 0)) {
-        QPoint3D p = m_values[zprop];
+        QRotation3D p = m_values[zprop];
         p.setZ(value);
         q_ptr->setValue(zprop, p);
     }
 }
 
-void QtPoint3DPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
+void QtRotation3DPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
 {
     if (QtProperty *pointProp = m_xToProperty.value(property, 0)) {
         m_propertyToX[pointProp] = 0;
@@ -2407,8 +4804,59 @@ void QtPoint3DPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property
     }
 }
 
-QtPoint3DPropertyManager::QtPoint3DPropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtPoint3DPropertyManagerPrivate)
+void QtRotation3DPropertyManagerPrivate::createSubProperties(QtProperty *property)
+{
+    const auto it = m_values.constFind(property);
+    if (it == m_values.constEnd() || m_propertyToX.value(property, 0))
+        return;
+
+    const auto val = it.value();
+
+    QtProperty *xProp = m_intPropertyManager->addProperty();
+    xProp->setPropertyName(QtRotation3DPropertyManager::tr("X"));
+    m_intPropertyManager->setValue(xProp, val.x());
+    m_propertyToX[property] = xProp;
+    m_xToProperty[xProp] = property;
+    property->addSubProperty(xProp);
+
+    QtProperty *yProp = m_intPropertyManager->addProperty();
+    yProp->setPropertyName(QtRotation3DPropertyManager::tr("Y"));
+    m_intPropertyManager->setValue(yProp, val.y());
+    m_propertyToY[property] = yProp;
+    m_yToProperty[yProp] = property;
+    property->addSubProperty(yProp);
+
+    QtProperty *zProp = m_intPropertyManager->addProperty();
+    zProp->setPropertyName(QtRotation3DPropertyManager::tr("Z"));
+    m_intPropertyManager->setValue(zProp, val.z());
+    m_propertyToZ[property] = zProp;
+    m_zToProperty[zProp] = property;
+    property->addSubProperty(zProp);
+}
+
+void QtRotation3DPropertyManagerPrivate::destroySubProperties(QtProperty *property)
+{
+    if (QtProperty *xProp = m_propertyToX.value(property, 0)) {
+        m_xToProperty.remove(xProp);
+        delete xProp;
+    }
+    m_propertyToX.remove(property);
+
+    if (QtProperty *yProp = m_propertyToY.value(property, 0)) {
+        m_yToProperty.remove(yProp);
+        delete yProp;
+    }
+    m_propertyToY.remove(property);
+
+    if (QtProperty *zProp = m_propertyToZ.value(property, 0)) {
+        m_zToProperty.remove(zProp);
+        delete zProp;
+    }
+    m_propertyToZ.remove(property);
+}
+
+QtRotation3DPropertyManager::QtRotation3DPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtRotation3DPropertyManagerPrivate)
 {
     d_ptr->q_ptr = this;
 
@@ -2419,35 +4867,35 @@ QtPoint3DPropertyManager::QtPoint3DPropertyManager(QObject *parent)
                 this, SLOT(slotPropertyDestroyed(QtProperty*)));
 }
 
-QtPoint3DPropertyManager::~QtPoint3DPropertyManager()
+QtRotation3DPropertyManager::~QtRotation3DPropertyManager()
 {
     clear();
 }
 
-QtIntPropertyManager *QtPoint3DPropertyManager::subIntPropertyManager() const
+QtIntPropertyManager *QtRotation3DPropertyManager::subIntPropertyManager() const
 {
     return d_ptr->m_intPropertyManager;
 }
 
-QPoint3D QtPoint3DPropertyManager::value(const QtProperty *property) const
+QRotation3D QtRotation3DPropertyManager::value(const QtProperty *property) const
 {
-    return d_ptr->m_values.value(property, QPoint3D());
+    return d_ptr->m_values.value(property, QRotation3D());
 }
 
-QString QtPoint3DPropertyManager::valueText(const QtProperty *property) const
+QString QtRotation3DPropertyManager::valueText(const QtProperty *property) const
 {
-    const QtPoint3DPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    const QtRotation3DPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
     if (it == d_ptr->m_values.constEnd())
         return QString();
-    const QPoint3D v = it.value();
-    return tr("(%1, %2, %3)").arg(QString::number(v.x()))
-                             .arg(QString::number(v.y()))
-                             .arg(QString::number(v.z()));
+    const QRotation3D v = it.value();
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("(%1, %2, %3)"));
+    return text({v.x(), v.y(), v.z()});
 }
 
-void QtPoint3DPropertyManager::setValue(QtProperty *property, const QPoint3D &val)
+void QtRotation3DPropertyManager::setValue(QtProperty *property, const QRotation3D &val)
 {
-    const QtPoint3DPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    const QtRotation3DPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
 
@@ -2455,209 +4903,450 @@ void QtPoint3DPropertyManager::setValue(QtProperty *property, const QPoint3D &va
         return;
 
     it.value() = val;
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToX[property], val.x());
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToY[property], val.y());
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToZ[property], val.z());
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToX.value(property, 0), val.x());
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToY.value(property, 0), val.y());
+    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToZ.value(property, 0), val.z());
 
     emit propertyChanged(property);
     emit valueChanged(property, val);
 }
 
-void QtPoint3DPropertyManager::initializeProperty(QtProperty *property)
+/*!
+    \reimp
+*/
+QVariant QtRotation3DPropertyManager::journalValue(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = QPoint3D(0,0,0);
+    return QVariant::fromValue(value(property));
+}
 
-    QtProperty *xProp = d_ptr->m_intPropertyManager->addProperty();
-    xProp->setPropertyName(tr("X"));
-    d_ptr->m_intPropertyManager->setValue(xProp, 0);
-    d_ptr->m_propertyToX[property] = xProp;
-    d_ptr->m_xToProperty[xProp] = property;
-    property->addSubProperty(xProp);
+/*!
+    \reimp
+*/
+void QtRotation3DPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
 
-    QtProperty *yProp = d_ptr->m_intPropertyManager->addProperty();
-    yProp->setPropertyName(tr("Y"));
-    d_ptr->m_intPropertyManager->setValue(yProp, 0);
-    d_ptr->m_propertyToY[property] = yProp;
-    d_ptr->m_yToProperty[yProp] = property;
-    property->addSubProperty(yProp);
+/*!
+    \reimp
+*/
+void QtRotation3DPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QRotation3D>());
+}
 
-    QtProperty *zProp = d_ptr->m_intPropertyManager->addProperty();
-    zProp->setPropertyName(tr("Z"));
-    d_ptr->m_intPropertyManager->setValue(zProp, 0);
-    d_ptr->m_propertyToZ[property] = zProp;
-    d_ptr->m_zToProperty[zProp] = property;
-    property->addSubProperty(zProp);
+/*!
+    \reimp
+*/
+void QtRotation3DPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QRotation3D(0,0,0);
 }
 
-void QtPoint3DPropertyManager::uninitializeProperty(QtProperty *property)
+/*!
+    \reimp
+*/
+void QtRotation3DPropertyManager::uninitializeProperty(QtProperty *property)
 {
-    QtProperty *xProp = d_ptr->m_propertyToX[property];
-    if (xProp) {
-        d_ptr->m_xToProperty.remove(xProp);
-        delete xProp;
-    }
-    d_ptr->m_propertyToX.remove(property);
+    d_ptr->destroySubProperties(property);
 
-    QtProperty *yProp = d_ptr->m_propertyToY[property];
-    if (yProp) {
-        d_ptr->m_yToProperty.remove(yProp);
-        delete yProp;
-    }
-    d_ptr->m_propertyToY.remove(property);
+    d_ptr->m_values.remove(property);
+}
 
-    QtProperty *zProp = d_ptr->m_propertyToZ[property];
-    if (zProp) {
-        d_ptr->m_zToProperty.remove(zProp);
-        delete zProp;
-    }
-    d_ptr->m_propertyToZ.remove(property);
+/*!
+    \reimp
 
-    d_ptr->m_values.remove(property);
+    The X, Y and Z subproperties are only created while they are
+    requested.
+*/
+bool QtRotation3DPropertyManager::hasDeferredSubProperties(const QtProperty *property) const
+{
+    return d_ptr->m_values.contains(property);
 }
 
-//########## end of QtPoint3DPropertyManager implementation
+/*!
+    \reimp
+*/
+void QtRotation3DPropertyManager::createDeferredSubProperties(QtProperty *property)
+{
+    d_ptr->createSubProperties(property);
+}
 
-//########## start of QtRotation3DPropertyManager implementation
-void QtRotation3DPropertyManagerPrivate::slotIntChanged(QtProperty *property, int value)
+/*!
+    \reimp
+*/
+void QtRotation3DPropertyManager::destroyDeferredSubProperties(QtProperty *property)
 {
-    if (QtProperty *xprop = m_xToProperty.value(property, 0)) {
-        QRotation3D p = m_values[xprop];
-        p.setX(value);
-        q_ptr->setValue(xprop, p);
-    } else if (QtProperty *yprop = m_yToProperty.value(property, 0)) {
-        QRotation3D p = m_values[yprop];
-        p.setY(value);
-        q_ptr->setValue(yprop, p);
-    }else if (QtProperty *zprop = m_zToProperty.value(property, 0)) {
-        QRotation3D p = m_values[zprop];
-        p.setZ(value);
-        q_ptr->setValue(zprop, p);
+    d_ptr->destroySubProperties(property);
+}
+
+//########## end of QtRotation3DPropertyManager implementation
+
+//########## start of QtQuaternionPropertyManager implementation
+static const char *const quaternionComponentNames[QtQuaternionPropertyManagerPrivate::ComponentCount] = {
+    QT_TRANSLATE_NOOP("QtQuaternionPropertyManager", "Pitch"),
+    QT_TRANSLATE_NOOP("QtQuaternionPropertyManager", "Yaw"),
+    QT_TRANSLATE_NOOP("QtQuaternionPropertyManager", "Roll"),
+    QT_TRANSLATE_NOOP("QtQuaternionPropertyManager", "Axis X"),
+    QT_TRANSLATE_NOOP("QtQuaternionPropertyManager", "Axis Y"),
+    QT_TRANSLATE_NOOP("QtQuaternionPropertyManager", "Axis Z"),
+    QT_TRANSLATE_NOOP("QtQuaternionPropertyManager", "Angle")
+};
+
+void QtQuaternionPropertyManagerPrivate::slotDoubleChanged(QtProperty *property, double value)
+{
+    Q_UNUSED(value);
+    if (m_updatingComponents)
+        return;
+
+    QtProperty *prop = m_componentToProperty.value(property, 0);
+    if (prop == 0)
+        return;
+
+    const QList<QtProperty *> components = m_propertyToComponents.value(prop);
+    const auto component = [&](int c) {
+        QtProperty *p = components.value(c, 0);
+        return p ? float(m_doublePropertyManager->value(p)) : 0.0f;
+    };
+
+    switch (components.indexOf(property)) {
+    case Pitch:
+    case Yaw:
+    case Roll:
+        q_ptr->setValue(prop, QQuaternion::fromEulerAngles(component(Pitch), component(Yaw), component(Roll)));
+        break;
+    case AxisX:
+    case AxisY:
+    case AxisZ:
+    case Angle:
+        q_ptr->setValue(prop, QQuaternion::fromAxisAndAngle(component(AxisX), component(AxisY), component(AxisZ),
+                                                            component(Angle)));
+        break;
+    default:
+        break;
+    }
+}
+
+void QtQuaternionPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
+{
+    QtProperty *prop = m_componentToProperty.value(property, 0);
+    if (prop == 0)
+        return;
+
+    QList<QtProperty *> &components = m_propertyToComponents[prop];
+    components.replace(components.indexOf(property), 0);
+    m_componentToProperty.remove(property);
+}
+
+void QtQuaternionPropertyManagerPrivate::createComponentProperties(QtProperty *property)
+{
+    const auto it = m_values.constFind(property);
+    if (it == m_values.constEnd() || m_propertyToComponents.contains(property))
+        return;
+
+    QList<QtProperty *> &components = m_propertyToComponents[property];
+    for (int c = 0; c < ComponentCount; ++c) {
+        QtProperty *prop = m_doublePropertyManager->addProperty();
+        prop->setPropertyName(QtQuaternionPropertyManager::tr(quaternionComponentNames[c]));
+        m_doublePropertyManager->setDecimals(prop, it.value().decimals);
+        if (c >= AxisX && c <= AxisZ) {
+            m_doublePropertyManager->setRange(prop, -1.0, 1.0);
+            m_doublePropertyManager->setSingleStep(prop, 0.1);
+        } else {
+            m_doublePropertyManager->setRange(prop, -360.0, 360.0);
+        }
+        components.append(prop);
+        m_componentToProperty[prop] = property;
+        property->addSubProperty(prop);
+    }
+    updateComponentProperties(property);
+}
+
+void QtQuaternionPropertyManagerPrivate::destroyComponentProperties(QtProperty *property)
+{
+    const auto it = m_propertyToComponents.find(property);
+    if (it == m_propertyToComponents.end())
+        return;
+
+    const QList<QtProperty *> components = it.value();
+    m_propertyToComponents.erase(it);
+    for (QtProperty *prop : components) {
+        if (prop) {
+            m_componentToProperty.remove(prop);
+            delete prop;
+        }
     }
 }
 
-void QtRotation3DPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
+void QtQuaternionPropertyManagerPrivate::updateComponentProperties(const QtProperty *property)
 {
-    if (QtProperty *pointProp = m_xToProperty.value(property, 0)) {
-        m_propertyToX[pointProp] = 0;
-        m_xToProperty.remove(property);
-    } else if (QtProperty *pointProp = m_yToProperty.value(property, 0)) {
-        m_propertyToY[pointProp] = 0;
-        m_yToProperty.remove(property);
-    }else if (QtProperty *pointProp = m_zToProperty.value(property, 0)) {
-        m_propertyToZ[pointProp] = 0;
-        m_zToProperty.remove(property);
+    const auto it = m_propertyToComponents.constFind(property);
+    if (it == m_propertyToComponents.constEnd())
+        return;
+
+    const QQuaternion val = m_values.value(property).val;
+    const QVector3D euler = val.toEulerAngles();
+    QVector3D axis;
+    float angle = 0;
+    val.getAxisAndAngle(&axis, &angle);
+
+    const double values[ComponentCount] = { euler.x(), euler.y(), euler.z(),
+                                            axis.x(), axis.y(), axis.z(), angle };
+
+    // The derived values are only a view of the quaternion; don't feed them back.
+    m_updatingComponents = true;
+    const QList<QtProperty *> &components = it.value();
+    for (int c = 0; c < ComponentCount; ++c) {
+        if (QtProperty *prop = components.value(c, 0))
+            m_doublePropertyManager->setValue(prop, values[c]);
     }
+    m_updatingComponents = false;
 }
 
-QtRotation3DPropertyManager::QtRotation3DPropertyManager(QObject *parent)
-    : QtAbstractPropertyManager(parent), d_ptr(new QtRotation3DPropertyManagerPrivate)
+/*!
+    \class QtQuaternionPropertyManager
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtQuaternionPropertyManager provides and manages 3D rotation
+    properties stored as quaternions.
+
+    The rotation is kept as a normalized QQuaternion, so it is neither
+    limited to whole degrees nor subject to the ambiguities of Euler
+    angles. A property's value can be retrieved and set using the value()
+    and setValue() slots respectively; setting a value is a single update
+    regardless of how the rotation is presented.
+
+    The manager provides subproperties showing the rotation as Euler angles
+    (pitch, yaw and roll in degrees) and as an axis and angle. These are
+    derived views: they are created on demand, i.e. only while a property
+    browser shows them (see QtProperty::requestSubProperties()), and editing
+    any of them recomposes the quaternion. The subproperties are created by
+    a QtDoublePropertyManager object which can be retrieved using the
+    subDoublePropertyManager() function.
+
+    \sa QtAbstractPropertyManager, QtRotation3DPropertyManager
+*/
+
+/*!
+    \fn void QtQuaternionPropertyManager::valueChanged(QtProperty *property, const QQuaternion &value)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the new
+    \a value as parameters.
+
+    \sa setValue()
+*/
+
+/*!
+    \fn void QtQuaternionPropertyManager::decimalsChanged(QtProperty *property, int prec)
+
+    This signal is emitted whenever a property created by this manager
+    changes its precision of value, passing a pointer to the
+    \a property and the new \a prec value
+
+    \sa setDecimals()
+*/
+
+/*!
+    Creates a manager with the given \a parent.
+*/
+QtQuaternionPropertyManager::QtQuaternionPropertyManager(QObject *parent)
+    : QtAbstractPropertyManager(parent), d_ptr(new QtQuaternionPropertyManagerPrivate)
 {
     d_ptr->q_ptr = this;
 
-    d_ptr->m_intPropertyManager = new QtIntPropertyManager(this);
-    connect(d_ptr->m_intPropertyManager, SIGNAL(valueChanged(QtProperty*,int)),
-                this, SLOT(slotIntChanged(QtProperty*,int)));
-    connect(d_ptr->m_intPropertyManager, SIGNAL(propertyDestroyed(QtProperty*)),
+    d_ptr->m_doublePropertyManager = new QtDoublePropertyManager(this);
+    connect(d_ptr->m_doublePropertyManager, SIGNAL(valueChanged(QtProperty*,double)),
+                this, SLOT(slotDoubleChanged(QtProperty*,double)));
+    connect(d_ptr->m_doublePropertyManager, SIGNAL(propertyDestroyed(QtProperty*)),
                 this, SLOT(slotPropertyDestroyed(QtProperty*)));
 }
 
-QtRotation3DPropertyManager::~QtRotation3DPropertyManager()
+/*!
+    Destroys this manager, and all the properties it has created.
+*/
+QtQuaternionPropertyManager::~QtQuaternionPropertyManager()
 {
     clear();
 }
 
-QtIntPropertyManager *QtRotation3DPropertyManager::subIntPropertyManager() const
+/*!
+    Returns the manager that creates the derived Euler angle and
+    axis-angle subproperties.
+*/
+QtDoublePropertyManager *QtQuaternionPropertyManager::subDoublePropertyManager() const
 {
-    return d_ptr->m_intPropertyManager;
+    return d_ptr->m_doublePropertyManager;
 }
 
-QRotation3D QtRotation3DPropertyManager::value(const QtProperty *property) const
+/*!
+    Returns the given \a property's value.
+
+    If the given property is not managed by this manager, this
+    function returns the identity rotation.
+
+    \sa setValue()
+*/
+QQuaternion QtQuaternionPropertyManager::value(const QtProperty *property) const
 {
-    return d_ptr->m_values.value(property, QRotation3D());
+    return getValue<QQuaternion>(d_ptr->m_values, property);
 }
 
-QString QtRotation3DPropertyManager::valueText(const QtProperty *property) const
+/*!
+    Returns the given \a property's precision, in decimals.
+
+    \sa setDecimals()
+*/
+int QtQuaternionPropertyManager::decimals(const QtProperty *property) const
 {
-    const QtRotation3DPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    return getData<int>(d_ptr->m_values, &QtQuaternionPropertyManagerPrivate::Data::decimals, property, 0);
+}
+
+/*!
+    \reimp
+*/
+QString QtQuaternionPropertyManager::valueText(const QtProperty *property) const
+{
+    const QtQuaternionPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
     if (it == d_ptr->m_values.constEnd())
         return QString();
-    const QRotation3D v = it.value();
-    return tr("(%1, %2, %3)").arg(QString::number(v.x()))
-                             .arg(QString::number(v.y()))
-                             .arg(QString::number(v.z()));
+    const QVector3D euler = it.value().val.toEulerAngles();
+    const int dec = it.value().decimals;
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("(%1, %2, %3)"));
+    return text({euler.x(), euler.y(), euler.z()}, dec);
 }
 
-void QtRotation3DPropertyManager::setValue(QtProperty *property, const QRotation3D &val)
+/*!
+    \fn void QtQuaternionPropertyManager::setValue(QtProperty *property, const QQuaternion &value)
+
+    Sets the value of the given \a property to \a value. The quaternion
+    is normalized; a null quaternion is treated as the identity rotation.
+
+    Derived subproperties are only updated if they currently exist.
+
+    \sa value(), valueChanged()
+*/
+void QtQuaternionPropertyManager::setValue(QtProperty *property, const QQuaternion &val)
 {
-    const QtRotation3DPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    const QtQuaternionPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
 
-    if (it.value() == val)
+    const QQuaternion rotation = val.isNull() ? QQuaternion() : val.normalized();
+    if (it.value().val == rotation)
         return;
 
-    it.value() = val;
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToX[property], val.x());
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToY[property], val.y());
-    d_ptr->m_intPropertyManager->setValue(d_ptr->m_propertyToZ[property], val.z());
+    it.value().val = rotation;
+    d_ptr->updateComponentProperties(property);
 
     emit propertyChanged(property);
-    emit valueChanged(property, val);
+    emit valueChanged(property, rotation);
 }
 
-void QtRotation3DPropertyManager::initializeProperty(QtProperty *property)
+/*!
+    \fn void QtQuaternionPropertyManager::setDecimals(QtProperty *property, int prec)
+
+    Sets the precision of the given \a property to \a prec.
+
+    The valid decimal range is 0-13. The default is 2.
+
+    \sa decimals()
+*/
+void QtQuaternionPropertyManager::setDecimals(QtProperty *property, int prec)
 {
-    d_ptr->m_values[property] = QRotation3D(0,0,0);
+    const QtQuaternionPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
 
-    QtProperty *xProp = d_ptr->m_intPropertyManager->addProperty();
-    xProp->setPropertyName(tr("X"));
-    d_ptr->m_intPropertyManager->setValue(xProp, 0);
-    d_ptr->m_propertyToX[property] = xProp;
-    d_ptr->m_xToProperty[xProp] = property;
-    property->addSubProperty(xProp);
+    if (prec > 13)
+        prec = 13;
+    else if (prec < 0)
+        prec = 0;
 
-    QtProperty *yProp = d_ptr->m_intPropertyManager->addProperty();
-    yProp->setPropertyName(tr("Y"));
-    d_ptr->m_intPropertyManager->setValue(yProp, 0);
-    d_ptr->m_propertyToY[property] = yProp;
-    d_ptr->m_yToProperty[yProp] = property;
-    property->addSubProperty(yProp);
+    if (it.value().decimals == prec)
+        return;
 
-    QtProperty *zProp = d_ptr->m_intPropertyManager->addProperty();
-    zProp->setPropertyName(tr("Z"));
-    d_ptr->m_intPropertyManager->setValue(zProp, 0);
-    d_ptr->m_propertyToZ[property] = zProp;
-    d_ptr->m_zToProperty[zProp] = property;
-    property->addSubProperty(zProp);
+    it.value().decimals = prec;
+    for (QtProperty *prop : d_ptr->m_propertyToComponents.value(property)) {
+        if (prop)
+            d_ptr->m_doublePropertyManager->setDecimals(prop, prec);
+    }
+
+    emit decimalsChanged(property, prec);
+    emit propertyChanged(property);
 }
 
-void QtRotation3DPropertyManager::uninitializeProperty(QtProperty *property)
+/*!
+    \reimp
+*/
+QVariant QtQuaternionPropertyManager::journalValue(const QtProperty *property) const
 {
-    QtProperty *xProp = d_ptr->m_propertyToX[property];
-    if (xProp) {
-        d_ptr->m_xToProperty.remove(xProp);
-        delete xProp;
-    }
-    d_ptr->m_propertyToX.remove(property);
+    return QVariant::fromValue(value(property));
+}
 
-    QtProperty *yProp = d_ptr->m_propertyToY[property];
-    if (yProp) {
-        d_ptr->m_yToProperty.remove(yProp);
-        delete yProp;
-    }
-    d_ptr->m_propertyToY.remove(property);
+/*!
+    \reimp
+*/
+void QtQuaternionPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
 
-    QtProperty *zProp = d_ptr->m_propertyToZ[property];
-    if (zProp) {
-        d_ptr->m_zToProperty.remove(zProp);
-        delete zProp;
-    }
-    d_ptr->m_propertyToZ.remove(property);
+/*!
+    \reimp
+*/
+void QtQuaternionPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QQuaternion>());
+}
+
+/*!
+    \reimp
+*/
+void QtQuaternionPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QtQuaternionPropertyManagerPrivate::Data();
+}
+
+/*!
+    \reimp
+*/
+void QtQuaternionPropertyManager::uninitializeProperty(QtProperty *property)
+{
+    d_ptr->destroyComponentProperties(property);
 
     d_ptr->m_values.remove(property);
 }
 
-//########## end of QtRotation3DPropertyManager implementation
+/*!
+    \reimp
+
+    The Euler angle and axis-angle subproperties are only created while
+    they are requested.
+*/
+bool QtQuaternionPropertyManager::hasDeferredSubProperties(const QtProperty *property) const
+{
+    return d_ptr->m_values.contains(property);
+}
+
+/*!
+    \reimp
+*/
+void QtQuaternionPropertyManager::createDeferredSubProperties(QtProperty *property)
+{
+    d_ptr->createComponentProperties(property);
+}
+
+/*!
+    \reimp
+*/
+void QtQuaternionPropertyManager::destroyDeferredSubProperties(QtProperty *property)
+{
+    d_ptr->destroyComponentProperties(property);
+}
+//########## end of QtQuaternionPropertyManager implementation
 
 //########## start of QtPoint3DFPropertyManager implementation
 void QtPoint3DFPropertyManagerPrivate::slotDoubleChanged(QtProperty *property, double value)
@@ -2693,6 +5382,69 @@ void QtPoint3DFPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *propert
 }
 
 
+QList<QPoint3DF> QtPoint3DFPropertyManagerPrivate::values(const QList<QtProperty *> &properties) const
+{
+    QList<QPoint3DF> result;
+    result.reserve(properties.size());
+    for (QtProperty *property : properties)
+        result.append(m_values.value(property).val);
+    return result;
+}
+
+void QtPoint3DFPropertyManagerPrivate::createSubProperties(QtProperty *property)
+{
+    const auto it = m_values.constFind(property);
+    if (it == m_values.constEnd() || m_propertyToX.value(property, 0))
+        return;
+
+    const auto val = it.value().val;
+
+    QtProperty *xProp = m_doublePropertyManager->addProperty();
+    xProp->setPropertyName(QtPoint3DFPropertyManager::tr("X"));
+    m_doublePropertyManager->setDecimals(xProp, it.value().decimals);
+    m_doublePropertyManager->setValue(xProp, val.x());
+    m_propertyToX[property] = xProp;
+    m_xToProperty[xProp] = property;
+    property->addSubProperty(xProp);
+
+    QtProperty *yProp = m_doublePropertyManager->addProperty();
+    yProp->setPropertyName(QtPoint3DFPropertyManager::tr("Y"));
+    m_doublePropertyManager->setDecimals(yProp, it.value().decimals);
+    m_doublePropertyManager->setValue(yProp, val.y());
+    m_propertyToY[property] = yProp;
+    m_yToProperty[yProp] = property;
+    property->addSubProperty(yProp);
+
+    QtProperty *zProp = m_doublePropertyManager->addProperty();
+    zProp->setPropertyName(QtPoint3DFPropertyManager::tr("Z"));
+    m_doublePropertyManager->setDecimals(zProp, it.value().decimals);
+    m_doublePropertyManager->setValue(zProp, val.z());
+    m_propertyToZ[property] = zProp;
+    m_zToProperty[zProp] = property;
+    property->addSubProperty(zProp);
+}
+
+void QtPoint3DFPropertyManagerPrivate::destroySubProperties(QtProperty *property)
+{
+    if (QtProperty *xProp = m_propertyToX.value(property, 0)) {
+        m_xToProperty.remove(xProp);
+        delete xProp;
+    }
+    m_propertyToX.remove(property);
+
+    if (QtProperty *yProp = m_propertyToY.value(property, 0)) {
+        m_yToProperty.remove(yProp);
+        delete yProp;
+    }
+    m_propertyToY.remove(property);
+
+    if (QtProperty *zProp = m_propertyToZ.value(property, 0)) {
+        m_zToProperty.remove(zProp);
+        delete zProp;
+    }
+    m_propertyToZ.remove(property);
+}
+
 QtPoint3DFPropertyManager::QtPoint3DFPropertyManager(QObject *parent)
     : QtAbstractPropertyManager(parent), d_ptr(new QtPoint3DFPropertyManagerPrivate)
 {
@@ -2735,13 +5487,13 @@ QString QtPoint3DFPropertyManager::valueText(const QtProperty *property) const
         return QString();
     const QPoint3DF v = it.value().val;
     const int dec =  it.value().decimals;
-    return tr("(%1, %2, %3)").arg(QString::number(v.x(), 'f', dec))
-                         .arg(QString::number(v.y(), 'f', dec))
-                         .arg(QString::number(v.z(), 'f', dec));
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("(%1, %2, %3)"));
+    return text({v.x(), v.y(), v.z()}, dec);
 }
 
 void QtPoint3DFPropertyManager::setValue(QtProperty *property, const QPoint3DF &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtPoint3DFPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
@@ -2750,14 +5502,111 @@ void QtPoint3DFPropertyManager::setValue(QtProperty *property, const QPoint3DF &
         return;
 
     it.value().val = val;
-    d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToX[property], val.x());
-    d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToY[property], val.y());
-    d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToZ[property], val.z());
+    d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToX.value(property, 0), val.x());
+    d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToY.value(property, 0), val.y());
+    d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToZ.value(property, 0), val.z());
 
     emit propertyChanged(property);
     emit valueChanged(property, val);
 }
 
+/*!
+    Sets the values of all \a properties at once, \a values holding the new
+    value of the property at the same index. Properties not managed by this
+    manager are skipped.
+
+    propertyChanged() is emitted for each property whose value changed, but
+    instead of one valueChanged() signal per property, valuesChanged() is
+    emitted once with the list of the changed properties.
+
+    \sa setValue()
+*/
+void QtPoint3DFPropertyManager::setValues(const QList<QtProperty *> &properties, const QList<QPoint3DF> &values)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
+    QList<QtProperty *> changed;
+    // The whole batch is undone and redone as one journal step.
+    beginJournalGroup();
+    const qsizetype count = qMin(properties.size(), values.size());
+    for (qsizetype i = 0; i < count; ++i) {
+        QtProperty *property = properties.at(i);
+        const QtPoint3DFPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+        if (it == d_ptr->m_values.end())
+            continue;
+
+        const QPoint3DF &val = values.at(i);
+        if (it.value().val == val)
+            continue;
+
+        it.value().val = val;
+        d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToX.value(property, 0), val.x());
+        d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToY.value(property, 0), val.y());
+        d_ptr->m_doublePropertyManager->setValue(d_ptr->m_propertyToZ.value(property, 0), val.z());
+
+        emit propertyChanged(property);
+        changed.append(property);
+    }
+    endJournalGroup();
+
+    if (!changed.isEmpty())
+        emit valuesChanged(changed);
+}
+
+/*!
+    Moves all \a properties by \a offset.
+
+    \sa setValues()
+*/
+void QtPoint3DFPropertyManager::translate(const QList<QtProperty *> &properties, const QPoint3DF &offset)
+{
+    QList<QPoint3DF> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), offset);
+    setValues(properties, vals);
+}
+
+/*!
+    Scales all \a properties by \a factor relative to \a origin.
+
+    \sa setValues()
+*/
+void QtPoint3DFPropertyManager::scale(const QList<QtProperty *> &properties, double factor, const QPoint3DF &origin)
+{
+    QList<QPoint3DF> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), -origin);
+    QPoint3DMath::scale(vals.data(), vals.size(), factor);
+    QPoint3DMath::translate(vals.data(), vals.size(), origin);
+    setValues(properties, vals);
+}
+
+/*!
+    Rotates all \a properties around \a origin by the Euler \a angles,
+    given in degrees.
+
+    \sa setValues()
+*/
+void QtPoint3DFPropertyManager::rotate(const QList<QtProperty *> &properties, const QRotation3D &angles, const QPoint3DF &origin)
+{
+    QList<QPoint3DF> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), -origin);
+    QPoint3DMath::rotate(vals.data(), vals.size(), angles);
+    QPoint3DMath::translate(vals.data(), vals.size(), origin);
+    setValues(properties, vals);
+}
+
+/*!
+    \overload
+
+    Rotates all \a properties around \a origin by the quaternion \a rotation.
+*/
+void QtPoint3DFPropertyManager::rotate(const QList<QtProperty *> &properties, const QQuaternion &rotation, const QPoint3DF &origin)
+{
+    QList<QPoint3DF> vals = d_ptr->values(properties);
+    QPoint3DMath::translate(vals.data(), vals.size(), -origin);
+    QPoint3DMath::rotate(vals.data(), vals.size(), rotation);
+    QPoint3DMath::translate(vals.data(), vals.size(), origin);
+    setValues(properties, vals);
+}
+
 void QtPoint3DFPropertyManager::setDecimals(QtProperty *property, int prec)
 {
     const QtPoint3DFPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
@@ -2775,70 +5624,99 @@ void QtPoint3DFPropertyManager::setDecimals(QtProperty *property, int prec)
         return;
 
     data.decimals = prec;
-    d_ptr->m_doublePropertyManager->setDecimals(d_ptr->m_propertyToX[property], prec);
-    d_ptr->m_doublePropertyManager->setDecimals(d_ptr->m_propertyToY[property], prec);
-    d_ptr->m_doublePropertyManager->setDecimals(d_ptr->m_propertyToZ[property], prec);
+    d_ptr->m_doublePropertyManager->setDecimals(d_ptr->m_propertyToX.value(property, 0), prec);
+    d_ptr->m_doublePropertyManager->setDecimals(d_ptr->m_propertyToY.value(property, 0), prec);
+    d_ptr->m_doublePropertyManager->setDecimals(d_ptr->m_propertyToZ.value(property, 0), prec);
 
     it.value() = data;
 
+    emit propertyChanged(property);
     emit decimalsChanged(property, data.decimals);
 }
 
 
-void QtPoint3DFPropertyManager::initializeProperty(QtProperty *property)
+/*!
+    \reimp
+*/
+QVariant QtPoint3DFPropertyManager::journalValue(const QtProperty *property) const
 {
-    d_ptr->m_values[property] = QtPoint3DFPropertyManagerPrivate::Data();
+    return QVariant::fromValue(value(property));
+}
 
-    QtProperty *xProp = d_ptr->m_doublePropertyManager->addProperty();
-    xProp->setPropertyName(tr("X"));
-    d_ptr->m_doublePropertyManager->setDecimals(xProp, decimals(property));
-    d_ptr->m_doublePropertyManager->setValue(xProp, 0);
-    d_ptr->m_propertyToX[property] = xProp;
-    d_ptr->m_xToProperty[xProp] = property;
-    property->addSubProperty(xProp);
+/*!
+    \reimp
+*/
+void QtPoint3DFPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
 
-    QtProperty *yProp = d_ptr->m_doublePropertyManager->addProperty();
-    yProp->setPropertyName(tr("Y"));
-    d_ptr->m_doublePropertyManager->setDecimals(yProp, decimals(property));
-    d_ptr->m_doublePropertyManager->setValue(yProp, 0);
-    d_ptr->m_propertyToY[property] = yProp;
-    d_ptr->m_yToProperty[yProp] = property;
-    property->addSubProperty(yProp);
+/*!
+    \reimp
+*/
+void QtPoint3DFPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QPoint3DF>());
+}
 
-    QtProperty *zProp = d_ptr->m_doublePropertyManager->addProperty();
-    zProp->setPropertyName(tr("Z"));
-    d_ptr->m_doublePropertyManager->setDecimals(zProp, decimals(property));
-    d_ptr->m_doublePropertyManager->setValue(zProp, 0);
-    d_ptr->m_propertyToZ[property] = zProp;
-    d_ptr->m_zToProperty[zProp] = property;
-    property->addSubProperty(zProp);
+/*!
+    \reimp
+
+    Applies the step through setValues(), so that it is reported by one
+    valuesChanged() signal.
+*/
+void QtPoint3DFPropertyManager::setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values)
+{
+    QList<QPoint3DF> vals;
+    vals.reserve(values.size());
+    for (const QVariant &value : values)
+        vals.append(value.value<QPoint3DF>());
+    setValues(properties, vals);
 }
 
+/*!
+    \reimp
+*/
+void QtPoint3DFPropertyManager::initializeProperty(QtProperty *property)
+{
+    d_ptr->m_values[property] = QtPoint3DFPropertyManagerPrivate::Data();
+}
 
+/*!
+    \reimp
+*/
 void QtPoint3DFPropertyManager::uninitializeProperty(QtProperty *property)
 {
-    QtProperty *xProp = d_ptr->m_propertyToX[property];
-    if (xProp) {
-        d_ptr->m_xToProperty.remove(xProp);
-        delete xProp;
-    }
-    d_ptr->m_propertyToX.remove(property);
+    d_ptr->destroySubProperties(property);
 
-    QtProperty *yProp = d_ptr->m_propertyToY[property];
-    if (yProp) {
-        d_ptr->m_yToProperty.remove(yProp);
-        delete yProp;
-    }
-    d_ptr->m_propertyToY.remove(property);
+    d_ptr->m_values.remove(property);
+}
 
-    QtProperty *zProp = d_ptr->m_propertyToZ[property];
-    if (zProp) {
-        d_ptr->m_zToProperty.remove(zProp);
-        delete zProp;
-    }
-    d_ptr->m_propertyToZ.remove(property);
+/*!
+    \reimp
 
-    d_ptr->m_values.remove(property);
+    The X, Y and Z subproperties are only created while they are
+    requested.
+*/
+bool QtPoint3DFPropertyManager::hasDeferredSubProperties(const QtProperty *property) const
+{
+    return d_ptr->m_values.contains(property);
+}
+
+/*!
+    \reimp
+*/
+void QtPoint3DFPropertyManager::createDeferredSubProperties(QtProperty *property)
+{
+    d_ptr->createSubProperties(property);
+}
+
+/*!
+    \reimp
+*/
+void QtPoint3DFPropertyManager::destroyDeferredSubProperties(QtProperty *property)
+{
+    d_ptr->destroySubProperties(property);
 }
 
 //########## end of QtPoint3DFPropertyManager implementation
@@ -2982,8 +5860,8 @@ QString QtPointFPropertyManager::valueText(const QtProperty *property) const
         return QString();
     const QPointF v = it.value().val;
     const int dec =  it.value().decimals;
-    return tr("(%1, %2)").arg(QString::number(v.x(), 'f', dec))
-                         .arg(QString::number(v.y(), 'f', dec));
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("(%1, %2)"));
+    return text({v.x(), v.y()}, dec);
 }
 
 /*!
@@ -2996,6 +5874,7 @@ QString QtPointFPropertyManager::valueText(const QtProperty *property) const
 */
 void QtPointFPropertyManager::setValue(QtProperty *property, const QPointF &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtPointFPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
@@ -3042,9 +5921,34 @@ void QtPointFPropertyManager::setDecimals(QtProperty *property, int prec)
 
     it.value() = data;
 
+    emit propertyChanged(property);
     emit decimalsChanged(property, data.decimals);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtPointFPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtPointFPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtPointFPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toPointF());
+}
+
 /*!
     \reimp
 */
@@ -3268,8 +6172,8 @@ QString QtSizePropertyManager::valueText(const QtProperty *property) const
     if (it == d_ptr->m_values.constEnd())
         return QString();
     const QSize v = it.value().val;
-    return tr("%1 x %2").arg(QString::number(v.width()))
-                        .arg(QString::number(v.height()));
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("%1 x %2"));
+    return text({v.width(), v.height()});
 }
 
 /*!
@@ -3285,6 +6189,7 @@ QString QtSizePropertyManager::valueText(const QtProperty *property) const
 */
 void QtSizePropertyManager::setValue(QtProperty *property, const QSize &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     setValueInRange<const QSize &, QtSizePropertyManagerPrivate, QtSizePropertyManager, const QSize>(this, d_ptr.data(),
                 &QtSizePropertyManager::propertyChanged,
                 &QtSizePropertyManager::valueChanged,
@@ -3356,6 +6261,30 @@ void QtSizePropertyManager::setRange(QtProperty *property, const QSize &minVal,
                 property, minVal, maxVal, &QtSizePropertyManagerPrivate::setRange);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtSizePropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtSizePropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtSizePropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toSize());
+}
+
 /*!
     \reimp
 */
@@ -3595,8 +6524,8 @@ QString QtSizeFPropertyManager::valueText(const QtProperty *property) const
         return QString();
     const QSizeF v = it.value().val;
     const int dec = it.value().decimals;
-    return tr("%1 x %2").arg(QString::number(v.width(), 'f', dec))
-                        .arg(QString::number(v.height(), 'f', dec));
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("%1 x %2"));
+    return text({v.width(), v.height()}, dec);
 }
 
 /*!
@@ -3612,6 +6541,7 @@ QString QtSizeFPropertyManager::valueText(const QtProperty *property) const
 */
 void QtSizeFPropertyManager::setValue(QtProperty *property, const QSizeF &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     setValueInRange<const QSizeF &, QtSizeFPropertyManagerPrivate, QtSizeFPropertyManager, QSizeF>(this, d_ptr.data(),
                 &QtSizeFPropertyManager::propertyChanged,
                 &QtSizeFPropertyManager::valueChanged,
@@ -3649,6 +6579,7 @@ void QtSizeFPropertyManager::setDecimals(QtProperty *property, int prec)
 
     it.value() = data;
 
+    emit propertyChanged(property);
     emit decimalsChanged(property, data.decimals);
 }
 
@@ -3717,6 +6648,30 @@ void QtSizeFPropertyManager::setRange(QtProperty *property, const QSizeF &minVal
                 property, minVal, maxVal, &QtSizeFPropertyManagerPrivate::setRange);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtSizeFPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtSizeFPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtSizeFPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toSizeF());
+}
+
 /*!
     \reimp
 */
@@ -3954,10 +6909,8 @@ QString QtRectPropertyManager::valueText(const QtProperty *property) const
     if (it == d_ptr->m_values.constEnd())
         return QString();
     const QRect v = it.value().val;
-    return tr("[(%1, %2), %3 x %4]").arg(QString::number(v.x()))
-                                    .arg(QString::number(v.y()))
-                                    .arg(QString::number(v.width()))
-                                    .arg(QString::number(v.height()));
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("[(%1, %2), %3 x %4]"));
+    return text({v.x(), v.y(), v.width(), v.height()});
 }
 
 /*!
@@ -3974,6 +6927,7 @@ QString QtRectPropertyManager::valueText(const QtProperty *property) const
 */
 void QtRectPropertyManager::setValue(QtProperty *property, const QRect &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtRectPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
@@ -4066,6 +7020,30 @@ void QtRectPropertyManager::setConstraint(QtProperty *property, const QRect &con
     emit valueChanged(property, data.val);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtRectPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtRectPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtRectPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toRect());
+}
+
 /*!
     \reimp
 */
@@ -4350,10 +7328,8 @@ QString QtRectFPropertyManager::valueText(const QtProperty *property) const
         return QString();
     const QRectF v = it.value().val;
     const int dec = it.value().decimals;
-    return QString(tr("[(%1, %2), %3 x %4]").arg(QString::number(v.x(), 'f', dec))
-                                .arg(QString::number(v.y(), 'f', dec))
-                                .arg(QString::number(v.width(), 'f', dec))
-                                .arg(QString::number(v.height(), 'f', dec)));
+    static const QtNumericValueText text(staticMetaObject.className(), QT_TR_NOOP("[(%1, %2), %3 x %4]"));
+    return text({v.x(), v.y(), v.width(), v.height()}, dec);
 }
 
 /*!
@@ -4370,6 +7346,7 @@ QString QtRectFPropertyManager::valueText(const QtProperty *property) const
 */
 void QtRectFPropertyManager::setValue(QtProperty *property, const QRectF &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtRectFPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
@@ -4495,9 +7472,34 @@ void QtRectFPropertyManager::setDecimals(QtProperty *property, int prec)
 
     it.value() = data;
 
+    emit propertyChanged(property);
     emit decimalsChanged(property, data.decimals);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtRectFPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtRectFPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtRectFPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toRectF());
+}
+
 /*!
     \reimp
 */
@@ -4576,6 +7578,181 @@ void QtRectFPropertyManager::uninitializeProperty(QtProperty *property)
     d_ptr->m_values.remove(property);
 }
 
+// QtEnumDefinition
+class QtEnumDefinitionData : public QSharedData
+{
+public:
+    ~QtEnumDefinitionData();
+
+    int id{ 0 };
+    QStringList names;
+    QMap<int, QIcon> icons;
+};
+
+static bool sameEnumIcons(const QMap<int, QIcon> &icons1, const QMap<int, QIcon> &icons2)
+{
+    if (icons1.count() != icons2.count())
+        return false;
+    for (auto it1 = icons1.cbegin(), it2 = icons2.cbegin(), end = icons1.cend(); it1 != end; ++it1, ++it2) {
+        if (it1.key() != it2.key() || it1.value().cacheKey() != it2.value().cacheKey())
+            return false;
+    }
+    return true;
+}
+
+// Interns the definitions by content. Entries are owned by the
+// QtEnumDefinition handles and unregister themselves when the last one
+// goes away. Like the managers, the registry is meant for the GUI thread.
+class QtEnumDefinitionRegistry
+{
+public:
+    QtEnumDefinitionData *intern(const QStringList &names, const QMap<int, QIcon> &icons);
+    QtEnumDefinitionData *find(int id) const { return m_idToData.value(id, 0); }
+    void remove(QtEnumDefinitionData *data);
+
+private:
+    QHash<QStringList, QList<QtEnumDefinitionData *> > m_namesToData;
+    QHash<int, QtEnumDefinitionData *> m_idToData;
+    int m_nextId{ 1 };
+};
+
+Q_GLOBAL_STATIC(QtEnumDefinitionRegistry, enumDefinitionRegistry)
+
+QtEnumDefinitionData *QtEnumDefinitionRegistry::intern(const QStringList &names, const QMap<int, QIcon> &icons)
+{
+    QList<QtEnumDefinitionData *> &candidates = m_namesToData[names];
+    for (QtEnumDefinitionData *data : qAsConst(candidates)) {
+        if (sameEnumIcons(data->icons, icons))
+            return data;
+    }
+    QtEnumDefinitionData *data = new QtEnumDefinitionData;
+    data->id = m_nextId++;
+    data->names = names;
+    data->icons = icons;
+    candidates.append(data);
+    m_idToData.insert(data->id, data);
+    return data;
+}
+
+void QtEnumDefinitionRegistry::remove(QtEnumDefinitionData *data)
+{
+    m_idToData.remove(data->id);
+    const auto it = m_namesToData.find(data->names);
+    if (it == m_namesToData.end())
+        return;
+    it.value().removeOne(data);
+    if (it.value().isEmpty())
+        m_namesToData.erase(it);
+}
+
+QtEnumDefinitionData::~QtEnumDefinitionData()
+{
+    if (!enumDefinitionRegistry.isDestroyed())
+        enumDefinitionRegistry()->remove(this);
+}
+
+/*!
+    \class QtEnumDefinition
+    \internal
+    \inmodule QtDesigner
+
+    \brief The QtEnumDefinition class is an immutable, shared list of
+    enum or flag names and their icons.
+
+    Definitions with the same names and icons are interned in a
+    process wide registry, so any number of properties describing the
+    same enum type share a single copy. Each definition is identified
+    by an id() which stays valid for as long as a handle to the
+    definition exists, and can be resolved with fromId().
+
+    \sa QtEnumPropertyManager, QtFlagPropertyManager
+*/
+
+/*!
+    Creates a null definition, which has no names.
+*/
+QtEnumDefinition::QtEnumDefinition()
+{
+}
+
+/*!
+    Creates a definition with the given \a names and \a icons, reusing
+    an existing definition with the same content if there is one.
+*/
+QtEnumDefinition::QtEnumDefinition(const QStringList &names, const QMap<int, QIcon> &icons)
+{
+    if (!names.isEmpty() || !icons.isEmpty())
+        d.reset(enumDefinitionRegistry()->intern(names, icons));
+}
+
+QtEnumDefinition::QtEnumDefinition(const QtEnumDefinition &other) = default;
+
+QtEnumDefinition &QtEnumDefinition::operator=(const QtEnumDefinition &other) = default;
+
+QtEnumDefinition::~QtEnumDefinition() = default;
+
+/*!
+    Returns the definition with the given \a id, or a null definition
+    if it no longer exists.
+*/
+QtEnumDefinition QtEnumDefinition::fromId(int id)
+{
+    QtEnumDefinition definition;
+    definition.d.reset(enumDefinitionRegistry()->find(id));
+    return definition;
+}
+
+/*!
+    Returns the id of this definition, or 0 for a null definition.
+*/
+int QtEnumDefinition::id() const
+{
+    return d ? d->id : 0;
+}
+
+/*!
+    Returns the number of names in this definition.
+*/
+int QtEnumDefinition::count() const
+{
+    return d ? d->names.count() : 0;
+}
+
+/*!
+    Returns the names of this definition.
+*/
+QStringList QtEnumDefinition::names() const
+{
+    return d ? d->names : QStringList();
+}
+
+/*!
+    Returns the map of values to icons of this definition.
+*/
+QMap<int, QIcon> QtEnumDefinition::icons() const
+{
+    return d ? d->icons : QMap<int, QIcon>();
+}
+
+/*!
+    Returns the name at position \a index, or an empty string if \a index
+    is out of range.
+*/
+QString QtEnumDefinition::name(int index) const
+{
+    if (!d || index < 0 || index >= d->names.count())
+        return QString();
+    return d->names.at(index);
+}
+
+/*!
+    Returns the icon of the value \a index, or an invalid icon if there is none.
+*/
+QIcon QtEnumDefinition::icon(int index) const
+{
+    return d ? d->icons.value(index) : QIcon();
+}
+
 // QtEnumPropertyManager
 /*!
     \class QtEnumPropertyManager
@@ -4595,6 +7772,11 @@ void QtRectFPropertyManager::uninitializeProperty(QtProperty *property)
     values to icons can be set using the setEnumIcons() function and
     queried with the enumIcons() function.
 
+    The names and icons are stored in an immutable QtEnumDefinition
+    which is shared by all properties with the same content. It can be
+    retrieved with enumDefinition() and assigned directly with
+    setEnumDefinition().
+
     In addition, QtEnumPropertyManager provides the valueChanged() signal
     which is emitted whenever a property created by this manager
     changes. The enumNamesChanged() or enumIconsChanged() signal is emitted
@@ -4671,7 +7853,7 @@ int QtEnumPropertyManager::value(const QtProperty *property) const
 */
 QStringList QtEnumPropertyManager::enumNames(const QtProperty *property) const
 {
-    return getData<QStringList>(d_ptr->m_values, &QtEnumPropertyManagerPrivate::Data::enumNames, property, QStringList());
+    return enumDefinition(property).names();
 }
 
 /*!
@@ -4681,7 +7863,18 @@ QStringList QtEnumPropertyManager::enumNames(const QtProperty *property) const
 */
 QMap<int, QIcon> QtEnumPropertyManager::enumIcons(const QtProperty *property) const
 {
-    return getData<QMap<int, QIcon> >(d_ptr->m_values, &QtEnumPropertyManagerPrivate::Data::enumIcons, property, QMap<int, QIcon>());
+    return enumDefinition(property).icons();
+}
+
+/*!
+    Returns the shared definition holding the given \a property's enum
+    names and icons.
+
+    \sa setEnumDefinition(), enumNames(), enumIcons()
+*/
+QtEnumDefinition QtEnumPropertyManager::enumDefinition(const QtProperty *property) const
+{
+    return getData<QtEnumDefinition>(d_ptr->m_values, &QtEnumPropertyManagerPrivate::Data::definition, property, QtEnumDefinition());
 }
 
 /*!
@@ -4695,10 +7888,7 @@ QString QtEnumPropertyManager::valueText(const QtProperty *property) const
 
     const QtEnumPropertyManagerPrivate::Data &data = it.value();
 
-    const int v = data.val;
-    if (v >= 0 && v < data.enumNames.count())
-        return data.enumNames.at(v);
-    return QString();
+    return data.definition.name(data.val);
 }
 
 /*!
@@ -4712,8 +7902,7 @@ QIcon QtEnumPropertyManager::valueIcon(const QtProperty *property) const
 
     const QtEnumPropertyManagerPrivate::Data &data = it.value();
 
-    const int v = data.val;
-    return data.enumIcons.value(v);
+    return data.definition.icon(data.val);
 }
 
 /*!
@@ -4728,16 +7917,17 @@ QIcon QtEnumPropertyManager::valueIcon(const QtProperty *property) const
 */
 void QtEnumPropertyManager::setValue(QtProperty *property, int val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtEnumPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
 
     QtEnumPropertyManagerPrivate::Data data = it.value();
 
-    if (val >= data.enumNames.count())
+    if (val >= data.definition.count())
         return;
 
-    if (val < 0 && data.enumNames.count() > 0)
+    if (val < 0 && data.definition.count() > 0)
         return;
 
     if (val < 0)
@@ -4772,10 +7962,10 @@ void QtEnumPropertyManager::setEnumNames(QtProperty *property, const QStringList
 
     QtEnumPropertyManagerPrivate::Data data = it.value();
 
-    if (data.enumNames == enumNames)
+    if (data.definition.names() == enumNames)
         return;
 
-    data.enumNames = enumNames;
+    data.definition = QtEnumDefinition(enumNames, data.definition.icons());
 
     data.val = -1;
 
@@ -4784,7 +7974,7 @@ void QtEnumPropertyManager::setEnumNames(QtProperty *property, const QStringList
 
     it.value() = data;
 
-    emit enumNamesChanged(property, data.enumNames);
+    emit enumNamesChanged(property, enumNames);
 
     emit propertyChanged(property);
     emit valueChanged(property, data.val);
@@ -4804,11 +7994,76 @@ void QtEnumPropertyManager::setEnumIcons(QtProperty *property, const QMap<int, Q
     if (it == d_ptr->m_values.end())
         return;
 
-    it.value().enumIcons = enumIcons;
+    it.value().definition = QtEnumDefinition(it.value().definition.names(), enumIcons);
+
+    emit enumIconsChanged(property, enumIcons);
+
+    emit propertyChanged(property);
+}
+
+/*!
+    Makes the given \a property use the enum names and icons of the shared
+    \a definition. Properties describing the same enum type should share
+    one definition instead of each holding a copy of the names.
+
+    If the names change, the \a property's current value is reset as
+    in setEnumNames().
+
+    \sa enumDefinition(), setEnumNames(), setEnumIcons()
+*/
+void QtEnumPropertyManager::setEnumDefinition(QtProperty *property, const QtEnumDefinition &definition)
+{
+    const QtEnumPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
+    if (it == d_ptr->m_values.end())
+        return;
+
+    QtEnumPropertyManagerPrivate::Data data = it.value();
+
+    if (data.definition == definition)
+        return;
+
+    const QStringList enumNames = definition.names();
+    const bool namesChanged = data.definition.names() != enumNames;
+    const bool iconsChanged = !sameEnumIcons(data.definition.icons(), definition.icons());
+
+    data.definition = definition;
+    if (namesChanged)
+        data.val = enumNames.isEmpty() ? -1 : 0;
+
+    it.value() = data;
 
-    emit enumIconsChanged(property, it.value().enumIcons);
+    if (namesChanged)
+        emit enumNamesChanged(property, enumNames);
+    if (iconsChanged)
+        emit enumIconsChanged(property, definition.icons());
 
     emit propertyChanged(property);
+    if (namesChanged)
+        emit valueChanged(property, data.val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtEnumPropertyManager::journalValue(const QtProperty *property) const
+{
+    return value(property);
+}
+
+/*!
+    \reimp
+*/
+void QtEnumPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtEnumPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.toInt());
 }
 
 /*!
@@ -4840,13 +8095,13 @@ void QtFlagPropertyManagerPrivate::slotBoolChanged(QtProperty *property, bool va
     int level = 0;
     for (QtProperty *p : pfit.value()) {
         if (p == property) {
-            int v = m_values[prop].val;
+            quint64 v = m_values[prop].val;
             if (value) {
-                v |= (1 << level);
+                v |= (quint64(1) << level);
             } else {
-                v &= ~(1 << level);
+                v &= ~(quint64(1) << level);
             }
-            q_ptr->setValue(prop, v);
+            q_ptr->setMask(prop, v);
             return;
         }
         level++;
@@ -4863,6 +8118,43 @@ void QtFlagPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
     m_flagToProperty.remove(property);
 }
 
+void QtFlagPropertyManagerPrivate::createFlagProperties(QtProperty *property)
+{
+    const auto it = m_values.constFind(property);
+    if (it == m_values.constEnd() || m_propertyToFlags.contains(property))
+        return;
+
+    const Data data = it.value();
+    QList<QtProperty *> &flags = m_propertyToFlags[property];
+    const QStringList flagNames = data.definition.names();
+    int level = 0;
+    for (const QString &flagName : flagNames) {
+        QtProperty *prop = m_boolPropertyManager->addProperty();
+        prop->setPropertyName(flagName);
+        m_boolPropertyManager->setValue(prop, data.val & (quint64(1) << level));
+        flags.append(prop);
+        m_flagToProperty[prop] = property;
+        property->addSubProperty(prop);
+        level++;
+    }
+}
+
+void QtFlagPropertyManagerPrivate::destroyFlagProperties(QtProperty *property)
+{
+    const auto it = m_propertyToFlags.find(property);
+    if (it == m_propertyToFlags.end())
+        return;
+
+    const QList<QtProperty *> flags = it.value();
+    m_propertyToFlags.erase(it);
+    for (QtProperty *prop : flags) {
+        if (prop) {
+            m_flagToProperty.remove(prop);
+            delete prop;
+        }
+    }
+}
+
 /*!
     \class QtFlagPropertyManager
     \internal
@@ -4873,26 +8165,32 @@ void QtFlagPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
 
     Each flag property has an associated list of flag names which can
     be retrieved using the flagNames() function, and set using the
-    corresponding setFlagNames() function.
+    corresponding setFlagNames() function. The names are stored in an
+    immutable QtEnumDefinition shared by all properties with the same
+    flags, see flagDefinition() and setFlagDefinition().
 
     The flag manager provides properties with nested boolean
     subproperties representing each flag, i.e. a flag property's value
     is the binary combination of the subproperties' values. A
     property's value can be retrieved and set using the value() and
-    setValue() slots respectively. The combination of flags is represented
-    by single int value - that's why it's possible to store up to
-    32 independent flags in one flag property.
+    setValue() slots respectively. The combination of flags is stored
+    as a 64 bit mask - that's why it's possible to store up to 64
+    independent flags in one flag property. Use mask() and setMask()
+    to access flags beyond the 31st; value() and setValue() only cover
+    the bits representable by a non-negative int.
 
     The subproperties are created by a QtBoolPropertyManager object. This
     manager can be retrieved using the subBoolPropertyManager() function. In
     order to provide editing widgets for the subproperties in a
     property browser widget, this manager must be associated with an
-    editor factory.
+    editor factory. The subproperties are created on demand, i.e. only
+    while a property browser shows them (see
+    QtProperty::requestSubProperties()).
 
-    In addition, QtFlagPropertyManager provides the valueChanged() signal
-    which is emitted whenever a property created by this manager
-    changes, and the flagNamesChanged() signal which is emitted
-    whenever the list of flag names is altered.
+    In addition, QtFlagPropertyManager provides the valueChanged() and
+    maskChanged() signals which are emitted whenever a property created
+    by this manager changes, and the flagNamesChanged() signal which is
+    emitted whenever the list of flag names is altered.
 
     \sa QtAbstractPropertyManager, QtBoolPropertyManager
 */
@@ -4907,6 +8205,16 @@ void QtFlagPropertyManagerPrivate::slotPropertyDestroyed(QtProperty *property)
     \sa setValue()
 */
 
+/*!
+    \fn void QtFlagPropertyManager::maskChanged(QtProperty *property, quint64 mask)
+
+    This signal is emitted whenever a property created by this manager
+    changes its value, passing a pointer to the \a property and the new
+    \a mask as parameters.
+
+    \sa setMask()
+*/
+
 /*!
     \fn void QtFlagPropertyManager::flagNamesChanged(QtProperty *property, const QStringList &names)
 
@@ -4961,11 +8269,24 @@ QtBoolPropertyManager *QtFlagPropertyManager::subBoolPropertyManager() const
     If the given property is not managed by this manager, this
     function returns 0.
 
-    \sa flagNames(), setValue()
+    \sa flagNames(), setValue(), mask()
 */
 int QtFlagPropertyManager::value(const QtProperty *property) const
 {
-    return getValue<int>(d_ptr->m_values, property, 0);
+    return int(mask(property));
+}
+
+/*!
+    Returns the given \a property's value as a 64 bit mask.
+
+    If the given property is not managed by this manager, this
+    function returns 0.
+
+    \sa flagNames(), setMask()
+*/
+quint64 QtFlagPropertyManager::mask(const QtProperty *property) const
+{
+    return getValue<quint64>(d_ptr->m_values, property, 0);
 }
 
 /*!
@@ -4975,7 +8296,17 @@ int QtFlagPropertyManager::value(const QtProperty *property) const
 */
 QStringList QtFlagPropertyManager::flagNames(const QtProperty *property) const
 {
-    return getData<QStringList>(d_ptr->m_values, &QtFlagPropertyManagerPrivate::Data::flagNames, property, QStringList());
+    return flagDefinition(property).names();
+}
+
+/*!
+    Returns the shared definition holding the given \a property's flag names.
+
+    \sa setFlagDefinition(), flagNames()
+*/
+QtEnumDefinition QtFlagPropertyManager::flagDefinition(const QtProperty *property) const
+{
+    return getData<QtEnumDefinition>(d_ptr->m_values, &QtFlagPropertyManagerPrivate::Data::definition, property, QtEnumDefinition());
 }
 
 /*!
@@ -4990,17 +8321,14 @@ QString QtFlagPropertyManager::valueText(const QtProperty *property) const
     const QtFlagPropertyManagerPrivate::Data &data = it.value();
 
     QString str;
-    int level = 0;
     const QChar bar = QLatin1Char('|');
-    const QStringList::const_iterator fncend = data.flagNames.constEnd();
-    for (QStringList::const_iterator it =  data.flagNames.constBegin(); it != fncend; ++it) {
-        if (data.val & (1 << level)) {
+    const int count = data.definition.count();
+    for (int level = 0; level < count; ++level) {
+        if (data.val & (quint64(1) << level)) {
             if (!str.isEmpty())
                 str += bar;
-            str += *it;
+            str += data.definition.name(level);
         }
-
-        level++;
     }
     return str;
 }
@@ -5016,26 +8344,40 @@ QString QtFlagPropertyManager::valueText(const QtProperty *property) const
     where \c n is the size of the list) and larger than (or equal to)
     0.
 
-    \sa value(), valueChanged()
+    \sa value(), valueChanged(), setMask()
 */
 void QtFlagPropertyManager::setValue(QtProperty *property, int val)
 {
+    if (val < 0)
+        return;
+
+    setMask(property, quint64(val));
+}
+
+/*!
+    Sets the value of the given \a property to the 64 bit \a mask. Nested
+    properties are updated automatically.
+
+    Bits beyond the size of the property's flagNames() list must not be set.
+
+    \sa mask(), maskChanged(), setValue()
+*/
+void QtFlagPropertyManager::setMask(QtProperty *property, quint64 mask)
+{
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtFlagPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
 
     QtFlagPropertyManagerPrivate::Data data = it.value();
 
-    if (data.val == val)
-        return;
-
-    if (val > (1 << data.flagNames.count()) - 1)
+    if (data.val == mask)
         return;
 
-    if (val < 0)
+    if (mask & ~QtFlagPropertyManagerPrivate::validMask(data.definition.count()))
         return;
 
-    data.val = val;
+    data.val = mask;
 
     it.value() = data;
 
@@ -5044,23 +8386,46 @@ void QtFlagPropertyManager::setValue(QtProperty *property, int val)
     if (pfit != d_ptr->m_propertyToFlags.constEnd()) {
         for (QtProperty *prop : pfit.value()) {
             if (prop)
-                d_ptr->m_boolPropertyManager->setValue(prop, val & (1 << level));
+                d_ptr->m_boolPropertyManager->setValue(prop, mask & (quint64(1) << level));
             level++;
         }
     }
 
     emit propertyChanged(property);
-    emit valueChanged(property, data.val);
+    emit valueChanged(property, int(data.val));
+    emit maskChanged(property, data.val);
 }
 
 /*!
     Sets the given \a property's list of flag names to \a flagNames. The
     property's current value is reset to 0 indicating the first item
-    of the list.
+    of the list. At most 64 flag names are supported.
 
-    \sa flagNames(), flagNamesChanged()
+    \sa flagNames(), flagNamesChanged(), setFlagDefinition()
 */
 void QtFlagPropertyManager::setFlagNames(QtProperty *property, const QStringList &flagNames)
+{
+    const QtFlagPropertyManagerPrivate::PropertyValueMap::const_iterator it = d_ptr->m_values.constFind(property);
+    if (it == d_ptr->m_values.constEnd())
+        return;
+
+    if (it.value().definition.names() == flagNames)
+        return;
+
+    setFlagDefinition(property, QtEnumDefinition(flagNames));
+}
+
+/*!
+    Makes the given \a property use the flag names of the shared \a
+    definition. Properties describing the same flags type should share
+    one definition instead of each holding a copy of the names.
+
+    Definitions with more than 64 names are truncated. The property's
+    current value is reset to 0.
+
+    \sa flagDefinition(), setFlagNames()
+*/
+void QtFlagPropertyManager::setFlagDefinition(QtProperty *property, const QtEnumDefinition &definition)
 {
     const QtFlagPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
@@ -5068,37 +8433,55 @@ void QtFlagPropertyManager::setFlagNames(QtProperty *property, const QStringList
 
     QtFlagPropertyManagerPrivate::Data data = it.value();
 
-    if (data.flagNames == flagNames)
+    QtEnumDefinition def = definition;
+    if (def.count() > 64) {
+        qWarning("QtFlagPropertyManager: only the first 64 of %d flag names are used.", def.count());
+        def = QtEnumDefinition(def.names().mid(0, 64));
+    }
+
+    if (data.definition == def)
         return;
 
-    data.flagNames = flagNames;
+    data.definition = def;
     data.val = 0;
 
     it.value() = data;
 
-    const auto pfit = d_ptr->m_propertyToFlags.find(property);
-    if (pfit != d_ptr->m_propertyToFlags.end()) {
-        for (QtProperty *prop : qAsConst(pfit.value())) {
-            if (prop) {
-                delete prop;
-                d_ptr->m_flagToProperty.remove(prop);
-            }
-        }
-        pfit.value().clear();
-    }
-
-    for (const QString &flagName : flagNames) {
-        QtProperty *prop = d_ptr->m_boolPropertyManager->addProperty();
-        prop->setPropertyName(flagName);
-        property->addSubProperty(prop);
-        d_ptr->m_propertyToFlags[property].append(prop);
-        d_ptr->m_flagToProperty[prop] = property;
+    // Rebuild the subproperties only if somebody currently shows them.
+    if (d_ptr->m_propertyToFlags.contains(property)) {
+        d_ptr->destroyFlagProperties(property);
+        d_ptr->createFlagProperties(property);
     }
 
-    emit flagNamesChanged(property, data.flagNames);
+    emit flagNamesChanged(property, data.definition.names());
 
     emit propertyChanged(property);
-    emit valueChanged(property, data.val);
+    emit valueChanged(property, int(data.val));
+    emit maskChanged(property, data.val);
+}
+
+/*!
+    \reimp
+*/
+QVariant QtFlagPropertyManager::journalValue(const QtProperty *property) const
+{
+    return QVariant::fromValue(mask(property));
+}
+
+/*!
+    \reimp
+*/
+void QtFlagPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtFlagPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setMask(property, value.value<quint64>());
 }
 
 /*!
@@ -5107,8 +8490,6 @@ void QtFlagPropertyManager::setFlagNames(QtProperty *property, const QStringList
 void QtFlagPropertyManager::initializeProperty(QtProperty *property)
 {
     d_ptr->m_values[property] = QtFlagPropertyManagerPrivate::Data();
-
-    d_ptr->m_propertyToFlags[property] = QList<QtProperty *>();
 }
 
 /*!
@@ -5116,20 +8497,38 @@ void QtFlagPropertyManager::initializeProperty(QtProperty *property)
 */
 void QtFlagPropertyManager::uninitializeProperty(QtProperty *property)
 {
-    const auto it = d_ptr->m_propertyToFlags.find(property);
-    if (it != d_ptr->m_propertyToFlags.end()) {
-        for (QtProperty *prop : qAsConst(it.value()))  {
-            if (prop) {
-                d_ptr->m_flagToProperty.remove(prop);
-                delete prop;
-            }
-        }
-    }
-    d_ptr->m_propertyToFlags.erase(it);
+    d_ptr->destroyFlagProperties(property);
 
     d_ptr->m_values.remove(property);
 }
 
+/*!
+    \reimp
+
+    The bool subproperties of a flag property are only created while
+    they are requested.
+*/
+bool QtFlagPropertyManager::hasDeferredSubProperties(const QtProperty *property) const
+{
+    return d_ptr->m_values.contains(property);
+}
+
+/*!
+    \reimp
+*/
+void QtFlagPropertyManager::createDeferredSubProperties(QtProperty *property)
+{
+    d_ptr->createFlagProperties(property);
+}
+
+/*!
+    \reimp
+*/
+void QtFlagPropertyManager::destroyDeferredSubProperties(QtProperty *property)
+{
+    d_ptr->destroyFlagProperties(property);
+}
+
 // QtSizePolicyPropertyManager
 QtSizePolicyPropertyManagerPrivate::QtSizePolicyPropertyManagerPrivate()
 {
@@ -5316,6 +8715,7 @@ QString QtSizePolicyPropertyManager::valueText(const QtProperty *property) const
 */
 void QtSizePolicyPropertyManager::setValue(QtProperty *property, const QSizePolicy &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtSizePolicyPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
@@ -5338,6 +8738,30 @@ void QtSizePolicyPropertyManager::setValue(QtProperty *property, const QSizePoli
     emit valueChanged(property, val);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtSizePolicyPropertyManager::journalValue(const QtProperty *property) const
+{
+    return QVariant::fromValue(value(property));
+}
+
+/*!
+    \reimp
+*/
+void QtSizePolicyPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtSizePolicyPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QSizePolicy>());
+}
+
 /*!
     \reimp
 */
@@ -5703,6 +9127,7 @@ QIcon QtFontPropertyManager::valueIcon(const QtProperty *property) const
 */
 void QtFontPropertyManager::setValue(QtProperty *property, const QFont &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtFontPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
@@ -5731,6 +9156,30 @@ void QtFontPropertyManager::setValue(QtProperty *property, const QFont &val)
     emit valueChanged(property, val);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtFontPropertyManager::journalValue(const QtProperty *property) const
+{
+    return QVariant::fromValue(value(property));
+}
+
+/*!
+    \reimp
+*/
+void QtFontPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtFontPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QFont>());
+}
+
 /*!
     \reimp
 */
@@ -6014,6 +9463,7 @@ QIcon QtColorPropertyManager::valueIcon(const QtProperty *property) const
 */
 void QtColorPropertyManager::setValue(QtProperty *property, const QColor &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     const QtColorPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
         return;
@@ -6032,6 +9482,30 @@ void QtColorPropertyManager::setValue(QtProperty *property, const QColor &val)
     emit valueChanged(property, val);
 }
 
+/*!
+    \reimp
+*/
+QVariant QtColorPropertyManager::journalValue(const QtProperty *property) const
+{
+    return QVariant::fromValue(value(property));
+}
+
+/*!
+    \reimp
+*/
+void QtColorPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtColorPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QColor>());
+}
+
 /*!
     \reimp
 */
@@ -6111,25 +9585,6 @@ void QtColorPropertyManager::uninitializeProperty(QtProperty *property)
 
 // QtCursorPropertyManager
 
-// Make sure icons are removed as soon as QApplication is destroyed, otherwise,
-// handles are leaked on X11.
-static void clearCursorDatabase();
-namespace {
-struct CursorDatabase : public QtCursorDatabase
-{
-    CursorDatabase()
-    {
-        qAddPostRoutine(clearCursorDatabase);
-    }
-};
-}
-Q_GLOBAL_STATIC(QtCursorDatabase, cursorDatabase)
-
-static void clearCursorDatabase()
-{
-    cursorDatabase()->clear();
-}
-
 /*!
     \class QtCursorPropertyManager
     \internal
@@ -6198,7 +9653,7 @@ QString QtCursorPropertyManager::valueText(const QtProperty *property) const
     if (it == d_ptr->m_values.constEnd())
         return QString();
 
-    return cursorDatabase()->cursorToShapeName(it.value());
+    return QtCursorDatabase::instance()->cursorToShapeName(it.value());
 }
 
 /*!
@@ -6210,7 +9665,7 @@ QIcon QtCursorPropertyManager::valueIcon(const QtProperty *property) const
     if (it == d_ptr->m_values.constEnd())
         return QIcon();
 
-    return cursorDatabase()->cursorToShapeIcon(it.value());
+    return QtCursorDatabase::instance()->cursorToShapeIcon(it.value());
 }
 
 /*!
@@ -6222,6 +9677,7 @@ QIcon QtCursorPropertyManager::valueIcon(const QtProperty *property) const
 */
 void QtCursorPropertyManager::setValue(QtProperty *property, const QCursor &value)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
 #ifndef QT_NO_CURSOR
     const QtCursorPropertyManagerPrivate::PropertyValueMap::iterator it = d_ptr->m_values.find(property);
     if (it == d_ptr->m_values.end())
@@ -6237,6 +9693,30 @@ void QtCursorPropertyManager::setValue(QtProperty *property, const QCursor &valu
 #endif
 }
 
+/*!
+    \reimp
+*/
+QVariant QtCursorPropertyManager::journalValue(const QtProperty *property) const
+{
+    return QVariant::fromValue(value(property));
+}
+
+/*!
+    \reimp
+*/
+void QtCursorPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    reportValueMemory(this, d_ptr->m_values, property, report);
+}
+
+/*!
+    \reimp
+*/
+void QtCursorPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    setValue(property, value.value<QCursor>());
+}
+
 /*!
     \reimp
 */
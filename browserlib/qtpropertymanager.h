@@ -48,6 +48,8 @@
 #include <QtCore/QDateTime>
 #include <QtCore/QLocale>
 #include <QtCore/QMap>
+#include <QtCore/QSharedDataPointer>
+#include <QtCore/QSharedPointer>
 #include <QtCore/QTimer>
 #include <QtCore/QRegularExpression>
 #include <QtGui/QIcon>
@@ -57,6 +59,7 @@
 #include <QtWidgets/QStyle>
 #include <QtWidgets/QApplication>
 #include <QtGui/QPainter>
+#include <QtGui/QQuaternion>
 #include <QtWidgets/QLabel>
 
 QT_BEGIN_NAMESPACE
@@ -149,8 +152,8 @@ public:
     QtMetaEnumProvider();
 
     QStringList policyEnumNames() const { return m_policyEnumNames; }
-    QStringList languageEnumNames() const { return m_languageEnumNames; }
-    QStringList countryEnumNames(QLocale::Language language) const { return m_countryEnumNames.value(language); }
+    QStringList languageEnumNames() const;
+    QStringList countryEnumNames(QLocale::Language language) const;
 
     QSizePolicy::Policy indexToSizePolicy(int index) const;
     int sizePolicyToIndex(QSizePolicy::Policy policy) const;
@@ -159,16 +162,26 @@ public:
     void localeToIndex(QLocale::Language language, QLocale::Country country, int* languageIndex, int* countryIndex) const;
 
 private:
-    void initLocale();
+    struct CountryTable
+    {
+        bool sorted{ false };
+        QList<QLocale::Country> countries;
+        QStringList countryNames;
+    };
+
+    void initLocale() const;
+    const CountryTable &countryTable(int languageIndex) const;
 
     QStringList m_policyEnumNames;
-    QStringList m_languageEnumNames;
-    QMap<QLocale::Language, QStringList> m_countryEnumNames;
-    QMap<int, QLocale::Language> m_indexToLanguage;
-    QMap<QLocale::Language, int> m_languageToIndex;
-    QMap<int, QMap<int, QLocale::Country> > m_indexToCountry;
-    QMap<QLocale::Language, QMap<QLocale::Country, int> > m_countryToIndex;
     QMetaEnum m_policyEnum;
+
+    // Locale tables are built on first use; the country table of a
+    // language is sorted only when that language is first asked for.
+    mutable bool m_localeInitialized{ false };
+    mutable QStringList m_languageEnumNames;
+    mutable QList<QLocale::Language> m_indexToLanguage;
+    mutable QList<int> m_languageToIndex;
+    mutable QList<CountryTable> m_countryTables;
 };
 
 class QtGroupPropertyManager : public QtAbstractPropertyManager
@@ -231,6 +244,9 @@ Q_SIGNALS:
     void singleStepChanged(QtProperty *property, int step);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -267,6 +283,9 @@ Q_SIGNALS:
 protected:
     QString valueText(const QtProperty *property) const override;
     QIcon valueIcon(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -325,6 +344,9 @@ Q_SIGNALS:
     void decimalsChanged(QtProperty *property, int prec);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -333,7 +355,236 @@ private:
     Q_DISABLE_COPY_MOVE(QtDoublePropertyManager)
 };
 
+class QtIntArrayPropertyManager;
+class QtIntArrayPropertyManagerPrivate
+{
+    QtIntArrayPropertyManager* q_ptr;
+    Q_DECLARE_PUBLIC(QtIntArrayPropertyManager)
+public:
+
+    struct Data
+    {
+        QList<int> val;
+        int minVal{ -INT_MAX };
+        int maxVal{ INT_MAX };
+    };
+
+    typedef QMap<const QtProperty*, Data> PropertyValueMap;
+    PropertyValueMap m_values;
+};
+class QtIntArrayPropertyManager : public QtAbstractPropertyManager
+{
+    Q_OBJECT
+public:
+    QtIntArrayPropertyManager(QObject *parent = 0);
+    ~QtIntArrayPropertyManager();
+
+    QList<int> values(const QtProperty *property) const;
+    int count(const QtProperty *property) const;
+    int value(const QtProperty *property, int index) const;
+    int minimum(const QtProperty *property) const;
+    int maximum(const QtProperty *property) const;
+
+public Q_SLOTS:
+    void setValues(QtProperty *property, const QList<int> &vals);
+    void setValue(QtProperty *property, int index, int val);
+    void setMinimum(QtProperty *property, int minVal);
+    void setMaximum(QtProperty *property, int maxVal);
+    void setRange(QtProperty *property, int minVal, int maxVal);
+Q_SIGNALS:
+    void valuesChanged(QtProperty *property, const QList<int> &vals);
+    void valueChanged(QtProperty *property, int index, int val);
+    void rangeChanged(QtProperty *property, int minVal, int maxVal);
+protected:
+    QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void initializeProperty(QtProperty *property) override;
+    void uninitializeProperty(QtProperty *property) override;
+private:
+    QScopedPointer<QtIntArrayPropertyManagerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtIntArrayPropertyManager)
+    Q_DISABLE_COPY_MOVE(QtIntArrayPropertyManager)
+};
+
+class QtDoubleArrayPropertyManager;
+class QtDoubleArrayPropertyManagerPrivate
+{
+    QtDoubleArrayPropertyManager* q_ptr;
+    Q_DECLARE_PUBLIC(QtDoubleArrayPropertyManager)
+public:
+
+    struct Data
+    {
+        QList<double> val;
+        double minVal{ -DBL_MAX };
+        double maxVal{ DBL_MAX };
+        int decimals{ 2 };
+    };
+
+    typedef QMap<const QtProperty*, Data> PropertyValueMap;
+    PropertyValueMap m_values;
+};
+class QtDoubleArrayPropertyManager : public QtAbstractPropertyManager
+{
+    Q_OBJECT
+public:
+    QtDoubleArrayPropertyManager(QObject *parent = 0);
+    ~QtDoubleArrayPropertyManager();
+
+    QList<double> values(const QtProperty *property) const;
+    int count(const QtProperty *property) const;
+    double value(const QtProperty *property, int index) const;
+    double minimum(const QtProperty *property) const;
+    double maximum(const QtProperty *property) const;
+    int decimals(const QtProperty *property) const;
+
+public Q_SLOTS:
+    void setValues(QtProperty *property, const QList<double> &vals);
+    void setValue(QtProperty *property, int index, double val);
+    void setMinimum(QtProperty *property, double minVal);
+    void setMaximum(QtProperty *property, double maxVal);
+    void setRange(QtProperty *property, double minVal, double maxVal);
+    void setDecimals(QtProperty *property, int prec);
+Q_SIGNALS:
+    void valuesChanged(QtProperty *property, const QList<double> &vals);
+    void valueChanged(QtProperty *property, int index, double val);
+    void rangeChanged(QtProperty *property, double minVal, double maxVal);
+    void decimalsChanged(QtProperty *property, int prec);
+protected:
+    QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void initializeProperty(QtProperty *property) override;
+    void uninitializeProperty(QtProperty *property) override;
+private:
+    QScopedPointer<QtDoubleArrayPropertyManagerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtDoubleArrayPropertyManager)
+    Q_DISABLE_COPY_MOVE(QtDoubleArrayPropertyManager)
+};
+
+class QtIntRangePropertyManager;
+class QtIntRangePropertyManagerPrivate
+{
+    QtIntRangePropertyManager* q_ptr;
+    Q_DECLARE_PUBLIC(QtIntRangePropertyManager)
+public:
+
+    struct Data
+    {
+        int lowerVal{ 0 };
+        int upperVal{ 0 };
+        int minVal{ -INT_MAX };
+        int maxVal{ INT_MAX };
+        int singleStep{ 1 };
+    };
+
+    typedef QMap<const QtProperty*, Data> PropertyValueMap;
+    PropertyValueMap m_values;
+};
+class QtIntRangePropertyManager : public QtAbstractPropertyManager
+{
+    Q_OBJECT
+public:
+    QtIntRangePropertyManager(QObject *parent = 0);
+    ~QtIntRangePropertyManager();
+
+    int minimumValue(const QtProperty *property) const;
+    int maximumValue(const QtProperty *property) const;
+    int minimum(const QtProperty *property) const;
+    int maximum(const QtProperty *property) const;
+    int singleStep(const QtProperty *property) const;
+
+public Q_SLOTS:
+    void setValues(QtProperty *property, int minVal, int maxVal);
+    void setMinimumValue(QtProperty *property, int minVal);
+    void setMaximumValue(QtProperty *property, int maxVal);
+    void setMinimum(QtProperty *property, int minVal);
+    void setMaximum(QtProperty *property, int maxVal);
+    void setRange(QtProperty *property, int minVal, int maxVal);
+    void setSingleStep(QtProperty *property, int step);
+Q_SIGNALS:
+    void valueChanged(QtProperty *property, int minVal, int maxVal);
+    void rangeChanged(QtProperty *property, int minVal, int maxVal);
+    void singleStepChanged(QtProperty *property, int step);
+protected:
+    QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void initializeProperty(QtProperty *property) override;
+    void uninitializeProperty(QtProperty *property) override;
+private:
+    QScopedPointer<QtIntRangePropertyManagerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtIntRangePropertyManager)
+    Q_DISABLE_COPY_MOVE(QtIntRangePropertyManager)
+};
+
+class QtDoubleRangePropertyManager;
+class QtDoubleRangePropertyManagerPrivate
+{
+    QtDoubleRangePropertyManager* q_ptr;
+    Q_DECLARE_PUBLIC(QtDoubleRangePropertyManager)
+public:
+
+    struct Data
+    {
+        double lowerVal{ 0 };
+        double upperVal{ 0 };
+        double minVal{ -DBL_MAX };
+        double maxVal{ DBL_MAX };
+        double singleStep{ 1 };
+        int decimals{ 2 };
+    };
+
+    typedef QMap<const QtProperty*, Data> PropertyValueMap;
+    PropertyValueMap m_values;
+};
+class QtDoubleRangePropertyManager : public QtAbstractPropertyManager
+{
+    Q_OBJECT
+public:
+    QtDoubleRangePropertyManager(QObject *parent = 0);
+    ~QtDoubleRangePropertyManager();
+
+    double minimumValue(const QtProperty *property) const;
+    double maximumValue(const QtProperty *property) const;
+    double minimum(const QtProperty *property) const;
+    double maximum(const QtProperty *property) const;
+    double singleStep(const QtProperty *property) const;
+    int decimals(const QtProperty *property) const;
+
+public Q_SLOTS:
+    void setValues(QtProperty *property, double minVal, double maxVal);
+    void setMinimumValue(QtProperty *property, double minVal);
+    void setMaximumValue(QtProperty *property, double maxVal);
+    void setMinimum(QtProperty *property, double minVal);
+    void setMaximum(QtProperty *property, double maxVal);
+    void setRange(QtProperty *property, double minVal, double maxVal);
+    void setSingleStep(QtProperty *property, double step);
+    void setDecimals(QtProperty *property, int prec);
+Q_SIGNALS:
+    void valueChanged(QtProperty *property, double minVal, double maxVal);
+    void rangeChanged(QtProperty *property, double minVal, double maxVal);
+    void singleStepChanged(QtProperty *property, double step);
+    void decimalsChanged(QtProperty *property, int prec);
+protected:
+    QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void initializeProperty(QtProperty *property) override;
+    void uninitializeProperty(QtProperty *property) override;
+private:
+    QScopedPointer<QtDoubleRangePropertyManagerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtDoubleRangePropertyManager)
+    Q_DISABLE_COPY_MOVE(QtDoubleRangePropertyManager)
+};
+
 class QtStringPropertyManager;
+struct QtStringValidationJob;
 class QtStringPropertyManagerPrivate
 {
     QtStringPropertyManager* q_ptr;
@@ -344,10 +595,17 @@ public:
     {
         QString val;
         QRegularExpression regExp;
+        QSharedPointer<QtStringValidationJob> validationJob;
     };
 
+    void startValidation(QtProperty* property, Data& data, const QString& val);
+    bool cancelValidation(Data& data);
+    void validationFinished(QtProperty* property,
+        const QSharedPointer<QtStringValidationJob>& job, bool matched);
+
     typedef QMap<const QtProperty*, Data> PropertyValueMap;
     QMap<const QtProperty*, Data> m_values;
+    int m_asyncValidationThreshold{4096};
 };
 class QtStringPropertyManager : public QtAbstractPropertyManager
 {
@@ -358,6 +616,10 @@ public:
 
     QString value(const QtProperty *property) const;
     QRegularExpression regExp(const QtProperty *property) const;
+    bool isValidationPending(const QtProperty *property) const;
+
+    int asyncValidationThreshold() const;
+    void setAsyncValidationThreshold(int length);
 
 public Q_SLOTS:
     void setValue(QtProperty *property, const QString &val);
@@ -365,8 +627,12 @@ public Q_SLOTS:
 Q_SIGNALS:
     void valueChanged(QtProperty *property, const QString &val);
     void regExpChanged(QtProperty *property, const QRegularExpression &regExp);
+    void validationPendingChanged(QtProperty *property, bool pending);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -420,6 +686,9 @@ Q_SIGNALS:
     void rangeChanged(QtProperty *property, QDate minVal, QDate maxVal);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -456,6 +725,9 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, QTime val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -492,6 +764,9 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, const QDateTime &val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -527,6 +802,9 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, const QKeySequence &val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -560,6 +838,9 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, const QChar &val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -610,6 +891,9 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, const QLocale &val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -658,6 +942,9 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, const QPoint &val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -679,6 +966,11 @@ public:
     void slotIntChanged(QtProperty* property, int value);
     void slotPropertyDestroyed(QtProperty* property);
 
+    void createSubProperties(QtProperty* property);
+    void destroySubProperties(QtProperty* property);
+
+    QList<QPoint3D> values(const QList<QtProperty*>& properties) const;
+
     typedef QMap<const QtProperty*, QPoint3D> PropertyValueMap;
     PropertyValueMap m_values;
 
@@ -703,14 +995,28 @@ public:
 
     QPoint3D value(const QtProperty *property) const;
 
+    void setValues(const QList<QtProperty *> &properties, const QList<QPoint3D> &values);
+    void translate(const QList<QtProperty *> &properties, const QPoint3D &offset);
+    void scale(const QList<QtProperty *> &properties, double factor, const QPoint3D &origin = QPoint3D());
+    void rotate(const QList<QtProperty *> &properties, const QRotation3D &angles, const QPoint3D &origin = QPoint3D());
+    void rotate(const QList<QtProperty *> &properties, const QQuaternion &rotation, const QPoint3D &origin = QPoint3D());
+
 public Q_SLOTS:
     void setValue(QtProperty *property, const QPoint3D &val);
 Q_SIGNALS:
     void valueChanged(QtProperty *property, const QPoint3D &val);
+    void valuesChanged(const QList<QtProperty *> &properties);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
+    bool hasDeferredSubProperties(const QtProperty *property) const override;
+    void createDeferredSubProperties(QtProperty *property) override;
+    void destroyDeferredSubProperties(QtProperty *property) override;
 private:
     QScopedPointer<QtPoint3DPropertyManagerPrivate> d_ptr;
     Q_DECLARE_PRIVATE(QtPoint3DPropertyManager)
@@ -737,6 +1043,11 @@ public:
     void slotDoubleChanged(QtProperty* property, double value);
     void slotPropertyDestroyed(QtProperty* property);
 
+    void createSubProperties(QtProperty* property);
+    void destroySubProperties(QtProperty* property);
+
+    QList<QPoint3DF> values(const QList<QtProperty*>& properties) const;
+
     typedef QMap<const QtProperty*, Data> PropertyValueMap;
     PropertyValueMap m_values;
 
@@ -762,16 +1073,30 @@ public:
     QPoint3DF value(const QtProperty *property) const;
     int decimals(const QtProperty *property) const;
 
+    void setValues(const QList<QtProperty *> &properties, const QList<QPoint3DF> &values);
+    void translate(const QList<QtProperty *> &properties, const QPoint3DF &offset);
+    void scale(const QList<QtProperty *> &properties, double factor, const QPoint3DF &origin = QPoint3DF());
+    void rotate(const QList<QtProperty *> &properties, const QRotation3D &angles, const QPoint3DF &origin = QPoint3DF());
+    void rotate(const QList<QtProperty *> &properties, const QQuaternion &rotation, const QPoint3DF &origin = QPoint3DF());
+
 public Q_SLOTS:
     void setValue(QtProperty *property, const QPoint3DF &val);
     void setDecimals(QtProperty *property, int prec);
 Q_SIGNALS:
     void valueChanged(QtProperty *property, const QPoint3DF &val);
+    void valuesChanged(const QList<QtProperty *> &properties);
     void decimalsChanged(QtProperty *property, int prec);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
+    bool hasDeferredSubProperties(const QtProperty *property) const override;
+    void createDeferredSubProperties(QtProperty *property) override;
+    void destroyDeferredSubProperties(QtProperty *property) override;
 private:
     QScopedPointer<QtPoint3DFPropertyManagerPrivate> d_ptr;
     Q_DECLARE_PRIVATE(QtPoint3DFPropertyManager)
@@ -792,6 +1117,9 @@ public:
     void slotIntChanged(QtProperty* property, int value);
     void slotPropertyDestroyed(QtProperty* property);
 
+    void createSubProperties(QtProperty* property);
+    void destroySubProperties(QtProperty* property);
+
     typedef QMap<const QtProperty*, QRotation3D> PropertyValueMap;
     PropertyValueMap m_values;
 
@@ -822,8 +1150,14 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, const QRotation3D &val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
+    bool hasDeferredSubProperties(const QtProperty *property) const override;
+    void createDeferredSubProperties(QtProperty *property) override;
+    void destroyDeferredSubProperties(QtProperty *property) override;
 private:
     QScopedPointer<QtRotation3DPropertyManagerPrivate> d_ptr;
     Q_DECLARE_PRIVATE(QtRotation3DPropertyManager)
@@ -833,6 +1167,78 @@ private:
 };
 //########## end of QtRotation3DPropertyManager declaration
 
+//########### start of QtQuaternionPropertyManager declaration
+class QtQuaternionPropertyManager;
+class QtQuaternionPropertyManagerPrivate
+{
+    QtQuaternionPropertyManager* q_ptr;
+    Q_DECLARE_PUBLIC(QtQuaternionPropertyManager)
+public:
+
+    enum Component { Pitch, Yaw, Roll, AxisX, AxisY, AxisZ, Angle, ComponentCount };
+
+    struct Data
+    {
+        QQuaternion val;
+        int decimals{ 2 };
+    };
+
+    void slotDoubleChanged(QtProperty* property, double value);
+    void slotPropertyDestroyed(QtProperty* property);
+
+    void createComponentProperties(QtProperty* property);
+    void destroyComponentProperties(QtProperty* property);
+    void updateComponentProperties(const QtProperty* property);
+
+    typedef QMap<const QtProperty*, Data> PropertyValueMap;
+    PropertyValueMap m_values;
+
+    QtDoublePropertyManager* m_doublePropertyManager;
+
+    // Only holds properties whose derived subproperties are currently requested,
+    // indexed by Component.
+    QMap<const QtProperty*, QList<QtProperty*> > m_propertyToComponents;
+    QMap<const QtProperty*, QtProperty*> m_componentToProperty;
+
+    bool m_updatingComponents{ false };
+};
+class QtQuaternionPropertyManager : public QtAbstractPropertyManager
+{
+    Q_OBJECT
+public:
+    QtQuaternionPropertyManager(QObject *parent = 0);
+    ~QtQuaternionPropertyManager();
+
+    QtDoublePropertyManager *subDoublePropertyManager() const;
+
+    QQuaternion value(const QtProperty *property) const;
+    int decimals(const QtProperty *property) const;
+
+public Q_SLOTS:
+    void setValue(QtProperty *property, const QQuaternion &val);
+    void setDecimals(QtProperty *property, int prec);
+Q_SIGNALS:
+    void valueChanged(QtProperty *property, const QQuaternion &val);
+    void decimalsChanged(QtProperty *property, int prec);
+protected:
+    QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void initializeProperty(QtProperty *property) override;
+    void uninitializeProperty(QtProperty *property) override;
+    bool hasDeferredSubProperties(const QtProperty *property) const override;
+    void createDeferredSubProperties(QtProperty *property) override;
+    void destroyDeferredSubProperties(QtProperty *property) override;
+private:
+    QScopedPointer<QtQuaternionPropertyManagerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QtQuaternionPropertyManager)
+    Q_DISABLE_COPY_MOVE(QtQuaternionPropertyManager)
+    Q_PRIVATE_SLOT(d_func(), void slotDoubleChanged(QtProperty *, double))
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyDestroyed(QtProperty *))
+};
+//########## end of QtQuaternionPropertyManager declaration
+
 class QtPointFPropertyManager;
 class QtPointFPropertyManagerPrivate
 {
@@ -880,6 +1286,9 @@ Q_SIGNALS:
     void decimalsChanged(QtProperty *property, int prec);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -950,6 +1359,9 @@ Q_SIGNALS:
     void rangeChanged(QtProperty *property, const QSize &minVal, const QSize &maxVal);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1021,6 +1433,9 @@ Q_SIGNALS:
     void decimalsChanged(QtProperty *property, int prec);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1083,6 +1498,9 @@ Q_SIGNALS:
     void constraintChanged(QtProperty *property, const QRect &constraint);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1149,6 +1567,9 @@ Q_SIGNALS:
     void decimalsChanged(QtProperty *property, int prec);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1159,6 +1580,32 @@ private:
     Q_PRIVATE_SLOT(d_func(), void slotPropertyDestroyed(QtProperty *))
 };
 
+class QtEnumDefinitionData;
+class QtEnumDefinition
+{
+public:
+    QtEnumDefinition();
+    explicit QtEnumDefinition(const QStringList &names, const QMap<int, QIcon> &icons = QMap<int, QIcon>());
+    QtEnumDefinition(const QtEnumDefinition &other);
+    QtEnumDefinition &operator=(const QtEnumDefinition &other);
+    ~QtEnumDefinition();
+
+    static QtEnumDefinition fromId(int id);
+
+    bool isNull() const { return !d; }
+    int id() const;
+    int count() const;
+    QStringList names() const;
+    QMap<int, QIcon> icons() const;
+    QString name(int index) const;
+    QIcon icon(int index) const;
+
+    bool operator==(const QtEnumDefinition &other) const { return d == other.d; }
+    bool operator!=(const QtEnumDefinition &other) const { return d != other.d; }
+private:
+    QExplicitlySharedDataPointer<QtEnumDefinitionData> d;
+};
+
 class QtEnumPropertyManager;
 class QtEnumPropertyManagerPrivate
 {
@@ -1169,8 +1616,7 @@ public:
     struct Data
     {
         int val{ -1 };
-        QStringList enumNames;
-        QMap<int, QIcon> enumIcons;
+        QtEnumDefinition definition;
     };
 
     typedef QMap<const QtProperty*, Data> PropertyValueMap;
@@ -1186,11 +1632,13 @@ public:
     int value(const QtProperty *property) const;
     QStringList enumNames(const QtProperty *property) const;
     QMap<int, QIcon> enumIcons(const QtProperty *property) const;
+    QtEnumDefinition enumDefinition(const QtProperty *property) const;
 
 public Q_SLOTS:
     void setValue(QtProperty *property, int val);
     void setEnumNames(QtProperty *property, const QStringList &names);
     void setEnumIcons(QtProperty *property, const QMap<int, QIcon> &icons);
+    void setEnumDefinition(QtProperty *property, const QtEnumDefinition &definition);
 Q_SIGNALS:
     void valueChanged(QtProperty *property, int val);
     void enumNamesChanged(QtProperty *property, const QStringList &names);
@@ -1198,6 +1646,9 @@ Q_SIGNALS:
 protected:
     QString valueText(const QtProperty *property) const override;
     QIcon valueIcon(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1216,10 +1667,18 @@ public:
     void slotBoolChanged(QtProperty* property, bool value);
     void slotPropertyDestroyed(QtProperty* property);
 
+    void createFlagProperties(QtProperty* property);
+    void destroyFlagProperties(QtProperty* property);
+
+    static quint64 validMask(int flagCount)
+    {
+        return flagCount >= 64 ? ~quint64(0) : (quint64(1) << flagCount) - 1;
+    }
+
     struct Data
     {
-        int val{ -1 };
-        QStringList flagNames;
+        quint64 val{ 0 };
+        QtEnumDefinition definition;
     };
 
     typedef QMap<const QtProperty*, Data> PropertyValueMap;
@@ -1227,6 +1686,7 @@ public:
 
     QtBoolPropertyManager* m_boolPropertyManager;
 
+    // Only holds properties whose bool subproperties are currently requested.
     QMap<const QtProperty*, QList<QtProperty*> > m_propertyToFlags;
 
     QMap<const QtProperty*, QtProperty*> m_flagToProperty;
@@ -1241,18 +1701,29 @@ public:
     QtBoolPropertyManager *subBoolPropertyManager() const;
 
     int value(const QtProperty *property) const;
+    quint64 mask(const QtProperty *property) const;
     QStringList flagNames(const QtProperty *property) const;
+    QtEnumDefinition flagDefinition(const QtProperty *property) const;
 
 public Q_SLOTS:
     void setValue(QtProperty *property, int val);
+    void setMask(QtProperty *property, quint64 mask);
     void setFlagNames(QtProperty *property, const QStringList &names);
+    void setFlagDefinition(QtProperty *property, const QtEnumDefinition &definition);
 Q_SIGNALS:
     void valueChanged(QtProperty *property, int val);
+    void maskChanged(QtProperty *property, quint64 mask);
     void flagNamesChanged(QtProperty *property, const QStringList &names);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
+    bool hasDeferredSubProperties(const QtProperty *property) const override;
+    void createDeferredSubProperties(QtProperty *property) override;
+    void destroyDeferredSubProperties(QtProperty *property) override;
 private:
     QScopedPointer<QtFlagPropertyManagerPrivate> d_ptr;
     Q_DECLARE_PRIVATE(QtFlagPropertyManager)
@@ -1308,6 +1779,9 @@ Q_SIGNALS:
     void valueChanged(QtProperty *property, const QSizePolicy &val);
 protected:
     QString valueText(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1383,6 +1857,9 @@ Q_SIGNALS:
 protected:
     QString valueText(const QtProperty *property) const override;
     QIcon valueIcon(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1440,6 +1917,9 @@ Q_SIGNALS:
 protected:
     QString valueText(const QtProperty *property) const override;
     QIcon valueIcon(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1477,6 +1957,9 @@ Q_SIGNALS:
 protected:
     QString valueText(const QtProperty *property) const override;
     QIcon valueIcon(const QtProperty *property) const override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
 private:
@@ -1487,4 +1970,7 @@ private:
 
 QT_END_NAMESPACE
 
+Q_DECLARE_METATYPE(QPoint3D)
+Q_DECLARE_METATYPE(QPoint3DF)
+Q_DECLARE_METATYPE(QRotation3D)
 #endif
@@ -70,13 +70,42 @@ void QtPropertyEditorView::drawRow(QPainter *painter, const QStyleOptionViewItem
         }
     }
     QTreeWidget::drawRow(painter, opt, index);
-    QColor color = static_cast<QRgb>(QApplication::style()->styleHint(QStyle::SH_Table_GridLineColor, &opt));
+    const QColor color = gridLineColor(opt.palette.currentColorGroup());
     painter->save();
     painter->setPen(QPen(color));
     painter->drawLine(opt.rect.x(), opt.rect.bottom(), opt.rect.right(), opt.rect.bottom());
     painter->restore();
 }
 
+QColor QtPropertyEditorView::gridLineColor(QPalette::ColorGroup group) const
+{
+    if (group >= QPalette::NColorGroups)
+        group = palette().currentColorGroup();
+
+    QColor &color = m_gridLineColors[group];
+    if (!color.isValid()) {
+        QStyleOptionViewItem opt;
+        opt.initFrom(this);
+        opt.palette.setCurrentColorGroup(group);
+        color = static_cast<QRgb>(QApplication::style()->styleHint(QStyle::SH_Table_GridLineColor, &opt));
+    }
+    return color;
+}
+
+void QtPropertyEditorView::changeEvent(QEvent *event)
+{
+    const QEvent::Type type = event->type();
+    if (type == QEvent::PaletteChange || type == QEvent::StyleChange) {
+        for (QColor &color : m_gridLineColors)
+            color = QColor();
+    }
+    if (type == QEvent::FontChange || type == QEvent::StyleChange) {
+        if (QtPropertyEditorDelegate *delegate = qobject_cast<QtPropertyEditorDelegate *>(itemDelegate()))
+            delegate->invalidateSizeHintCache();
+    }
+    QTreeWidget::changeEvent(event);
+}
+
 void QtPropertyEditorView::keyPressEvent(QKeyEvent *event)
 {
     switch (event->key()) {
@@ -216,10 +245,23 @@ void QtPropertyEditorDelegate::paint(QPainter *painter, const QStyleOptionViewIt
     if (c.isValid())
         painter->fillRect(option.rect, c);
     opt.state &= ~QStyle::State_HasFocus;
-    QItemDelegate::paint(painter, opt, index);
 
-    opt.palette.setCurrentColorGroup(QPalette::Active);
-    QColor color = static_cast<QRgb>(QApplication::style()->styleHint(QStyle::SH_Table_GridLineColor, &opt));
+    // Draw the resting state of the editor instead of the value text; the
+    // real editor widget is still only created once the cell gets edited.
+    bool painted = false;
+    if (index.column() == 1 && hasValue && m_editorPrivate && m_editorPrivate->paintedEditors()) {
+        QtProperty *property = m_editorPrivate->indexToProperty(index);
+        if (property && m_editorPrivate->indexToItem(index) != m_editedItem) {
+            drawBackground(painter, opt, index);
+            painted = m_editorPrivate->paintEditor(property, painter, opt);
+        }
+    }
+    if (!painted)
+        QItemDelegate::paint(painter, opt, index);
+
+    const QColor color = m_editorPrivate
+            ? m_editorPrivate->treeWidget()->gridLineColor(QPalette::Active)
+            : QColor(static_cast<QRgb>(QApplication::style()->styleHint(QStyle::SH_Table_GridLineColor, &opt)));
     painter->save();
     painter->setPen(QPen(color));
     if (!m_editorPrivate || (!m_editorPrivate->lastColumn(index.column()) && hasValue)) {
@@ -232,7 +274,22 @@ void QtPropertyEditorDelegate::paint(QPainter *painter, const QStyleOptionViewIt
 QSize QtPropertyEditorDelegate::sizeHint(const QStyleOptionViewItem &option,
             const QModelIndex &index) const
 {
-    return QItemDelegate::sizeHint(option, index) + QSize(3, 4);
+    if (!m_editorPrivate || !m_editorPrivate->treeWidget()->uniformRowHeights())
+        return QItemDelegate::sizeHint(option, index) + QSize(3, 4);
+
+    // All rows share one height, so skip the full item layout and only
+    // measure the width of the single line of text.
+    if (m_uniformRowHeight < 0) {
+        const QWidget *widget = option.widget;
+        QStyle *style = widget ? widget->style() : QApplication::style();
+        m_textMargin = style->pixelMetric(QStyle::PM_FocusFrameHMargin, 0, widget) + 1;
+        m_uniformRowHeight = qMax(option.fontMetrics.height(), option.decorationSize.height()) + 4;
+    }
+
+    int width = option.fontMetrics.horizontalAdvance(index.data(Qt::DisplayRole).toString()) + 2 * m_textMargin;
+    if (!index.data(Qt::DecorationRole).isNull())
+        width += option.decorationSize.width() + 2 * m_textMargin;
+    return QSize(width + 3, m_uniformRowHeight);
 }
 
 bool QtPropertyEditorDelegate::eventFilter(QObject *object, QEvent *event)
@@ -252,7 +309,8 @@ QtTreePropertyBrowserPrivate::QtTreePropertyBrowserPrivate() :
     m_resizeMode(ResizeMode::Stretch),
     m_delegate(0),
     m_markPropertiesWithoutValue(false),
-    m_browserChangedBlocked(false)
+    m_browserChangedBlocked(false),
+    m_paintedEditors(false)
 {
 }
 
@@ -410,7 +468,10 @@ void QtTreePropertyBrowserPrivate::propertyInserted(QtBrowserItem *index, QtBrow
     m_indexToItem[index] = newItem;
 
     newItem->setFlags(newItem->flags() | Qt::ItemIsEditable);
-    newItem->setExpanded(true);
+    // Properties with deferred subproperties start collapsed, their children
+    // are created when the item gets expanded.
+    if (!index->property()->hasDeferredSubProperties())
+        newItem->setExpanded(true);
 
     updateItem(newItem);
 }
@@ -428,6 +489,7 @@ void QtTreePropertyBrowserPrivate::propertyRemoved(QtBrowserItem *index)
     m_indexToItem.remove(index);
     m_itemToIndex.remove(item);
     m_indexToBackgroundColor.remove(index);
+    m_resolvedBackgroundColors.remove(index);
 }
 
 void QtTreePropertyBrowserPrivate::propertyChanged(QtBrowserItem *index)
@@ -442,6 +504,12 @@ QWidget* QtTreePropertyBrowserPrivate::createEditor(QtProperty* property, QWidge
     return q_ptr->createEditor(property, parent);
 }
 
+bool QtTreePropertyBrowserPrivate::paintEditor(QtProperty* property, QPainter* painter,
+            const QStyleOptionViewItem& option) const
+{
+    return q_ptr->paintEditor(property, painter, option);
+}
+
 void QtTreePropertyBrowserPrivate::updateItem(QTreeWidgetItem *item)
 {
     QtProperty *property = m_itemToIndex[item]->property();
@@ -457,6 +525,8 @@ void QtTreePropertyBrowserPrivate::updateItem(QTreeWidgetItem *item)
     }
     item->setIcon(0, expandIcon);
     item->setFirstColumnSpanned(!property->hasValue());
+    item->setChildIndicatorPolicy(property->hasDeferredSubProperties()
+                ? QTreeWidgetItem::ShowIndicator : QTreeWidgetItem::DontShowIndicatorWhenChildless);
     const QString descriptionToolTip  = property->descriptionToolTip();
     const QString propertyName = property->propertyName();
     item->setToolTip(0, descriptionToolTip.isEmpty() ? propertyName : descriptionToolTip);
@@ -485,15 +555,29 @@ void QtTreePropertyBrowserPrivate::updateItem(QTreeWidgetItem *item)
 
 QColor QtTreePropertyBrowserPrivate::calculatedBackgroundColor(QtBrowserItem *item) const
 {
-    QtBrowserItem *i = item;
-    const QMap<QtBrowserItem *, QColor>::const_iterator itEnd = m_indexToBackgroundColor.constEnd();
-    while (i) {
-        QMap<QtBrowserItem *, QColor>::const_iterator it = m_indexToBackgroundColor.constFind(i);
-        if (it != itEnd)
-            return it.value();
-        i = i->parent();
-    }
-    return QColor();
+    if (!item)
+        return QColor();
+
+    const auto resolved = m_resolvedBackgroundColors.constFind(item);
+    if (resolved != m_resolvedBackgroundColors.constEnd())
+        return resolved.value();
+
+    const auto it = m_indexToBackgroundColor.constFind(item);
+    const QColor color = it != m_indexToBackgroundColor.constEnd()
+                ? it.value() : calculatedBackgroundColor(item->parent());
+    m_resolvedBackgroundColors.insert(item, color);
+    return color;
+}
+
+void QtTreePropertyBrowserPrivate::invalidateBackgroundColor(QtBrowserItem *item)
+{
+    // Descendants are only resolved through their ancestors, so the walk
+    // can stop at the first item that has nothing cached.
+    if (!m_resolvedBackgroundColors.remove(item))
+        return;
+    const QList<QtBrowserItem *> children = item->children();
+    for (QtBrowserItem *child : children)
+        invalidateBackgroundColor(child);
 }
 
 QtPropertyEditorView* QtTreePropertyBrowserPrivate::treeWidget() const
@@ -510,16 +594,21 @@ void QtTreePropertyBrowserPrivate::slotCollapsed(const QModelIndex &index)
 {
     QTreeWidgetItem *item = indexToItem(index);
     QtBrowserItem *idx = m_itemToIndex.value(item);
-    if (item)
+    if (item) {
+        q_ptr->setSubPropertiesRequested(idx, false);
         emit q_ptr->collapsed(idx);
+    }
 }
 
 void QtTreePropertyBrowserPrivate::slotExpanded(const QModelIndex &index)
 {
     QTreeWidgetItem *item = indexToItem(index);
     QtBrowserItem *idx = m_itemToIndex.value(item);
-    if (item)
+    if (item) {
+        if (idx && idx->property()->hasDeferredSubProperties())
+            q_ptr->setSubPropertiesRequested(idx, true);
         emit q_ptr->expanded(idx);
+    }
 }
 
 void QtTreePropertyBrowserPrivate::slotCurrentBrowserItemChanged(QtBrowserItem *item)
@@ -603,6 +692,7 @@ QtTreePropertyBrowser::QtTreePropertyBrowser(QWidget *parent)
 {
     d_ptr->q_ptr = this;
 
+    setSubPropertiesDeferred(true);
     d_ptr->init(this);
     connect(this, SIGNAL(currentItemChanged(QtBrowserItem*)), this, SLOT(slotCurrentBrowserItemChanged(QtBrowserItem*)));
 }
@@ -819,6 +909,7 @@ void QtTreePropertyBrowser::setBackgroundColor(QtBrowserItem *item, const QColor
         d_ptr->m_indexToBackgroundColor[item] = color;
     else
         d_ptr->m_indexToBackgroundColor.remove(item);
+    d_ptr->invalidateBackgroundColor(item);
     d_ptr->m_treeWidget->viewport()->update();
 }
 
@@ -874,6 +965,62 @@ bool QtTreePropertyBrowser::propertiesWithoutValueMarked() const
     return d_ptr->m_markPropertiesWithoutValue;
 }
 
+/*!
+    \property QtTreePropertyBrowser::uniformRowHeights
+    \brief whether all items have the same height.
+
+    This property should only be set to true if all items are single
+    lines of text with the same font and icon size. The row height is
+    then computed once instead of being measured for every item, and
+    only recomputed when the font or the style changes. This speeds up
+    scrolling through large sets of properties.
+
+    By default this property is set to false.
+*/
+void QtTreePropertyBrowser::setUniformRowHeights(bool uniform)
+{
+    if (d_ptr->m_treeWidget->uniformRowHeights() == uniform)
+        return;
+
+    d_ptr->m_delegate->invalidateSizeHintCache();
+    d_ptr->m_treeWidget->setUniformRowHeights(uniform);
+    d_ptr->m_treeWidget->doItemsLayout();
+}
+
+bool QtTreePropertyBrowser::uniformRowHeights() const
+{
+    return d_ptr->m_treeWidget->uniformRowHeights();
+}
+
+/*!
+    \property QtTreePropertyBrowser::paintedEditors
+    \brief whether value cells show the resting state of their editors.
+
+    When enabled, each value cell asks the editor factory associated with
+    the property's manager to paint what its editor looks like, e.g. a
+    check box, a slider or a combo box, using the current style. No editor
+    widget is created for that; the real editor is still only instantiated
+    when the user starts editing the cell. Properties whose factory cannot
+    paint its editor are shown as text.
+
+    By default this property is set to false.
+
+    \sa QtAbstractEditorFactoryBase::paintEditor()
+*/
+void QtTreePropertyBrowser::setPaintedEditors(bool painted)
+{
+    if (d_ptr->m_paintedEditors == painted)
+        return;
+
+    d_ptr->m_paintedEditors = painted;
+    d_ptr->m_treeWidget->viewport()->update();
+}
+
+bool QtTreePropertyBrowser::paintedEditors() const
+{
+    return d_ptr->m_paintedEditors;
+}
+
 /*!
     \reimp
 */
@@ -906,6 +1053,33 @@ void QtTreePropertyBrowser::editItem(QtBrowserItem *item)
     d_ptr->editItem(item);
 }
 
+/*!
+    \reimp
+
+    Adds the tree widget items showing the browser items, and the maps
+    linking them, to the report.
+*/
+QtMemoryReport QtTreePropertyBrowser::memoryReport() const
+{
+    QtMemoryReport report = QtAbstractPropertyBrowser::memoryReport();
+    // Each column stores its text and a few roles like the tool tip.
+    const qint64 roleBytes = 4 * (sizeof(int) + sizeof(QVariant));
+    for (auto it = d_ptr->m_indexToItem.cbegin(); it != d_ptr->m_indexToItem.cend(); ++it) {
+        const QtProperty *property = it.key()->property();
+        const QTreeWidgetItem *item = it.value();
+        qint64 itemBytes = sizeof(QTreeWidgetItem);
+        for (int column = 0; column < item->columnCount(); ++column) {
+            itemBytes += roleBytes + QtMemoryReport::stringBytes(item->text(column))
+                        + QtMemoryReport::stringBytes(item->toolTip(column));
+        }
+        report.add(QtMemoryReport::TreeWidgetItems, QString(), property, itemBytes);
+        report.add(QtMemoryReport::MapNodes, QString(), property,
+                    QtMemoryReport::mapNodeBytes<QtBrowserItem *, QTreeWidgetItem *>()
+                    + QtMemoryReport::mapNodeBytes<QTreeWidgetItem *, QtBrowserItem *>());
+    }
+    return report;
+}
+
 QT_END_NAMESPACE
 
 //#include "moc_qttreepropertybrowser.cpp"
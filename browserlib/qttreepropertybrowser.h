@@ -42,6 +42,7 @@
 
 #include "qtpropertybrowser.h"
 #include <QtCore/QSet>
+#include <QtCore/QHash>
 #include <QtGui/QIcon>
 #include <QtWidgets/QTreeWidget>
 #include <QtWidgets/QItemDelegate>
@@ -76,13 +77,18 @@ public:
         return itemFromIndex(index);
     }
 
+    QColor gridLineColor(QPalette::ColorGroup group) const;
+
 protected:
     void keyPressEvent(QKeyEvent* event) override;
     void mousePressEvent(QMouseEvent* event) override;
+    void changeEvent(QEvent* event) override;
     void drawRow(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
 
 private:
     QtTreePropertyBrowserPrivate* m_editorPrivate;
+    // Per color group, reset on palette and style changes.
+    mutable QColor m_gridLineColors[QPalette::NColorGroups];
 };
 
 // ------------ QtPropertyEditorDelegate
@@ -120,6 +126,8 @@ public:
 
     QTreeWidgetItem* editedItem() const { return m_editedItem; }
 
+    void invalidateSizeHintCache() { m_uniformRowHeight = -1; }
+
 private slots:
     void slotEditorDestroyed(QObject* object);
 
@@ -134,6 +142,9 @@ private:
     QtTreePropertyBrowserPrivate* m_editorPrivate;
     mutable QTreeWidgetItem* m_editedItem;
     mutable QWidget* m_editedWidget;
+    // Used while the view has uniform row heights; reset on font and style changes.
+    mutable int m_uniformRowHeight{ -1 };
+    mutable int m_textMargin{ 0 };
 };
 
 
@@ -158,6 +169,7 @@ public:
     void propertyRemoved(QtBrowserItem* index);
     void propertyChanged(QtBrowserItem* index);
     QWidget* createEditor(QtProperty* property, QWidget* parent) const;
+    bool paintEditor(QtProperty* property, QPainter* painter, const QStyleOptionViewItem& option) const;
  
     QtProperty* indexToProperty(const QModelIndex& index) const;
     QTreeWidgetItem* indexToItem(const QModelIndex& index) const;
@@ -171,9 +183,11 @@ public:
     void slotExpanded(const QModelIndex& index);
 
     QColor calculatedBackgroundColor(QtBrowserItem* item) const;
+    void invalidateBackgroundColor(QtBrowserItem* item);
 
     QtPropertyEditorView* treeWidget() const;
     bool markPropertiesWithoutValue() const;
+    bool paintedEditors() const { return m_paintedEditors; }
 
     QtBrowserItem* currentItem() const;
     void setCurrentItem(QtBrowserItem* browserItem, bool block);
@@ -191,6 +205,9 @@ private:
     QMap<QTreeWidgetItem*, QtBrowserItem*> m_itemToIndex;
 
     QMap<QtBrowserItem*, QColor> m_indexToBackgroundColor;
+    // Resolved (possibly inherited) colors, filled in lazily from the root
+    // down, so an item without an entry has no descendants with one.
+    mutable QHash<const QtBrowserItem*, QColor> m_resolvedBackgroundColors;
 
     QtPropertyEditorView* m_treeWidget;
 
@@ -199,6 +216,7 @@ private:
     class QtPropertyEditorDelegate* m_delegate;
     bool m_markPropertiesWithoutValue;
     bool m_browserChangedBlocked;
+    bool m_paintedEditors;
     QIcon m_expandIcon;
 };
 class QtTreePropertyBrowser : public QtAbstractPropertyBrowser
@@ -211,6 +229,8 @@ class QtTreePropertyBrowser : public QtAbstractPropertyBrowser
     Q_PROPERTY(ResizeMode resizeMode READ resizeMode WRITE setResizeMode)
     Q_PROPERTY(int splitterPosition READ splitterPosition WRITE setSplitterPosition)
     Q_PROPERTY(bool propertiesWithoutValueMarked READ propertiesWithoutValueMarked WRITE setPropertiesWithoutValueMarked)
+    Q_PROPERTY(bool uniformRowHeights READ uniformRowHeights WRITE setUniformRowHeights)
+    Q_PROPERTY(bool paintedEditors READ paintedEditors WRITE setPaintedEditors)
 
 public:
     Q_ENUM(ResizeMode)
@@ -249,8 +269,16 @@ public:
     void setPropertiesWithoutValueMarked(bool mark);
     bool propertiesWithoutValueMarked() const;
 
+    void setUniformRowHeights(bool uniform);
+    bool uniformRowHeights() const;
+
+    void setPaintedEditors(bool painted);
+    bool paintedEditors() const;
+
     void editItem(QtBrowserItem *item);
 
+    QtMemoryReport memoryReport() const override;
+
 Q_SIGNALS:
 
     void collapsed(QtBrowserItem *item);
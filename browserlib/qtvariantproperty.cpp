@@ -39,10 +39,19 @@
 #include "qtvariantproperty.h"
 
 
+#include <QtCore/QScopedValueRollback>
+#include <QtCore/QVarLengthArray>
+#include <algorithm>
+
 #if defined(Q_CC_MSVC)
 #    pragma warning(disable: 4786) /* MS VS 6: truncating debug info after 255 characters */
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define QT_PROPERTYBROWSER_SSE2
+#endif
+
 QT_BEGIN_NAMESPACE
 
 class QtEnumPropertyType
@@ -59,11 +68,24 @@ class QtGroupPropertyType
 {
 };
 
+
+class QtIntRangePropertyType
+{
+};
+
+
+class QtDoubleRangePropertyType
+{
+};
+
 QT_END_NAMESPACE
 
 Q_DECLARE_METATYPE(QtEnumPropertyType)
 Q_DECLARE_METATYPE(QtFlagPropertyType)
 Q_DECLARE_METATYPE(QtGroupPropertyType)
+Q_DECLARE_METATYPE(QtIntRangePropertyType)
+Q_DECLARE_METATYPE(QtDoubleRangePropertyType)
+Q_DECLARE_METATYPE(QtVariantPropertyManagerPrivate::JournalTargets)
 
 QT_BEGIN_NAMESPACE
 
@@ -122,6 +144,36 @@ int QtVariantPropertyManager::iconMapTypeId()
     return qMetaTypeId<QtIconMap>();
 }
 
+/*!
+    Returns the type id for an int range property.
+
+    Note that the property's value type can be retrieved using the
+    valueType() function (which is the type id of QtIntRange, a pair
+    holding the minimum and the maximum value, for the int range
+    property type).
+
+    \sa propertyType(), valueType(), QtIntRangePropertyManager
+*/
+int QtVariantPropertyManager::intRangeTypeId()
+{
+    return qMetaTypeId<QtIntRangePropertyType>();
+}
+
+/*!
+    Returns the type id for a double range property.
+
+    Note that the property's value type can be retrieved using the
+    valueType() function (which is the type id of QtDoubleRange, a
+    pair holding the minimum and the maximum value, for the double
+    range property type).
+
+    \sa propertyType(), valueType(), QtDoubleRangePropertyManager
+*/
+int QtVariantPropertyManager::doubleRangeTypeId()
+{
+    return qMetaTypeId<QtDoubleRangePropertyType>();
+}
+
 typedef QMap<const QtProperty *, QtProperty *> PropertyMap;
 Q_GLOBAL_STATIC(PropertyMap, propertyToWrappedProperty)
 
@@ -274,10 +326,32 @@ QtVariantPropertyManagerPrivate::QtVariantPropertyManagerPrivate() :
     m_flagNamesAttribute(QLatin1String("flagNames")),
     m_maximumAttribute(QLatin1String("maximum")),
     m_minimumAttribute(QLatin1String("minimum")),
-    m_regExpAttribute(QLatin1String("regExp"))
+    m_regExpAttribute(QLatin1String("regExp")),
+    m_managerRegistryBuilt(false)
 {
 }
 
+/*
+    Collects the internal managers, including the sub-managers of compound
+    managers, with a single walk over the QObject tree. Each manager is
+    indexed under its class and all its base classes up to
+    QtAbstractPropertyManager, so typed lookups match what qobject_cast
+    would accept.
+*/
+void QtVariantPropertyManagerPrivate::buildManagerRegistry() const
+{
+    if (m_managerRegistryBuilt)
+        return;
+    m_managerRegistryBuilt = true;
+    m_internalManagers = q_ptr->findChildren<QtAbstractPropertyManager *>();
+    for (QtAbstractPropertyManager *manager : qAsConst(m_internalManagers)) {
+        for (const QMetaObject *metaObject = manager->metaObject();
+                metaObject && metaObject != &QtAbstractPropertyManager::staticMetaObject;
+                metaObject = metaObject->superClass())
+            m_typeToInternalManagers[metaObject].append(manager);
+    }
+}
+
 int QtVariantPropertyManagerPrivate::internalPropertyToType(QtProperty *property) const
 {
     int type = 0;
@@ -361,13 +435,220 @@ void QtVariantPropertyManagerPrivate::slotPropertyRemoved(QtProperty *property,
     removeSubProperty(varProperty);
 }
 
+template <class Value>
+static Value changedField(const Value &before, const Value &after, const Value &target)
+{
+    return before == after ? target : after;
+}
+
+template <class Value>
+static Value mergeXY(const Value &before, const Value &after, Value target)
+{
+    target.setX(changedField(before.x(), after.x(), target.x()));
+    target.setY(changedField(before.y(), after.y(), target.y()));
+    return target;
+}
+
+template <class Value>
+static Value mergeXYZ(const Value &before, const Value &after, Value target)
+{
+    target = mergeXY(before, after, target);
+    target.setZ(changedField(before.z(), after.z(), target.z()));
+    return target;
+}
+
+template <class Value>
+static Value mergeSize(const Value &before, const Value &after, Value target)
+{
+    target.setWidth(changedField(before.width(), after.width(), target.width()));
+    target.setHeight(changedField(before.height(), after.height(), target.height()));
+    return target;
+}
+
+template <class Value>
+static Value mergeRect(const Value &before, const Value &after, const Value &target)
+{
+    return Value(changedField(before.x(), after.x(), target.x()),
+                changedField(before.y(), after.y(), target.y()),
+                changedField(before.width(), after.width(), target.width()),
+                changedField(before.height(), after.height(), target.height()));
+}
+
+template <class Value>
+static Value mergePair(const Value &before, const Value &after, const Value &target)
+{
+    return Value(changedField(before.first, after.first, target.first),
+                changedField(before.second, after.second, target.second));
+}
+
+// Applies the fields a subproperty edit changed between before and after
+// to target, keeping the fields the edit did not touch. Values of types
+// without subproperties are replaced.
+static QVariant mergeChangedFields(int type, const QVariant &before, const QVariant &after, const QVariant &target)
+{
+    switch (type) {
+    case QMetaType::QPoint:
+        return mergeXY(before.toPoint(), after.toPoint(), target.toPoint());
+    case QMetaType::QPointF:
+        return mergeXY(before.toPointF(), after.toPointF(), target.toPointF());
+    case QMetaType::QSize:
+        return mergeSize(before.toSize(), after.toSize(), target.toSize());
+    case QMetaType::QSizeF:
+        return mergeSize(before.toSizeF(), after.toSizeF(), target.toSizeF());
+    case QMetaType::QRect:
+        return mergeRect(before.toRect(), after.toRect(), target.toRect());
+    case QMetaType::QRectF:
+        return mergeRect(before.toRectF(), after.toRectF(), target.toRectF());
+    case QMetaType::QColor: {
+        const QColor b = qvariant_cast<QColor>(before);
+        const QColor a = qvariant_cast<QColor>(after);
+        const QColor t = qvariant_cast<QColor>(target);
+        return QColor(changedField(b.red(), a.red(), t.red()), changedField(b.green(), a.green(), t.green()),
+                    changedField(b.blue(), a.blue(), t.blue()), changedField(b.alpha(), a.alpha(), t.alpha()));
+    }
+    case QMetaType::QLocale: {
+        const QLocale b = before.toLocale();
+        const QLocale a = after.toLocale();
+        const QLocale t = target.toLocale();
+        return QLocale(changedField(b.language(), a.language(), t.language()),
+                    changedField(b.country(), a.country(), t.country()));
+    }
+    case QMetaType::QSizePolicy: {
+        const QSizePolicy b = qvariant_cast<QSizePolicy>(before);
+        const QSizePolicy a = qvariant_cast<QSizePolicy>(after);
+        QSizePolicy t = qvariant_cast<QSizePolicy>(target);
+        t.setHorizontalPolicy(changedField(b.horizontalPolicy(), a.horizontalPolicy(), t.horizontalPolicy()));
+        t.setVerticalPolicy(changedField(b.verticalPolicy(), a.verticalPolicy(), t.verticalPolicy()));
+        t.setHorizontalStretch(changedField(b.horizontalStretch(), a.horizontalStretch(), t.horizontalStretch()));
+        t.setVerticalStretch(changedField(b.verticalStretch(), a.verticalStretch(), t.verticalStretch()));
+        return QVariant::fromValue(t);
+    }
+    case QMetaType::QFont: {
+        const QFont b = qvariant_cast<QFont>(before);
+        const QFont a = qvariant_cast<QFont>(after);
+        QFont t = qvariant_cast<QFont>(target);
+        t.setFamily(changedField(b.family(), a.family(), t.family()));
+        t.setPointSize(changedField(b.pointSize(), a.pointSize(), t.pointSize()));
+        t.setBold(changedField(b.bold(), a.bold(), t.bold()));
+        t.setItalic(changedField(b.italic(), a.italic(), t.italic()));
+        t.setUnderline(changedField(b.underline(), a.underline(), t.underline()));
+        t.setStrikeOut(changedField(b.strikeOut(), a.strikeOut(), t.strikeOut()));
+        t.setKerning(changedField(b.kerning(), a.kerning(), t.kerning()));
+        return t;
+    }
+    default:
+        break;
+    }
+
+    if (type == qMetaTypeId<QPoint3D>())
+        return QVariant::fromValue(mergeXYZ(before.value<QPoint3D>(), after.value<QPoint3D>(), target.value<QPoint3D>()));
+    if (type == qMetaTypeId<QPoint3DF>())
+        return QVariant::fromValue(mergeXYZ(before.value<QPoint3DF>(), after.value<QPoint3DF>(), target.value<QPoint3DF>()));
+    if (type == qMetaTypeId<QRotation3D>())
+        return QVariant::fromValue(mergeXYZ(before.value<QRotation3D>(), after.value<QRotation3D>(), target.value<QRotation3D>()));
+    if (type == QtVariantPropertyManager::intRangeTypeId())
+        return QVariant::fromValue(mergePair(before.value<QtIntRange>(), after.value<QtIntRange>(), target.value<QtIntRange>()));
+    if (type == QtVariantPropertyManager::doubleRangeTypeId())
+        return QVariant::fromValue(mergePair(before.value<QtDoubleRange>(), after.value<QtDoubleRange>(), target.value<QtDoubleRange>()));
+    if (type == QtVariantPropertyManager::flagTypeId()) {
+        const int changed = before.toInt() ^ after.toInt();
+        return (target.toInt() & ~changed) | (after.toInt() & changed);
+    }
+    return after;
+}
+
 void QtVariantPropertyManagerPrivate::valueChanged(QtProperty *property, const QVariant &val)
 {
     QtVariantProperty *varProp = m_internalToProperty.value(property, 0);
     if (!varProp)
         return;
+
+    // An edit of a property bound to several targets applies to all of them.
+    QVariantList targets;
+    const auto it = m_targets.find(varProp);
+    const bool fanOut = it != m_targets.end() && !m_settingTargetValues;
+    if (fanOut) {
+        TargetData &data = it.value();
+        if (varProp == m_assignedProperty) {
+            data.values.fill(val);
+        } else {
+            // Changed through a subproperty: only the edited fields apply
+            // to the targets. The property shows the first target's value.
+            const int type = q_ptr->propertyType(varProp);
+            const QVariant before = data.values.first();
+            for (QVariant &target : data.values)
+                target = mergeChangedFields(type, before, val, target);
+        }
+        aggregateTargets(varProp, data);
+        targets = it.value().values;
+    }
+
     emit q_ptr->valueChanged(varProp, val);
     emit q_ptr->propertyChanged(varProp);
+    if (fanOut)
+        emit q_ptr->targetValuesChanged(varProp, targets);
+}
+
+static void targetRange(const double *values, qsizetype count, double *minVal, double *maxVal)
+{
+    qsizetype i = 0;
+    double lo = values[0];
+    double hi = values[0];
+#ifdef QT_PROPERTYBROWSER_SSE2
+    if (count >= 2) {
+        __m128d vmin = _mm_loadu_pd(values);
+        __m128d vmax = vmin;
+        for (i = 2; i + 2 <= count; i += 2) {
+            const __m128d v = _mm_loadu_pd(values + i);
+            vmin = _mm_min_pd(vmin, v);
+            vmax = _mm_max_pd(vmax, v);
+        }
+        double lanes[2];
+        _mm_storeu_pd(lanes, vmin);
+        lo = qMin(lanes[0], lanes[1]);
+        _mm_storeu_pd(lanes, vmax);
+        hi = qMax(lanes[0], lanes[1]);
+    }
+#endif
+    for (; i < count; ++i) {
+        lo = qMin(lo, values[i]);
+        hi = qMax(hi, values[i]);
+    }
+    *minVal = lo;
+    *maxVal = hi;
+}
+
+void QtVariantPropertyManagerPrivate::aggregateTargets(const QtProperty *property, TargetData &data) const
+{
+    data.minimum = QVariant();
+    data.maximum = QVariant();
+    if (data.values.isEmpty()) {
+        data.mixed = false;
+        return;
+    }
+
+    const int type = q_ptr->propertyType(property);
+    if (type == QMetaType::Int || type == QMetaType::Double) {
+        QVarLengthArray<double, 256> numbers(data.values.size());
+        for (qsizetype i = 0; i < data.values.size(); ++i)
+            numbers[i] = data.values.at(i).toDouble();
+        double minVal;
+        double maxVal;
+        targetRange(numbers.constData(), numbers.size(), &minVal, &maxVal);
+        data.mixed = minVal != maxVal;
+        if (type == QMetaType::Int) {
+            data.minimum = int(minVal);
+            data.maximum = int(maxVal);
+        } else {
+            data.minimum = minVal;
+            data.maximum = maxVal;
+        }
+        return;
+    }
+
+    const QVariant &first = data.values.first();
+    data.mixed = std::any_of(data.values.cbegin() + 1, data.values.cend(),
+                [&first](const QVariant &value) { return value != first; });
 }
 
 void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, int val)
@@ -375,6 +656,11 @@ void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, int
     valueChanged(property, QVariant(val));
 }
 
+void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, int minVal, int maxVal)
+{
+    valueChanged(property, QVariant::fromValue(QtIntRange(minVal, maxVal)));
+}
+
 void QtVariantPropertyManagerPrivate::slotRangeChanged(QtProperty *property, int min, int max)
 {
     if (QtVariantProperty *varProp = m_internalToProperty.value(property, 0)) {
@@ -394,6 +680,11 @@ void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, dou
     valueChanged(property, QVariant(val));
 }
 
+void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, double minVal, double maxVal)
+{
+    valueChanged(property, QVariant::fromValue(QtDoubleRange(minVal, maxVal)));
+}
+
 void QtVariantPropertyManagerPrivate::slotRangeChanged(QtProperty *property, double min, double max)
 {
     if (QtVariantProperty *varProp = m_internalToProperty.value(property, 0)) {
@@ -475,22 +766,45 @@ void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, con
     valueChanged(property, QVariant(val));
 }
 
-//###########
 void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, const QPoint3D &val)
 {
     valueChanged(property, QVariant::fromValue(val));
 }
-//###########
+
 void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, const QRotation3D &val)
 {
     valueChanged(property, QVariant::fromValue(val));
 }
-//###########
+
 void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, const QPoint3DF &val)
 {
     valueChanged(property, QVariant::fromValue(val));
 }
-//###########
+
+void QtVariantPropertyManagerPrivate::slotPoint3DValuesChanged(const QList<QtProperty *> &properties)
+{
+    // Bulk setters only emit valuesChanged(), so forward each value here.
+    const QtPoint3DPropertyManager *manager =
+            qobject_cast<QtPoint3DPropertyManager *>(m_typeToPropertyManager.value(qMetaTypeId<QPoint3D>(), 0));
+    if (!manager)
+        return;
+    q_ptr->beginJournalGroup();
+    for (QtProperty *property : properties)
+        valueChanged(property, QVariant::fromValue(manager->value(property)));
+    q_ptr->endJournalGroup();
+}
+
+void QtVariantPropertyManagerPrivate::slotPoint3DFValuesChanged(const QList<QtProperty *> &properties)
+{
+    const QtPoint3DFPropertyManager *manager =
+            qobject_cast<QtPoint3DFPropertyManager *>(m_typeToPropertyManager.value(qMetaTypeId<QPoint3DF>(), 0));
+    if (!manager)
+        return;
+    q_ptr->beginJournalGroup();
+    for (QtProperty *property : properties)
+        valueChanged(property, QVariant::fromValue(manager->value(property)));
+    q_ptr->endJournalGroup();
+}
 
 void QtVariantPropertyManagerPrivate::slotValueChanged(QtProperty *property, const QPointF &val)
 {
@@ -661,6 +975,15 @@ void QtVariantPropertyManagerPrivate::slotFlagNamesChanged(QtProperty *property,
     \row
         \li QPointF
         \li QMetaType::QPointF
+    \row
+        \li QPoint3D
+        \li qMetaTypeId<QPoint3D>()
+    \row
+        \li QPoint3DF
+        \li qMetaTypeId<QPoint3DF>()
+    \row
+        \li QRotation3D
+        \li qMetaTypeId<QRotation3D>()
     \row
         \li QSize
         \li QMetaType::QSize
@@ -694,6 +1017,12 @@ void QtVariantPropertyManagerPrivate::slotFlagNamesChanged(QtProperty *property,
     \row
         \li group
         \li groupTypeId()
+    \row
+        \li int range
+        \li intRangeTypeId()
+    \row
+        \li double range
+        \li doubleRangeTypeId()
     \endtable
 
     Each property type can provide additional attributes,
@@ -749,6 +1078,10 @@ void QtVariantPropertyManagerPrivate::slotFlagNamesChanged(QtProperty *property,
         \li QPointF
         \li decimals
         \li QMetaType::Int
+    \row
+        \li QPoint3DF
+        \li decimals
+        \li QMetaType::Int
     \row
         \li QSize
         \li minimum
@@ -793,6 +1126,34 @@ void QtVariantPropertyManagerPrivate::slotFlagNamesChanged(QtProperty *property,
         \li \c flag
         \li flagNames
         \li QMetaType::QStringList
+    \row
+        \li int range
+        \li minimum
+        \li QMetaType::Int
+    \row
+        \li
+        \li maximum
+        \li QMetaType::Int
+    \row
+        \li
+        \li singleStep
+        \li QMetaType::Int
+    \row
+        \li double range
+        \li minimum
+        \li QMetaType::Double
+    \row
+        \li
+        \li maximum
+        \li QMetaType::Double
+    \row
+        \li
+        \li singleStep
+        \li QMetaType::Double
+    \row
+        \li
+        \li decimals
+        \li QMetaType::Int
     \endtable
 
     The attributes for a given property type can be retrieved using
@@ -806,6 +1167,13 @@ void QtVariantPropertyManagerPrivate::slotFlagNamesChanged(QtProperty *property,
     the attributeChanged() signal which is emitted whenever an
     attribute of such a property changes.
 
+    To edit several objects at once, a property can be bound to the
+    values of all of them with setTargetValues(). If the values differ
+    the property is mixed, and its value text says so, giving the
+    smallest and largest value for int and double properties. Editing
+    the property assigns the new value to every target, which is
+    reported by a single targetValuesChanged() signal.
+
     \sa QtVariantProperty, QtVariantEditorFactory
 */
 
@@ -830,6 +1198,17 @@ void QtVariantPropertyManagerPrivate::slotFlagNamesChanged(QtProperty *property,
     \sa setAttribute()
 */
 
+/*!
+    \fn void QtVariantPropertyManager::targetValuesChanged(QtProperty *property,
+                const QVariantList &values)
+
+    This signal is emitted when an edit of a \a property bound to
+    several targets has been applied to all of them, passing the new
+    target \a values as parameter.
+
+    \sa setTargetValues()
+*/
+
 /*!
     Creates a manager with the given \a parent.
 */
@@ -842,6 +1221,10 @@ QtVariantPropertyManager::QtVariantPropertyManager(QObject *parent): QtAbstractP
     d_ptr->m_destroyingSubProperties = false;
     d_ptr->m_propertyType = 0;
 
+    // The text and icon come from the wrapped properties, which are
+    // cached by the internal managers.
+    setValueCacheEnabled(false);
+
     // IntPropertyManager
     QtIntPropertyManager *intPropertyManager = new QtIntPropertyManager(this);
     d_ptr->m_typeToPropertyManager[QMetaType::Int] = intPropertyManager;
@@ -967,6 +1350,53 @@ QtVariantPropertyManager::QtVariantPropertyManager(QObject *parent): QtAbstractP
                 this, SLOT(slotPropertyInserted(QtProperty*,QtProperty*,QtProperty*)));
     connect(pointFPropertyManager, SIGNAL(propertyRemoved(QtProperty*,QtProperty*)),
                 this, SLOT(slotPropertyRemoved(QtProperty*,QtProperty*)));
+    // Point3DPropertyManager
+    const int point3DId = qMetaTypeId<QPoint3D>();
+    QtPoint3DPropertyManager *point3DPropertyManager = new QtPoint3DPropertyManager(this);
+    d_ptr->m_typeToPropertyManager[point3DId] = point3DPropertyManager;
+    d_ptr->m_typeToValueType[point3DId] = point3DId;
+    connect(point3DPropertyManager, SIGNAL(valueChanged(QtProperty*,QPoint3D)),
+                this, SLOT(slotValueChanged(QtProperty*,QPoint3D)));
+    connect(point3DPropertyManager, SIGNAL(valuesChanged(QList<QtProperty*>)),
+                this, SLOT(slotPoint3DValuesChanged(QList<QtProperty*>)));
+    connect(point3DPropertyManager->subIntPropertyManager(), SIGNAL(valueChanged(QtProperty*,int)),
+                this, SLOT(slotValueChanged(QtProperty*,int)));
+    connect(point3DPropertyManager, SIGNAL(propertyInserted(QtProperty*,QtProperty*,QtProperty*)),
+                this, SLOT(slotPropertyInserted(QtProperty*,QtProperty*,QtProperty*)));
+    connect(point3DPropertyManager, SIGNAL(propertyRemoved(QtProperty*,QtProperty*)),
+                this, SLOT(slotPropertyRemoved(QtProperty*,QtProperty*)));
+    // Point3DFPropertyManager
+    const int point3DFId = qMetaTypeId<QPoint3DF>();
+    QtPoint3DFPropertyManager *point3DFPropertyManager = new QtPoint3DFPropertyManager(this);
+    d_ptr->m_typeToPropertyManager[point3DFId] = point3DFPropertyManager;
+    d_ptr->m_typeToValueType[point3DFId] = point3DFId;
+    d_ptr->m_typeToAttributeToAttributeType[point3DFId][d_ptr->m_decimalsAttribute] =
+            QMetaType::Int;
+    connect(point3DFPropertyManager, SIGNAL(valueChanged(QtProperty*,QPoint3DF)),
+                this, SLOT(slotValueChanged(QtProperty*,QPoint3DF)));
+    connect(point3DFPropertyManager, SIGNAL(valuesChanged(QList<QtProperty*>)),
+                this, SLOT(slotPoint3DFValuesChanged(QList<QtProperty*>)));
+    connect(point3DFPropertyManager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
+    connect(point3DFPropertyManager->subDoublePropertyManager(), SIGNAL(valueChanged(QtProperty*,double)),
+                this, SLOT(slotValueChanged(QtProperty*,double)));
+    connect(point3DFPropertyManager, SIGNAL(propertyInserted(QtProperty*,QtProperty*,QtProperty*)),
+                this, SLOT(slotPropertyInserted(QtProperty*,QtProperty*,QtProperty*)));
+    connect(point3DFPropertyManager, SIGNAL(propertyRemoved(QtProperty*,QtProperty*)),
+                this, SLOT(slotPropertyRemoved(QtProperty*,QtProperty*)));
+    // Rotation3DPropertyManager
+    const int rotation3DId = qMetaTypeId<QRotation3D>();
+    QtRotation3DPropertyManager *rotation3DPropertyManager = new QtRotation3DPropertyManager(this);
+    d_ptr->m_typeToPropertyManager[rotation3DId] = rotation3DPropertyManager;
+    d_ptr->m_typeToValueType[rotation3DId] = rotation3DId;
+    connect(rotation3DPropertyManager, SIGNAL(valueChanged(QtProperty*,QRotation3D)),
+                this, SLOT(slotValueChanged(QtProperty*,QRotation3D)));
+    connect(rotation3DPropertyManager->subIntPropertyManager(), SIGNAL(valueChanged(QtProperty*,int)),
+                this, SLOT(slotValueChanged(QtProperty*,int)));
+    connect(rotation3DPropertyManager, SIGNAL(propertyInserted(QtProperty*,QtProperty*,QtProperty*)),
+                this, SLOT(slotPropertyInserted(QtProperty*,QtProperty*,QtProperty*)));
+    connect(rotation3DPropertyManager, SIGNAL(propertyRemoved(QtProperty*,QtProperty*)),
+                this, SLOT(slotPropertyRemoved(QtProperty*,QtProperty*)));
     // SizePropertyManager
     QtSizePropertyManager *sizePropertyManager = new QtSizePropertyManager(this);
     d_ptr->m_typeToPropertyManager[QMetaType::QSize] = sizePropertyManager;
@@ -1141,6 +1571,41 @@ QtVariantPropertyManager::QtVariantPropertyManager(QObject *parent): QtAbstractP
                 this, SLOT(slotPropertyInserted(QtProperty*,QtProperty*,QtProperty*)));
     connect(flagPropertyManager, SIGNAL(propertyRemoved(QtProperty*,QtProperty*)),
                 this, SLOT(slotPropertyRemoved(QtProperty*,QtProperty*)));
+    // IntRangePropertyManager
+    int intRangeId = intRangeTypeId();
+    QtIntRangePropertyManager *intRangePropertyManager = new QtIntRangePropertyManager(this);
+    d_ptr->m_typeToPropertyManager[intRangeId] = intRangePropertyManager;
+    d_ptr->m_typeToValueType[intRangeId] = qMetaTypeId<QtIntRange>();
+    d_ptr->m_typeToAttributeToAttributeType[intRangeId][d_ptr->m_minimumAttribute] = QMetaType::Int;
+    d_ptr->m_typeToAttributeToAttributeType[intRangeId][d_ptr->m_maximumAttribute] = QMetaType::Int;
+    d_ptr->m_typeToAttributeToAttributeType[intRangeId][d_ptr->m_singleStepAttribute] = QMetaType::Int;
+    connect(intRangePropertyManager, SIGNAL(valueChanged(QtProperty*,int,int)),
+                this, SLOT(slotValueChanged(QtProperty*,int,int)));
+    connect(intRangePropertyManager, SIGNAL(rangeChanged(QtProperty*,int,int)),
+                this, SLOT(slotRangeChanged(QtProperty*,int,int)));
+    connect(intRangePropertyManager, SIGNAL(singleStepChanged(QtProperty*,int)),
+                this, SLOT(slotSingleStepChanged(QtProperty*,int)));
+    // DoubleRangePropertyManager
+    int doubleRangeId = doubleRangeTypeId();
+    QtDoubleRangePropertyManager *doubleRangePropertyManager = new QtDoubleRangePropertyManager(this);
+    d_ptr->m_typeToPropertyManager[doubleRangeId] = doubleRangePropertyManager;
+    d_ptr->m_typeToValueType[doubleRangeId] = qMetaTypeId<QtDoubleRange>();
+    d_ptr->m_typeToAttributeToAttributeType[doubleRangeId][d_ptr->m_minimumAttribute] =
+            QMetaType::Double;
+    d_ptr->m_typeToAttributeToAttributeType[doubleRangeId][d_ptr->m_maximumAttribute] =
+            QMetaType::Double;
+    d_ptr->m_typeToAttributeToAttributeType[doubleRangeId][d_ptr->m_singleStepAttribute] =
+            QMetaType::Double;
+    d_ptr->m_typeToAttributeToAttributeType[doubleRangeId][d_ptr->m_decimalsAttribute] =
+            QMetaType::Int;
+    connect(doubleRangePropertyManager, SIGNAL(valueChanged(QtProperty*,double,double)),
+                this, SLOT(slotValueChanged(QtProperty*,double,double)));
+    connect(doubleRangePropertyManager, SIGNAL(rangeChanged(QtProperty*,double,double)),
+                this, SLOT(slotRangeChanged(QtProperty*,double,double)));
+    connect(doubleRangePropertyManager, SIGNAL(singleStepChanged(QtProperty*,double)),
+                this, SLOT(slotSingleStepChanged(QtProperty*,double)));
+    connect(doubleRangePropertyManager, SIGNAL(decimalsChanged(QtProperty*,int)),
+                this, SLOT(slotDecimalsChanged(QtProperty*,int)));
     // FlagPropertyManager
     int groupId = groupTypeId();
     QtGroupPropertyManager *groupPropertyManager = new QtGroupPropertyManager(this);
@@ -1172,6 +1637,44 @@ QtVariantProperty *QtVariantPropertyManager::variantProperty(const QtProperty *p
     return it.value().first;
 }
 
+/*!
+    Returns the property managers this manager uses internally to
+    implement its property types, including the sub-managers of compound
+    types such as QPoint or QFont.
+
+    The list is collected once, the first time it is asked for; managers
+    created later as children of this manager are not included. Editor
+    factories use it to attach to the internal managers without walking
+    the QObject tree.
+
+    \sa propertyType()
+*/
+QList<QtAbstractPropertyManager *> QtVariantPropertyManager::internalPropertyManagers() const
+{
+    d_ptr->buildManagerRegistry();
+    return d_ptr->m_internalManagers;
+}
+
+/*!
+    \overload
+
+    Returns the internal property managers that are instances of
+    \a managerType or of a class derived from it.
+*/
+QList<QtAbstractPropertyManager *> QtVariantPropertyManager::internalPropertyManagers(const QMetaObject *managerType) const
+{
+    d_ptr->buildManagerRegistry();
+    return d_ptr->m_typeToInternalManagers.value(managerType);
+}
+
+/*!
+    \fn template <class PropertyManager> QList<PropertyManager *> QtVariantPropertyManager::internalPropertyManagers() const
+    \overload
+
+    Returns the internal property managers of the given \c PropertyManager
+    type, e.g. \c{manager->internalPropertyManagers<QtIntPropertyManager>()}.
+*/
+
 /*!
     Returns true if the given \a propertyType is supported by this
     variant manager; otherwise false.
@@ -1256,6 +1759,12 @@ QVariant QtVariantPropertyManager::value(const QtProperty *property) const
         return pointManager->value(internProp);
     } else if (QtPointFPropertyManager *pointFManager = qobject_cast<QtPointFPropertyManager *>(manager)) {
         return pointFManager->value(internProp);
+    } else if (QtPoint3DPropertyManager *point3DManager = qobject_cast<QtPoint3DPropertyManager *>(manager)) {
+        return QVariant::fromValue(point3DManager->value(internProp));
+    } else if (QtPoint3DFPropertyManager *point3DFManager = qobject_cast<QtPoint3DFPropertyManager *>(manager)) {
+        return QVariant::fromValue(point3DFManager->value(internProp));
+    } else if (QtRotation3DPropertyManager *rotation3DManager = qobject_cast<QtRotation3DPropertyManager *>(manager)) {
+        return QVariant::fromValue(rotation3DManager->value(internProp));
     } else if (QtSizePropertyManager *sizeManager = qobject_cast<QtSizePropertyManager *>(manager)) {
         return sizeManager->value(internProp);
     } else if (QtSizeFPropertyManager *sizeFManager = qobject_cast<QtSizeFPropertyManager *>(manager)) {
@@ -1279,6 +1788,12 @@ QVariant QtVariantPropertyManager::value(const QtProperty *property) const
 #endif
     } else if (QtFlagPropertyManager *flagManager = qobject_cast<QtFlagPropertyManager *>(manager)) {
         return flagManager->value(internProp);
+    } else if (QtIntRangePropertyManager *intRangeManager = qobject_cast<QtIntRangePropertyManager *>(manager)) {
+        return QVariant::fromValue(QtIntRange(intRangeManager->minimumValue(internProp),
+                    intRangeManager->maximumValue(internProp)));
+    } else if (QtDoubleRangePropertyManager *doubleRangeManager = qobject_cast<QtDoubleRangePropertyManager *>(manager)) {
+        return QVariant::fromValue(QtDoubleRange(doubleRangeManager->minimumValue(internProp),
+                    doubleRangeManager->maximumValue(internProp)));
     }
     return QVariant();
 }
@@ -1319,6 +1834,103 @@ int QtVariantPropertyManager::propertyType(const QtProperty *property) const
     return it.value().second;
 }
 
+/*!
+    Returns whether the given \a property is bound to target values.
+
+    \sa setTargetValues()
+*/
+bool QtVariantPropertyManager::hasTargetValues(const QtProperty *property) const
+{
+    return d_ptr->m_targets.contains(property);
+}
+
+/*!
+    Returns the target values the given \a property is bound to, or an
+    empty list if it is not bound.
+
+    \sa setTargetValues(), targetValuesChanged()
+*/
+QVariantList QtVariantPropertyManager::targetValues(const QtProperty *property) const
+{
+    return d_ptr->m_targets.value(property).values;
+}
+
+/*!
+    Returns whether the target values of the given \a property differ.
+
+    \sa targetMinimum(), targetMaximum()
+*/
+bool QtVariantPropertyManager::isMixed(const QtProperty *property) const
+{
+    return d_ptr->m_targets.value(property).mixed;
+}
+
+/*!
+    Returns the smallest target value of the given \a property if it
+    is an int or double property bound to target values; otherwise
+    returns an invalid variant.
+
+    \sa targetMaximum(), isMixed()
+*/
+QVariant QtVariantPropertyManager::targetMinimum(const QtProperty *property) const
+{
+    return d_ptr->m_targets.value(property).minimum;
+}
+
+/*!
+    Returns the largest target value of the given \a property if it is
+    an int or double property bound to target values; otherwise returns
+    an invalid variant.
+
+    \sa targetMinimum(), isMixed()
+*/
+QVariant QtVariantPropertyManager::targetMaximum(const QtProperty *property) const
+{
+    return d_ptr->m_targets.value(property).maximum;
+}
+
+/*!
+    Binds the given \a property to the target \a values, one for each
+    object being edited. The property shows the first value, and is
+    mixed if the values differ. Setting the property's value afterwards
+    assigns it to all targets. An empty list removes the binding.
+
+    \sa targetValues(), clearTargetValues(), targetValuesChanged()
+*/
+void QtVariantPropertyManager::setTargetValues(QtProperty *property, const QVariantList &values)
+{
+    if (!d_ptr->m_propertyToType.contains(property))
+        return;
+    if (values.isEmpty()) {
+        clearTargetValues(property);
+        return;
+    }
+
+    QtVariantPropertyManagerPrivate::TargetData data;
+    data.values = values;
+    d_ptr->aggregateTargets(property, data);
+    d_ptr->m_targets.insert(property, data);
+
+    const bool wasSetting = d_ptr->m_settingTargetValues;
+    d_ptr->m_settingTargetValues = true;
+    setValue(property, values.first());
+    d_ptr->m_settingTargetValues = wasSetting;
+
+    emit propertyChanged(property);
+}
+
+/*!
+    Removes the binding of the given \a property to target values. The
+    property keeps its current value.
+
+    \sa setTargetValues()
+*/
+void QtVariantPropertyManager::clearTargetValues(QtProperty *property)
+{
+    if (d_ptr->m_targets.remove(property))
+        emit propertyChanged(property);
+}
+
 /*!
     Returns the given \a property's value for the specified \a
     attribute
@@ -1382,6 +1994,10 @@ QVariant QtVariantPropertyManager::attributeValue(const QtProperty *property, co
         if (attribute == d_ptr->m_decimalsAttribute)
             return pointFManager->decimals(internProp);
         return QVariant();
+    } else if (QtPoint3DFPropertyManager *point3DFManager = qobject_cast<QtPoint3DFPropertyManager *>(manager)) {
+        if (attribute == d_ptr->m_decimalsAttribute)
+            return point3DFManager->decimals(internProp);
+        return QVariant();
     } else if (QtSizePropertyManager *sizeManager = qobject_cast<QtSizePropertyManager *>(manager)) {
         if (attribute == d_ptr->m_maximumAttribute)
             return sizeManager->maximum(internProp);
@@ -1419,6 +2035,24 @@ QVariant QtVariantPropertyManager::attributeValue(const QtProperty *property, co
         if (attribute == d_ptr->m_flagNamesAttribute)
             return flagManager->flagNames(internProp);
         return QVariant();
+    } else if (QtIntRangePropertyManager *intRangeManager = qobject_cast<QtIntRangePropertyManager *>(manager)) {
+        if (attribute == d_ptr->m_maximumAttribute)
+            return intRangeManager->maximum(internProp);
+        if (attribute == d_ptr->m_minimumAttribute)
+            return intRangeManager->minimum(internProp);
+        if (attribute == d_ptr->m_singleStepAttribute)
+            return intRangeManager->singleStep(internProp);
+        return QVariant();
+    } else if (QtDoubleRangePropertyManager *doubleRangeManager = qobject_cast<QtDoubleRangePropertyManager *>(manager)) {
+        if (attribute == d_ptr->m_maximumAttribute)
+            return doubleRangeManager->maximum(internProp);
+        if (attribute == d_ptr->m_minimumAttribute)
+            return doubleRangeManager->minimum(internProp);
+        if (attribute == d_ptr->m_singleStepAttribute)
+            return doubleRangeManager->singleStep(internProp);
+        if (attribute == d_ptr->m_decimalsAttribute)
+            return doubleRangeManager->decimals(internProp);
+        return QVariant();
     }
     return QVariant();
 }
@@ -1475,6 +2109,7 @@ int QtVariantPropertyManager::attributeType(int propertyType, const QString &att
 */
 void QtVariantPropertyManager::setValue(QtProperty *property, const QVariant &val)
 {
+    QT_PROPERTYBROWSER_COUNT(setValueCalls);
     int propType = val.userType();
     if (!propType)
         return;
@@ -1488,6 +2123,23 @@ void QtVariantPropertyManager::setValue(QtProperty *property, const QVariant &va
     if (internProp == 0)
         return;
 
+    // Assigning the whole value replaces every target's value.
+    const QScopedValueRollback<const QtProperty *> assigned(d_ptr->m_assignedProperty, property);
+
+    // A mixed property shows the first target's value, which the wrapped
+    // manager ignores as unchanged. Assign it to the other targets here.
+    const auto targetIt = d_ptr->m_targets.find(property);
+    if (targetIt != d_ptr->m_targets.end() && targetIt.value().mixed && !d_ptr->m_settingTargetValues) {
+        QVariant converted = val;
+        if (converted.convert(QMetaType(valType)) && converted == value(property)) {
+            targetIt.value().values.fill(converted);
+            d_ptr->aggregateTargets(property, targetIt.value());
+            const QVariantList targets = targetIt.value().values;
+            emit propertyChanged(property);
+            emit targetValuesChanged(property, targets);
+            return;
+        }
+    }
 
     QtAbstractPropertyManager *manager = internProp->propertyManager();
     if (QtIntPropertyManager *intManager = qobject_cast<QtIntPropertyManager *>(manager)) {
@@ -1526,6 +2178,15 @@ void QtVariantPropertyManager::setValue(QtProperty *property, const QVariant &va
     } else if (QtPointFPropertyManager *pointFManager = qobject_cast<QtPointFPropertyManager *>(manager)) {
         pointFManager->setValue(internProp, qvariant_cast<QPointF>(val));
         return;
+    } else if (QtPoint3DPropertyManager *point3DManager = qobject_cast<QtPoint3DPropertyManager *>(manager)) {
+        point3DManager->setValue(internProp, qvariant_cast<QPoint3D>(val));
+        return;
+    } else if (QtPoint3DFPropertyManager *point3DFManager = qobject_cast<QtPoint3DFPropertyManager *>(manager)) {
+        point3DFManager->setValue(internProp, qvariant_cast<QPoint3DF>(val));
+        return;
+    } else if (QtRotation3DPropertyManager *rotation3DManager = qobject_cast<QtRotation3DPropertyManager *>(manager)) {
+        rotation3DManager->setValue(internProp, qvariant_cast<QRotation3D>(val));
+        return;
     } else if (QtSizePropertyManager *sizeManager = qobject_cast<QtSizePropertyManager *>(manager)) {
         sizeManager->setValue(internProp, qvariant_cast<QSize>(val));
         return;
@@ -1559,6 +2220,14 @@ void QtVariantPropertyManager::setValue(QtProperty *property, const QVariant &va
     } else if (QtFlagPropertyManager *flagManager = qobject_cast<QtFlagPropertyManager *>(manager)) {
         flagManager->setValue(internProp, qvariant_cast<int>(val));
         return;
+    } else if (QtIntRangePropertyManager *intRangeManager = qobject_cast<QtIntRangePropertyManager *>(manager)) {
+        const QtIntRange range = qvariant_cast<QtIntRange>(val);
+        intRangeManager->setValues(internProp, range.first, range.second);
+        return;
+    } else if (QtDoubleRangePropertyManager *doubleRangeManager = qobject_cast<QtDoubleRangePropertyManager *>(manager)) {
+        const QtDoubleRange range = qvariant_cast<QtDoubleRange>(val);
+        doubleRangeManager->setValues(internProp, range.first, range.second);
+        return;
     }
 }
 
@@ -1625,6 +2294,10 @@ void QtVariantPropertyManager::setAttribute(QtProperty *property,
         if (attribute == d_ptr->m_decimalsAttribute)
             pointFManager->setDecimals(internProp, qvariant_cast<int>(value));
         return;
+    } else if (QtPoint3DFPropertyManager *point3DFManager = qobject_cast<QtPoint3DFPropertyManager *>(manager)) {
+        if (attribute == d_ptr->m_decimalsAttribute)
+            point3DFManager->setDecimals(internProp, qvariant_cast<int>(value));
+        return;
     } else if (QtSizePropertyManager *sizeManager = qobject_cast<QtSizePropertyManager *>(manager)) {
         if (attribute == d_ptr->m_maximumAttribute)
             sizeManager->setMaximum(internProp, qvariant_cast<QSize>(value));
@@ -1659,6 +2332,24 @@ void QtVariantPropertyManager::setAttribute(QtProperty *property,
         if (attribute == d_ptr->m_flagNamesAttribute)
             flagManager->setFlagNames(internProp, qvariant_cast<QStringList>(value));
         return;
+    } else if (QtIntRangePropertyManager *intRangeManager = qobject_cast<QtIntRangePropertyManager *>(manager)) {
+        if (attribute == d_ptr->m_maximumAttribute)
+            intRangeManager->setMaximum(internProp, qvariant_cast<int>(value));
+        else if (attribute == d_ptr->m_minimumAttribute)
+            intRangeManager->setMinimum(internProp, qvariant_cast<int>(value));
+        else if (attribute == d_ptr->m_singleStepAttribute)
+            intRangeManager->setSingleStep(internProp, qvariant_cast<int>(value));
+        return;
+    } else if (QtDoubleRangePropertyManager *doubleRangeManager = qobject_cast<QtDoubleRangePropertyManager *>(manager)) {
+        if (attribute == d_ptr->m_maximumAttribute)
+            doubleRangeManager->setMaximum(internProp, qvariant_cast<double>(value));
+        else if (attribute == d_ptr->m_minimumAttribute)
+            doubleRangeManager->setMinimum(internProp, qvariant_cast<double>(value));
+        else if (attribute == d_ptr->m_singleStepAttribute)
+            doubleRangeManager->setSingleStep(internProp, qvariant_cast<double>(value));
+        else if (attribute == d_ptr->m_decimalsAttribute)
+            doubleRangeManager->setDecimals(internProp, qvariant_cast<int>(value));
+        return;
     }
 }
 
@@ -1677,6 +2368,19 @@ bool QtVariantPropertyManager::hasValue(const QtProperty *property) const
 */
 QString QtVariantPropertyManager::valueText(const QtProperty *property) const
 {
+    const auto target_it = d_ptr->m_targets.constFind(property);
+    if (target_it != d_ptr->m_targets.constEnd() && target_it.value().mixed) {
+        const QtVariantPropertyManagerPrivate::TargetData &data = target_it.value();
+        if (!data.minimum.isValid())
+            return tr("<Mixed>");
+        if (propertyType(property) == QMetaType::Double) {
+            const int dec = attributeValue(property, d_ptr->m_decimalsAttribute).toInt();
+            return tr("<Mixed> (%1 - %2)").arg(QString::number(data.minimum.toDouble(), 'f', dec),
+                                                QString::number(data.maximum.toDouble(), 'f', dec));
+        }
+        return tr("<Mixed> (%1 - %2)").arg(data.minimum.toInt()).arg(data.maximum.toInt());
+    }
+
     const QtProperty *internProp = propertyToWrappedProperty()->value(property, 0);
     return internProp ? internProp->valueText() : QString();
 }
@@ -1686,6 +2390,9 @@ QString QtVariantPropertyManager::valueText(const QtProperty *property) const
 */
 QIcon QtVariantPropertyManager::valueIcon(const QtProperty *property) const
 {
+    if (isMixed(property))
+        return QIcon();
+
     const QtProperty *internProp = propertyToWrappedProperty()->value(property, 0);
     return internProp ? internProp->valueIcon() : QIcon();
 }
@@ -1740,6 +2447,7 @@ void QtVariantPropertyManager::uninitializeProperty(QtProperty *property)
         }
         propertyToWrappedProperty()->erase(it);
     }
+    d_ptr->m_targets.remove(property);
     d_ptr->m_propertyToType.erase(type_it);
 }
 
@@ -1757,9 +2465,243 @@ QtProperty *QtVariantPropertyManager::createProperty()
     return property;
 }
 
+/*!
+    \internal
+*/
+bool QtVariantPropertyManager::hasDeferredSubProperties(const QtProperty *property) const
+{
+    const QtProperty *internProp = propertyToWrappedProperty()->value(property, 0);
+    return internProp ? internProp->hasDeferredSubProperties() : false;
+}
+
+/*!
+    \internal
+
+    Forwards the request to the wrapped property; its subproperties are
+    mirrored into \a property by slotPropertyInserted().
+*/
+void QtVariantPropertyManager::createDeferredSubProperties(QtProperty *property)
+{
+    if (QtProperty *internProp = propertyToWrappedProperty()->value(property, 0))
+        internProp->requestSubProperties();
+}
+
+/*!
+    \internal
+*/
+void QtVariantPropertyManager::destroyDeferredSubProperties(QtProperty *property)
+{
+    if (QtProperty *internProp = propertyToWrappedProperty()->value(property, 0))
+        internProp->releaseSubProperties();
+}
+
+/*!
+    \reimp
+
+    Subproperties are not recorded; their changes are recorded as
+    changes of the parent property's value. Properties bound to target
+    values record the values of all targets.
+*/
+QVariant QtVariantPropertyManager::journalValue(const QtProperty *property) const
+{
+    const QtProperty *internProp = propertyToWrappedProperty()->value(property, 0);
+    if (!internProp)
+        return QVariant();
+    for (const QtAbstractPropertyManager *manager : qAsConst(d_ptr->m_typeToPropertyManager)) {
+        if (manager != internProp->propertyManager())
+            continue;
+        const auto it = d_ptr->m_targets.constFind(property);
+        if (it != d_ptr->m_targets.constEnd())
+            return QVariant::fromValue(QtVariantPropertyManagerPrivate::JournalTargets{it.value().values});
+        return value(property);
+    }
+    return QVariant();
+}
+
+/*!
+    \reimp
+*/
+void QtVariantPropertyManager::setJournalValue(QtProperty *property, const QVariant &value)
+{
+    if (value.userType() == qMetaTypeId<QtVariantPropertyManagerPrivate::JournalTargets>()) {
+        const QVariantList values = value.value<QtVariantPropertyManagerPrivate::JournalTargets>().values;
+        setTargetValues(property, values);
+        emit targetValuesChanged(property, values);
+        return;
+    }
+    // A value recorded before the property was bound undoes the binding.
+    clearTargetValues(property);
+    setValue(property, value);
+}
+
+/*!
+    \reimp
+
+    Unbound 3D point properties are applied through the bulk setters of
+    their internal managers, so that a step changing many of them is
+    one batch.
+*/
+void QtVariantPropertyManager::setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values)
+{
+    QtPoint3DPropertyManager *point3DManager =
+            qobject_cast<QtPoint3DPropertyManager *>(d_ptr->m_typeToPropertyManager.value(qMetaTypeId<QPoint3D>(), 0));
+    QtPoint3DFPropertyManager *point3DFManager =
+            qobject_cast<QtPoint3DFPropertyManager *>(d_ptr->m_typeToPropertyManager.value(qMetaTypeId<QPoint3DF>(), 0));
+    QList<QtProperty *> point3DProperties;
+    QList<QPoint3D> point3DValues;
+    QList<QtProperty *> point3DFProperties;
+    QList<QPoint3DF> point3DFValues;
+
+    const qsizetype count = qMin(properties.size(), values.size());
+    for (qsizetype i = 0; i < count; ++i) {
+        QtProperty *property = properties.at(i);
+        const QVariant &value = values.at(i);
+        QtProperty *internProp = propertyToWrappedProperty()->value(property, 0);
+        if (internProp && !d_ptr->m_targets.contains(property)) {
+            if (point3DManager && internProp->propertyManager() == point3DManager
+                        && value.userType() == qMetaTypeId<QPoint3D>()) {
+                point3DProperties.append(internProp);
+                point3DValues.append(value.value<QPoint3D>());
+                continue;
+            }
+            if (point3DFManager && internProp->propertyManager() == point3DFManager
+                        && value.userType() == qMetaTypeId<QPoint3DF>()) {
+                point3DFProperties.append(internProp);
+                point3DFValues.append(value.value<QPoint3DF>());
+                continue;
+            }
+        }
+        setJournalValue(property, value);
+    }
+
+    if (!point3DProperties.isEmpty())
+        point3DManager->setValues(point3DProperties, point3DValues);
+    if (!point3DFProperties.isEmpty())
+        point3DFManager->setValues(point3DFProperties, point3DFValues);
+}
+
+/*!
+    \reimp
+
+    The memory of the internal properties wrapped by the variant
+    properties is charged to the variant properties.
+*/
+QtMemoryReport QtVariantPropertyManager::memoryReport() const
+{
+    QtMemoryReport report = QtAbstractPropertyManager::memoryReport();
+    QHash<const QtProperty *, qint64> properties;
+    properties.reserve(report.properties.size());
+    for (auto it = report.properties.cbegin(); it != report.properties.cend(); ++it) {
+        const QtProperty *property = d_ptr->m_internalToProperty.value(const_cast<QtProperty *>(it.key()), 0);
+        properties[property ? property : it.key()] += it.value();
+    }
+    report.properties = properties;
+    return report;
+}
+
+/*!
+    \reimp
+*/
+void QtVariantPropertyManager::reportMemory(const QtProperty *property, QtMemoryReport *report) const
+{
+    const QString type = QString::fromLatin1(metaObject()->className());
+    report->add(QtMemoryReport::Properties, type, property,
+                sizeof(QtVariantProperty) - sizeof(QtProperty) + sizeof(QtVariantPropertyPrivate));
+
+    typedef QPair<QtVariantProperty *, int> PropertyType;
+    qint64 mapBytes = 0;
+    if (d_ptr->m_propertyToType.contains(property))
+        mapBytes += QtMemoryReport::mapNodeBytes<const QtProperty *, PropertyType>();
+    if (propertyToWrappedProperty()->contains(property)) {
+        mapBytes += QtMemoryReport::mapNodeBytes<const QtProperty *, QtProperty *>()
+                    + QtMemoryReport::mapNodeBytes<QtProperty *, QtVariantProperty *>();
+    }
+    if (mapBytes)
+        report->add(QtMemoryReport::MapNodes, type, property, mapBytes);
+
+    const auto it = d_ptr->m_targets.constFind(property);
+    if (it != d_ptr->m_targets.constEnd()) {
+        const QtVariantPropertyManagerPrivate::TargetData &data = it.value();
+        report->add(QtMemoryReport::ManagerData, type, property,
+                    QtMemoryReport::hashNodeBytes<const QtProperty *, QtVariantPropertyManagerPrivate::TargetData>()
+                    + QtMemoryReport::listBytes(data.values));
+    }
+}
+
 /////////////////////////////
 
 
+static const char mixedEditorPropertyName[] = "_q_mixed";
+static const char mixedEditorIndexName[] = "_q_mixedIndex";
+
+// Editors that stay open, like those of the group box and button
+// browsers, would show the first target's value of a mixed property.
+// Clear them and show a placeholder instead, and restore the value
+// once the property is no longer mixed.
+void QtVariantEditorFactoryPrivate::updateMixedState(QtProperty *property, QWidget *editor) const
+{
+    const QtVariantPropertyManager *manager = q_ptr->propertyManager(property);
+    const bool mixed = manager && manager->isMixed(property);
+    if (!mixed && !editor->property(mixedEditorPropertyName).toBool())
+        return;
+    editor->setProperty(mixedEditorPropertyName, mixed);
+
+    const QString placeholder = mixed ? QtVariantEditorFactory::tr("<Mixed>") : QString();
+    editor->blockSignals(true);
+    if (QAbstractSpinBox *spinBox = qobject_cast<QAbstractSpinBox *>(editor)) {
+        if (QLineEdit *lineEdit = spinBox->findChild<QLineEdit *>())
+            lineEdit->setPlaceholderText(placeholder);
+        if (mixed) {
+            spinBox->clear();
+        } else if (QSpinBox *intSpinBox = qobject_cast<QSpinBox *>(spinBox)) {
+            intSpinBox->setValue(intSpinBox->value());
+        } else if (QDoubleSpinBox *doubleSpinBox = qobject_cast<QDoubleSpinBox *>(spinBox)) {
+            doubleSpinBox->setValue(doubleSpinBox->value());
+        } else if (QDateTimeEdit *dateTimeEdit = qobject_cast<QDateTimeEdit *>(spinBox)) {
+            dateTimeEdit->setDateTime(dateTimeEdit->dateTime());
+        }
+    } else if (QLineEdit *lineEdit = qobject_cast<QLineEdit *>(editor)) {
+        lineEdit->setPlaceholderText(placeholder);
+        if (mixed)
+            lineEdit->clear();
+        else
+            lineEdit->setText(manager->value(property).toString());
+    } else if (QComboBox *comboBox = qobject_cast<QComboBox *>(editor)) {
+        comboBox->setPlaceholderText(placeholder);
+        if (mixed) {
+            if (comboBox->currentIndex() >= 0)
+                comboBox->setProperty(mixedEditorIndexName, comboBox->currentIndex());
+            comboBox->setCurrentIndex(-1);
+        } else if (comboBox->currentIndex() < 0) {
+            comboBox->setCurrentIndex(comboBox->property(mixedEditorIndexName).toInt());
+        }
+    }
+    editor->blockSignals(false);
+}
+
+void QtVariantEditorFactoryPrivate::slotPropertyChanged(QtProperty *property)
+{
+    const auto it = m_createdEditors.constFind(property);
+    if (it == m_createdEditors.constEnd())
+        return;
+    for (QWidget *editor : it.value())
+        updateMixedState(property, editor);
+}
+
+void QtVariantEditorFactoryPrivate::slotEditorDestroyed(QObject *object)
+{
+    const auto it = m_editorToProperty.find(static_cast<QWidget *>(object));
+    if (it == m_editorToProperty.end())
+        return;
+    const auto pit = m_createdEditors.find(it.value());
+    if (pit != m_createdEditors.end()) {
+        pit.value().removeAll(it.key());
+        if (pit.value().isEmpty())
+            m_createdEditors.erase(pit);
+    }
+    m_editorToProperty.erase(it);
+}
+
 /*!
     \class QtVariantEditorFactory
     \internal
@@ -1809,6 +2751,12 @@ QtProperty *QtVariantPropertyManager::createProperty()
     \row
         \li QCursor
         \li QComboBox
+    \row
+        \li int range
+        \li RangeSlider
+    \row
+        \li double range
+        \li RangeSlider
     \endtable
 
     Note that QtVariantPropertyManager supports several additional property
@@ -1820,6 +2768,42 @@ QtProperty *QtVariantPropertyManager::createProperty()
     \sa QtAbstractEditorFactory, QtVariantPropertyManager
 */
 
+/*
+    The factory table is indexed directly by property type. Core, GUI and
+    user type ids are far apart, so each range is shifted to follow the
+    previous one; ids outside these ranges have no slot.
+*/
+int QtVariantEditorFactoryPrivate::factoryIndex(int propertyType)
+{
+    const int coreCount = QMetaType::LastCoreType + 1;
+    const int guiCount = QMetaType::LastGuiType - QMetaType::FirstGuiType + 1;
+    if (propertyType >= 0 && propertyType <= QMetaType::LastCoreType)
+        return propertyType;
+    if (propertyType >= QMetaType::FirstGuiType && propertyType <= QMetaType::LastGuiType)
+        return coreCount + propertyType - QMetaType::FirstGuiType;
+    if (propertyType >= QMetaType::User)
+        return coreCount + guiCount + propertyType - QMetaType::User;
+    return -1;
+}
+
+void QtVariantEditorFactoryPrivate::setFactoryForType(int propertyType, QtAbstractEditorFactoryBase *factory)
+{
+    const int index = factoryIndex(propertyType);
+    if (index < 0)
+        return;
+    if (index >= m_typeToFactory.size())
+        m_typeToFactory.resize(index + 1);
+    m_typeToFactory[index] = factory;
+}
+
+QtAbstractEditorFactoryBase *QtVariantEditorFactoryPrivate::factoryForType(int propertyType) const
+{
+    const int index = factoryIndex(propertyType);
+    if (index < 0 || index >= m_typeToFactory.size())
+        return 0;
+    return m_typeToFactory.at(index);
+}
+
 /*!
     Creates a factory with the given \a parent.
 */
@@ -1829,56 +2813,81 @@ QtVariantEditorFactory::QtVariantEditorFactory(QObject *parent) : QtAbstractEdit
 
     d_ptr->m_spinBoxFactory = new QtSpinBoxFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_spinBoxFactory] = QMetaType::Int;
-    d_ptr->m_typeToFactory[QMetaType::Int] = d_ptr->m_spinBoxFactory;
+    d_ptr->setFactoryForType(QMetaType::Int, d_ptr->m_spinBoxFactory);
 
     d_ptr->m_doubleSpinBoxFactory = new QtDoubleSpinBoxFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_doubleSpinBoxFactory] = QMetaType::Double;
-    d_ptr->m_typeToFactory[QMetaType::Double] = d_ptr->m_doubleSpinBoxFactory;
+    d_ptr->setFactoryForType(QMetaType::Double, d_ptr->m_doubleSpinBoxFactory);
 
     d_ptr->m_checkBoxFactory = new QtCheckBoxFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_checkBoxFactory] = QMetaType::Bool;
-    d_ptr->m_typeToFactory[QMetaType::Bool] = d_ptr->m_checkBoxFactory;
+    d_ptr->setFactoryForType(QMetaType::Bool, d_ptr->m_checkBoxFactory);
 
     d_ptr->m_lineEditFactory = new QtLineEditFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_lineEditFactory] = QMetaType::QString;
-    d_ptr->m_typeToFactory[QMetaType::QString] = d_ptr->m_lineEditFactory;
+    d_ptr->setFactoryForType(QMetaType::QString, d_ptr->m_lineEditFactory);
 
     d_ptr->m_dateEditFactory = new QtDateEditFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_dateEditFactory] = QMetaType::QDate;
-    d_ptr->m_typeToFactory[QMetaType::QDate] = d_ptr->m_dateEditFactory;
+    d_ptr->setFactoryForType(QMetaType::QDate, d_ptr->m_dateEditFactory);
 
     d_ptr->m_timeEditFactory = new QtTimeEditFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_timeEditFactory] = QMetaType::QTime;
-    d_ptr->m_typeToFactory[QMetaType::QTime] = d_ptr->m_timeEditFactory;
+    d_ptr->setFactoryForType(QMetaType::QTime, d_ptr->m_timeEditFactory);
 
     d_ptr->m_dateTimeEditFactory = new QtDateTimeEditFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_dateTimeEditFactory] = QMetaType::QDateTime;
-    d_ptr->m_typeToFactory[QMetaType::QDateTime] = d_ptr->m_dateTimeEditFactory;
+    d_ptr->setFactoryForType(QMetaType::QDateTime, d_ptr->m_dateTimeEditFactory);
 
     d_ptr->m_keySequenceEditorFactory = new QtKeySequenceEditorFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_keySequenceEditorFactory] = QMetaType::QKeySequence;
-    d_ptr->m_typeToFactory[QMetaType::QKeySequence] = d_ptr->m_keySequenceEditorFactory;
+    d_ptr->setFactoryForType(QMetaType::QKeySequence, d_ptr->m_keySequenceEditorFactory);
 
     d_ptr->m_charEditorFactory = new QtCharEditorFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_charEditorFactory] = QMetaType::QChar;
-    d_ptr->m_typeToFactory[QMetaType::QChar] = d_ptr->m_charEditorFactory;
+    d_ptr->setFactoryForType(QMetaType::QChar, d_ptr->m_charEditorFactory);
 
     d_ptr->m_cursorEditorFactory = new QtCursorEditorFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_cursorEditorFactory] = QMetaType::QCursor;
-    d_ptr->m_typeToFactory[QMetaType::QCursor] = d_ptr->m_cursorEditorFactory;
+    d_ptr->setFactoryForType(QMetaType::QCursor, d_ptr->m_cursorEditorFactory);
 
     d_ptr->m_colorEditorFactory = new QtColorEditorFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_colorEditorFactory] = QMetaType::QColor;
-    d_ptr->m_typeToFactory[QMetaType::QColor] = d_ptr->m_colorEditorFactory;
+    d_ptr->setFactoryForType(QMetaType::QColor, d_ptr->m_colorEditorFactory);
 
     d_ptr->m_fontEditorFactory = new QtFontEditorFactory(this);
     d_ptr->m_factoryToType[d_ptr->m_fontEditorFactory] = QMetaType::QFont;
-    d_ptr->m_typeToFactory[QMetaType::QFont] = d_ptr->m_fontEditorFactory;
+    d_ptr->setFactoryForType(QMetaType::QFont, d_ptr->m_fontEditorFactory);
 
     d_ptr->m_comboBoxFactory = new QtEnumEditorFactory(this);
     const int enumId = QtVariantPropertyManager::enumTypeId();
     d_ptr->m_factoryToType[d_ptr->m_comboBoxFactory] = enumId;
-    d_ptr->m_typeToFactory[enumId] = d_ptr->m_comboBoxFactory;
+    d_ptr->setFactoryForType(enumId, d_ptr->m_comboBoxFactory);
+
+    d_ptr->m_intRangeEditorFactory = new QtIntRangeEditorFactory(this);
+    const int intRangeId = QtVariantPropertyManager::intRangeTypeId();
+    d_ptr->m_factoryToType[d_ptr->m_intRangeEditorFactory] = intRangeId;
+    d_ptr->setFactoryForType(intRangeId, d_ptr->m_intRangeEditorFactory);
+
+    d_ptr->m_doubleRangeEditorFactory = new QtDoubleRangeEditorFactory(this);
+    const int doubleRangeId = QtVariantPropertyManager::doubleRangeTypeId();
+    d_ptr->m_factoryToType[d_ptr->m_doubleRangeEditorFactory] = doubleRangeId;
+    d_ptr->setFactoryForType(doubleRangeId, d_ptr->m_doubleRangeEditorFactory);
+
+    d_ptr->m_point3DEditorFactory = new QtPoint3DEditorFactory(this);
+    const int point3DId = qMetaTypeId<QPoint3D>();
+    d_ptr->m_factoryToType[d_ptr->m_point3DEditorFactory] = point3DId;
+    d_ptr->setFactoryForType(point3DId, d_ptr->m_point3DEditorFactory);
+
+    d_ptr->m_point3DFEditorFactory = new QtPoint3DFEditorFactory(this);
+    const int point3DFId = qMetaTypeId<QPoint3DF>();
+    d_ptr->m_factoryToType[d_ptr->m_point3DFEditorFactory] = point3DFId;
+    d_ptr->setFactoryForType(point3DFId, d_ptr->m_point3DFEditorFactory);
+
+    d_ptr->m_rotation3DEditorFactory = new QtRotation3DEditorFactory(this);
+    const int rotation3DId = qMetaTypeId<QRotation3D>();
+    d_ptr->m_factoryToType[d_ptr->m_rotation3DEditorFactory] = rotation3DId;
+    d_ptr->setFactoryForType(rotation3DId, d_ptr->m_rotation3DEditorFactory);
 }
 
 /*!
@@ -1895,93 +2904,116 @@ QtVariantEditorFactory::~QtVariantEditorFactory()
 */
 void QtVariantEditorFactory::connectPropertyManager(QtVariantPropertyManager *manager)
 {
-    const auto intPropertyManagers = manager->findChildren<QtIntPropertyManager *>();
+    connect(manager, SIGNAL(propertyChanged(QtProperty*)),
+                this, SLOT(slotPropertyChanged(QtProperty*)));
+
+    const auto intPropertyManagers = manager->internalPropertyManagers<QtIntPropertyManager>();
     for (QtIntPropertyManager *manager : intPropertyManagers)
         d_ptr->m_spinBoxFactory->addPropertyManager(manager);
 
-    const auto doublePropertyManagers = manager->findChildren<QtDoublePropertyManager *>();
+    const auto doublePropertyManagers = manager->internalPropertyManagers<QtDoublePropertyManager>();
     for (QtDoublePropertyManager *manager : doublePropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->addPropertyManager(manager);
 
-    const auto boolPropertyManagers = manager->findChildren<QtBoolPropertyManager *>();
+    const auto boolPropertyManagers = manager->internalPropertyManagers<QtBoolPropertyManager>();
     for (QtBoolPropertyManager *manager : boolPropertyManagers)
         d_ptr->m_checkBoxFactory->addPropertyManager(manager);
 
-    const auto stringPropertyManagers = manager->findChildren<QtStringPropertyManager *>();
+    const auto stringPropertyManagers = manager->internalPropertyManagers<QtStringPropertyManager>();
     for (QtStringPropertyManager *manager : stringPropertyManagers)
         d_ptr->m_lineEditFactory->addPropertyManager(manager);
 
-    const auto datePropertyManagers = manager->findChildren<QtDatePropertyManager *>();
+    const auto datePropertyManagers = manager->internalPropertyManagers<QtDatePropertyManager>();
     for (QtDatePropertyManager *manager : datePropertyManagers)
         d_ptr->m_dateEditFactory->addPropertyManager(manager);
 
-    const auto timePropertyManagers = manager->findChildren<QtTimePropertyManager *>();
+    const auto timePropertyManagers = manager->internalPropertyManagers<QtTimePropertyManager>();
     for (QtTimePropertyManager *manager : timePropertyManagers)
         d_ptr->m_timeEditFactory->addPropertyManager(manager);
 
-    const auto dateTimePropertyManagers = manager->findChildren<QtDateTimePropertyManager *>();
+    const auto dateTimePropertyManagers = manager->internalPropertyManagers<QtDateTimePropertyManager>();
     for (QtDateTimePropertyManager *manager : dateTimePropertyManagers)
         d_ptr->m_dateTimeEditFactory->addPropertyManager(manager);
 
-    const auto keySequencePropertyManagers = manager->findChildren<QtKeySequencePropertyManager *>();
+    const auto keySequencePropertyManagers = manager->internalPropertyManagers<QtKeySequencePropertyManager>();
     for (QtKeySequencePropertyManager *manager : keySequencePropertyManagers)
         d_ptr->m_keySequenceEditorFactory->addPropertyManager(manager);
 
-    const auto charPropertyManagers = manager->findChildren<QtCharPropertyManager *>();
+    const auto charPropertyManagers = manager->internalPropertyManagers<QtCharPropertyManager>();
     for (QtCharPropertyManager *manager : charPropertyManagers)
         d_ptr->m_charEditorFactory->addPropertyManager(manager);
 
-    const auto localePropertyManagers = manager->findChildren<QtLocalePropertyManager *>();
+    const auto intRangePropertyManagers = manager->internalPropertyManagers<QtIntRangePropertyManager>();
+    for (QtIntRangePropertyManager *manager : intRangePropertyManagers)
+        d_ptr->m_intRangeEditorFactory->addPropertyManager(manager);
+
+    const auto doubleRangePropertyManagers = manager->internalPropertyManagers<QtDoubleRangePropertyManager>();
+    for (QtDoubleRangePropertyManager *manager : doubleRangePropertyManagers)
+        d_ptr->m_doubleRangeEditorFactory->addPropertyManager(manager);
+
+    const auto localePropertyManagers = manager->internalPropertyManagers<QtLocalePropertyManager>();
     for (QtLocalePropertyManager *manager : localePropertyManagers)
         d_ptr->m_comboBoxFactory->addPropertyManager(manager->subEnumPropertyManager());
 
-    const auto pointPropertyManagers = manager->findChildren<QtPointPropertyManager *>();
+    const auto pointPropertyManagers = manager->internalPropertyManagers<QtPointPropertyManager>();
     for (QtPointPropertyManager *manager : pointPropertyManagers)
         d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
 
-    //##########
-    const auto point3DPropertyManagers = manager->findChildren<QtPoint3DPropertyManager *>();
-    for (QtPoint3DPropertyManager *manager : point3DPropertyManagers)
+    const auto point3DPropertyManagers = manager->internalPropertyManagers<QtPoint3DPropertyManager>();
+    for (QtPoint3DPropertyManager *manager : point3DPropertyManagers) {
+        d_ptr->m_point3DEditorFactory->addPropertyManager(manager);
         d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
-    //##########
+    }
+
+    const auto point3DFPropertyManagers = manager->internalPropertyManagers<QtPoint3DFPropertyManager>();
+    for (QtPoint3DFPropertyManager *manager : point3DFPropertyManagers) {
+        d_ptr->m_point3DFEditorFactory->addPropertyManager(manager);
+        d_ptr->m_doubleSpinBoxFactory->addPropertyManager(manager->subDoublePropertyManager());
+    }
+
+    const auto rotation3DPropertyManagers = manager->internalPropertyManagers<QtRotation3DPropertyManager>();
+    for (QtRotation3DPropertyManager *manager : rotation3DPropertyManagers) {
+        d_ptr->m_rotation3DEditorFactory->addPropertyManager(manager);
+        d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
+    }
 
-    const auto pointFPropertyManagers = manager->findChildren<QtPointFPropertyManager *>();
+    const auto pointFPropertyManagers = manager->internalPropertyManagers<QtPointFPropertyManager>();
     for (QtPointFPropertyManager *manager : pointFPropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->addPropertyManager(manager->subDoublePropertyManager());
 
-    const auto sizePropertyManagers = manager->findChildren<QtSizePropertyManager *>();
+    const auto sizePropertyManagers = manager->internalPropertyManagers<QtSizePropertyManager>();
     for (QtSizePropertyManager *manager : sizePropertyManagers)
         d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
 
-    const auto sizeFPropertyManagers = manager->findChildren<QtSizeFPropertyManager *>();
+    const auto sizeFPropertyManagers = manager->internalPropertyManagers<QtSizeFPropertyManager>();
     for (QtSizeFPropertyManager *manager : sizeFPropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->addPropertyManager(manager->subDoublePropertyManager());
 
-    const auto rectPropertyManagers = manager->findChildren<QtRectPropertyManager *>();
+    const auto rectPropertyManagers = manager->internalPropertyManagers<QtRectPropertyManager>();
     for (QtRectPropertyManager *manager : rectPropertyManagers)
         d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
 
-    const auto rectFPropertyManagers = manager->findChildren<QtRectFPropertyManager *>();
+    const auto rectFPropertyManagers = manager->internalPropertyManagers<QtRectFPropertyManager>();
     for (QtRectFPropertyManager *manager : rectFPropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->addPropertyManager(manager->subDoublePropertyManager());
 
-    const auto colorPropertyManagers = manager->findChildren<QtColorPropertyManager *>();
+    const auto colorPropertyManagers = manager->internalPropertyManagers<QtColorPropertyManager>();
     for (QtColorPropertyManager *manager : colorPropertyManagers) {
         d_ptr->m_colorEditorFactory->addPropertyManager(manager);
         d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
     }
 
-    const auto enumPropertyManagers = manager->findChildren<QtEnumPropertyManager *>();
+    const auto enumPropertyManagers = manager->internalPropertyManagers<QtEnumPropertyManager>();
     for (QtEnumPropertyManager *manager : enumPropertyManagers)
         d_ptr->m_comboBoxFactory->addPropertyManager(manager);
 
-    const auto sizePolicyPropertyManagers = manager->findChildren<QtSizePolicyPropertyManager *>();
+    const auto sizePolicyPropertyManagers = manager->internalPropertyManagers<QtSizePolicyPropertyManager>();
     for (QtSizePolicyPropertyManager *manager : sizePolicyPropertyManagers) {
         d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
         d_ptr->m_comboBoxFactory->addPropertyManager(manager->subEnumPropertyManager());
     }
 
-    const auto fontPropertyManagers = manager->findChildren<QtFontPropertyManager *>();
+    const auto fontPropertyManagers = manager->internalPropertyManagers<QtFontPropertyManager>();
     for (QtFontPropertyManager *manager : fontPropertyManagers) {
         d_ptr->m_fontEditorFactory->addPropertyManager(manager);
         d_ptr->m_spinBoxFactory->addPropertyManager(manager->subIntPropertyManager());
@@ -1989,11 +3021,11 @@ void QtVariantEditorFactory::connectPropertyManager(QtVariantPropertyManager *ma
         d_ptr->m_checkBoxFactory->addPropertyManager(manager->subBoolPropertyManager());
     }
 
-    const auto cursorPropertyManagers = manager->findChildren<QtCursorPropertyManager *>();
+    const auto cursorPropertyManagers = manager->internalPropertyManagers<QtCursorPropertyManager>();
     for (QtCursorPropertyManager *manager : cursorPropertyManagers)
         d_ptr->m_cursorEditorFactory->addPropertyManager(manager);
 
-    const auto flagPropertyManagers = manager->findChildren<QtFlagPropertyManager *>();
+    const auto flagPropertyManagers = manager->internalPropertyManagers<QtFlagPropertyManager>();
     for (QtFlagPropertyManager *manager : flagPropertyManagers)
         d_ptr->m_checkBoxFactory->addPropertyManager(manager->subBoolPropertyManager());
 }
@@ -2007,10 +3039,61 @@ QWidget *QtVariantEditorFactory::createEditor(QtVariantPropertyManager *manager,
         QWidget *parent)
 {
     const int propType = manager->propertyType(property);
-    QtAbstractEditorFactoryBase *factory = d_ptr->m_typeToFactory.value(propType, 0);
+    QtAbstractEditorFactoryBase *factory = d_ptr->factoryForType(propType);
     if (!factory)
         return 0;
-    return factory->createEditor(wrappedProperty(property), parent);
+    QWidget *editor = factory->createEditor(wrappedProperty(property), parent);
+    if (!editor)
+        return 0;
+
+    d_ptr->m_createdEditors[property].append(editor);
+    d_ptr->m_editorToProperty[editor] = property;
+    connect(editor, SIGNAL(destroyed(QObject*)), this, SLOT(slotEditorDestroyed(QObject*)));
+    d_ptr->updateMixedState(property, editor);
+    return editor;
+}
+
+/*!
+    \internal
+
+    Reimplemented from the QtAbstractEditorFactory class.
+*/
+bool QtVariantEditorFactory::paintEditor(QtVariantPropertyManager *manager, QtProperty *property,
+        QPainter *painter, const QStyleOptionViewItem &option)
+{
+    const int propType = manager->propertyType(property);
+    QtAbstractEditorFactoryBase *factory = d_ptr->factoryForType(propType);
+    if (!factory)
+        return false;
+    return factory->paintEditor(wrappedProperty(property), painter, option);
+}
+
+/*!
+    \reimp
+
+    Passes the commit policy on to the factories creating the actual
+    editors, a property's own policy applying to the property it wraps.
+*/
+void QtVariantEditorFactory::commitPolicyChanged(const QtProperty *property)
+{
+    const QList<QtAbstractEditorFactoryBase *> factories = d_ptr->m_factoryToType.keys();
+    if (!property) {
+        for (QtAbstractEditorFactoryBase *factory : factories) {
+            factory->setCommitPolicy(commitPolicy());
+            factory->setCommitDelay(commitDelay());
+        }
+        return;
+    }
+
+    const QtProperty *internProp = propertyToWrappedProperty()->value(property, 0);
+    if (!internProp)
+        return;
+    for (QtAbstractEditorFactoryBase *factory : factories) {
+        if (hasCommitPolicy(property))
+            factory->setCommitPolicy(internProp, commitPolicy(property));
+        else
+            factory->unsetCommitPolicy(internProp);
+    }
 }
 
 /*!
@@ -2020,93 +3103,116 @@ QWidget *QtVariantEditorFactory::createEditor(QtVariantPropertyManager *manager,
 */
 void QtVariantEditorFactory::disconnectPropertyManager(QtVariantPropertyManager *manager)
 {
-    const auto intPropertyManagers = manager->findChildren<QtIntPropertyManager *>();
+    disconnect(manager, SIGNAL(propertyChanged(QtProperty*)),
+                this, SLOT(slotPropertyChanged(QtProperty*)));
+
+    const auto intPropertyManagers = manager->internalPropertyManagers<QtIntPropertyManager>();
     for (QtIntPropertyManager *manager : intPropertyManagers)
         d_ptr->m_spinBoxFactory->removePropertyManager(manager);
 
-    const auto doublePropertyManagers = manager->findChildren<QtDoublePropertyManager *>();
+    const auto doublePropertyManagers = manager->internalPropertyManagers<QtDoublePropertyManager>();
     for (QtDoublePropertyManager *manager : doublePropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->removePropertyManager(manager);
 
-    const auto boolPropertyManagers = manager->findChildren<QtBoolPropertyManager *>();
+    const auto boolPropertyManagers = manager->internalPropertyManagers<QtBoolPropertyManager>();
     for (QtBoolPropertyManager *manager : boolPropertyManagers)
         d_ptr->m_checkBoxFactory->removePropertyManager(manager);
 
-    const auto stringPropertyManagers = manager->findChildren<QtStringPropertyManager *>();
+    const auto stringPropertyManagers = manager->internalPropertyManagers<QtStringPropertyManager>();
     for (QtStringPropertyManager *manager : stringPropertyManagers)
         d_ptr->m_lineEditFactory->removePropertyManager(manager);
 
-    const auto datePropertyManagers = manager->findChildren<QtDatePropertyManager *>();
+    const auto datePropertyManagers = manager->internalPropertyManagers<QtDatePropertyManager>();
     for (QtDatePropertyManager *manager : datePropertyManagers)
         d_ptr->m_dateEditFactory->removePropertyManager(manager);
 
-    const auto timePropertyManagers = manager->findChildren<QtTimePropertyManager *>();
+    const auto timePropertyManagers = manager->internalPropertyManagers<QtTimePropertyManager>();
     for (QtTimePropertyManager *manager : timePropertyManagers)
         d_ptr->m_timeEditFactory->removePropertyManager(manager);
 
-    const auto dateTimePropertyManagers = manager->findChildren<QtDateTimePropertyManager *>();
+    const auto dateTimePropertyManagers = manager->internalPropertyManagers<QtDateTimePropertyManager>();
     for (QtDateTimePropertyManager *manager : dateTimePropertyManagers)
         d_ptr->m_dateTimeEditFactory->removePropertyManager(manager);
 
-    const auto keySequencePropertyManagers = manager->findChildren<QtKeySequencePropertyManager *>();
+    const auto keySequencePropertyManagers = manager->internalPropertyManagers<QtKeySequencePropertyManager>();
     for (QtKeySequencePropertyManager *manager : keySequencePropertyManagers)
         d_ptr->m_keySequenceEditorFactory->removePropertyManager(manager);
 
-    const auto charPropertyManagers = manager->findChildren<QtCharPropertyManager *>();
+    const auto charPropertyManagers = manager->internalPropertyManagers<QtCharPropertyManager>();
     for (QtCharPropertyManager *manager : charPropertyManagers)
         d_ptr->m_charEditorFactory->removePropertyManager(manager);
 
-    const auto localePropertyManagers = manager->findChildren<QtLocalePropertyManager *>();
+    const auto intRangePropertyManagers = manager->internalPropertyManagers<QtIntRangePropertyManager>();
+    for (QtIntRangePropertyManager *manager : intRangePropertyManagers)
+        d_ptr->m_intRangeEditorFactory->removePropertyManager(manager);
+
+    const auto doubleRangePropertyManagers = manager->internalPropertyManagers<QtDoubleRangePropertyManager>();
+    for (QtDoubleRangePropertyManager *manager : doubleRangePropertyManagers)
+        d_ptr->m_doubleRangeEditorFactory->removePropertyManager(manager);
+
+    const auto localePropertyManagers = manager->internalPropertyManagers<QtLocalePropertyManager>();
     for (QtLocalePropertyManager *manager : localePropertyManagers)
         d_ptr->m_comboBoxFactory->removePropertyManager(manager->subEnumPropertyManager());
 
-    const auto pointPropertyManagers = manager->findChildren<QtPointPropertyManager *>();
+    const auto pointPropertyManagers = manager->internalPropertyManagers<QtPointPropertyManager>();
     for (QtPointPropertyManager *manager : pointPropertyManagers)
         d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
 
-    //##########
-    const auto point3DPropertyManagers = manager->findChildren<QtPoint3DPropertyManager *>();
-    for (QtPoint3DPropertyManager *manager : point3DPropertyManagers)
+    const auto point3DPropertyManagers = manager->internalPropertyManagers<QtPoint3DPropertyManager>();
+    for (QtPoint3DPropertyManager *manager : point3DPropertyManagers) {
+        d_ptr->m_point3DEditorFactory->removePropertyManager(manager);
+        d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
+    }
+
+    const auto point3DFPropertyManagers = manager->internalPropertyManagers<QtPoint3DFPropertyManager>();
+    for (QtPoint3DFPropertyManager *manager : point3DFPropertyManagers) {
+        d_ptr->m_point3DFEditorFactory->removePropertyManager(manager);
+        d_ptr->m_doubleSpinBoxFactory->removePropertyManager(manager->subDoublePropertyManager());
+    }
+
+    const auto rotation3DPropertyManagers = manager->internalPropertyManagers<QtRotation3DPropertyManager>();
+    for (QtRotation3DPropertyManager *manager : rotation3DPropertyManagers) {
+        d_ptr->m_rotation3DEditorFactory->removePropertyManager(manager);
         d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
-    //###########
+    }
 
-    const auto pointFPropertyManagers = manager->findChildren<QtPointFPropertyManager *>();
+    const auto pointFPropertyManagers = manager->internalPropertyManagers<QtPointFPropertyManager>();
     for (QtPointFPropertyManager *manager : pointFPropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->removePropertyManager(manager->subDoublePropertyManager());
 
-    const auto sizePropertyManagers = manager->findChildren<QtSizePropertyManager *>();
+    const auto sizePropertyManagers = manager->internalPropertyManagers<QtSizePropertyManager>();
     for (QtSizePropertyManager *manager : sizePropertyManagers)
         d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
 
-    const auto sizeFPropertyManagers = manager->findChildren<QtSizeFPropertyManager *>();
+    const auto sizeFPropertyManagers = manager->internalPropertyManagers<QtSizeFPropertyManager>();
     for (QtSizeFPropertyManager *manager : sizeFPropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->removePropertyManager(manager->subDoublePropertyManager());
 
-    const auto rectPropertyManagers = manager->findChildren<QtRectPropertyManager *>();
+    const auto rectPropertyManagers = manager->internalPropertyManagers<QtRectPropertyManager>();
     for (QtRectPropertyManager *manager : rectPropertyManagers)
         d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
 
-    const auto rectFPropertyManagers = manager->findChildren<QtRectFPropertyManager *>();
+    const auto rectFPropertyManagers = manager->internalPropertyManagers<QtRectFPropertyManager>();
     for (QtRectFPropertyManager *manager : rectFPropertyManagers)
         d_ptr->m_doubleSpinBoxFactory->removePropertyManager(manager->subDoublePropertyManager());
 
-    const auto colorPropertyManagers = manager->findChildren<QtColorPropertyManager *>();
+    const auto colorPropertyManagers = manager->internalPropertyManagers<QtColorPropertyManager>();
     for (QtColorPropertyManager *manager : colorPropertyManagers) {
         d_ptr->m_colorEditorFactory->removePropertyManager(manager);
         d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
     }
 
-    const auto enumPropertyManagers = manager->findChildren<QtEnumPropertyManager *>();
+    const auto enumPropertyManagers = manager->internalPropertyManagers<QtEnumPropertyManager>();
     for (QtEnumPropertyManager *manager : enumPropertyManagers)
         d_ptr->m_comboBoxFactory->removePropertyManager(manager);
 
-    const auto sizePolicyPropertyManagers = manager->findChildren<QtSizePolicyPropertyManager *>();
+    const auto sizePolicyPropertyManagers = manager->internalPropertyManagers<QtSizePolicyPropertyManager>();
     for (QtSizePolicyPropertyManager *manager : sizePolicyPropertyManagers) {
         d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
         d_ptr->m_comboBoxFactory->removePropertyManager(manager->subEnumPropertyManager());
     }
 
-    const auto fontPropertyManagers = manager->findChildren<QtFontPropertyManager *>();
+    const auto fontPropertyManagers = manager->internalPropertyManagers<QtFontPropertyManager>();
     for (QtFontPropertyManager *manager : fontPropertyManagers) {
         d_ptr->m_fontEditorFactory->removePropertyManager(manager);
         d_ptr->m_spinBoxFactory->removePropertyManager(manager->subIntPropertyManager());
@@ -2114,11 +3220,11 @@ void QtVariantEditorFactory::disconnectPropertyManager(QtVariantPropertyManager
         d_ptr->m_checkBoxFactory->removePropertyManager(manager->subBoolPropertyManager());
     }
 
-    const auto cursorPropertyManagers = manager->findChildren<QtCursorPropertyManager *>();
+    const auto cursorPropertyManagers = manager->internalPropertyManagers<QtCursorPropertyManager>();
     for (QtCursorPropertyManager *manager : cursorPropertyManagers)
         d_ptr->m_cursorEditorFactory->removePropertyManager(manager);
 
-    const auto flagPropertyManagers = manager->findChildren<QtFlagPropertyManager *>();
+    const auto flagPropertyManagers = manager->internalPropertyManagers<QtFlagPropertyManager>();
     for (QtFlagPropertyManager *manager : flagPropertyManagers)
         d_ptr->m_checkBoxFactory->removePropertyManager(manager->subBoolPropertyManager());
 }
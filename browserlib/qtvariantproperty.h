@@ -49,12 +49,16 @@
 #include <QtCore/QDate>
 #include <QtCore/QLocale>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
 
 QT_BEGIN_NAMESPACE
 
 class QRegularExpression;
 
 typedef QMap<int, QIcon> QtIconMap;
+typedef QPair<int, int> QtIntRange;
+typedef QPair<double, double> QtDoubleRange;
 
 class QtVariantProperty;
 class QtVariantEditorFactory;
@@ -98,9 +102,11 @@ public:
     int m_propertyType;
 
     void slotValueChanged(QtProperty* property, int val);
+    void slotValueChanged(QtProperty* property, int minVal, int maxVal);
     void slotRangeChanged(QtProperty* property, int min, int max);
     void slotSingleStepChanged(QtProperty* property, int step);
     void slotValueChanged(QtProperty* property, double val);
+    void slotValueChanged(QtProperty* property, double minVal, double maxVal);
     void slotRangeChanged(QtProperty* property, double min, double max);
     void slotSingleStepChanged(QtProperty* property, double step);
     void slotDecimalsChanged(QtProperty* property, int prec);
@@ -120,6 +126,8 @@ public:
     void slotValueChanged(QtProperty* property, const QRotation3D& val);
     //##########
     void slotValueChanged(QtProperty* property, const QPoint3DF& val);
+    void slotPoint3DValuesChanged(const QList<QtProperty*>& properties);
+    void slotPoint3DFValuesChanged(const QList<QtProperty*>& properties);
     //##########
     void slotValueChanged(QtProperty* property, const QPoint& val);
     void slotValueChanged(QtProperty* property, const QPointF& val);
@@ -150,6 +158,27 @@ public:
         QtProperty* internal);
     void removeSubProperty(QtVariantProperty* property);
 
+    struct TargetData
+    {
+        QVariantList values;
+        bool mixed{false};
+        QVariant minimum;
+        QVariant maximum;
+    };
+    void aggregateTargets(const QtProperty* property, TargetData& data) const;
+
+    // Journal value of a property bound to target values, kept apart
+    // from values of list typed properties.
+    struct JournalTargets
+    {
+        QVariantList values;
+        bool operator==(const JournalTargets& other) const { return values == other.values; }
+    };
+
+    QHash<const QtProperty*, TargetData> m_targets;
+    bool m_settingTargetValues{false};
+    const QtProperty* m_assignedProperty{nullptr};
+
     QMap<int, QtAbstractPropertyManager*> m_typeToPropertyManager;
     QMap<int, QMap<QString, int> > m_typeToAttributeToAttributeType;
 
@@ -169,6 +198,12 @@ public:
     const QString m_maximumAttribute;
     const QString m_minimumAttribute;
     const QString m_regExpAttribute;
+
+    void buildManagerRegistry() const;
+
+    mutable bool m_managerRegistryBuilt;
+    mutable QList<QtAbstractPropertyManager*> m_internalManagers;
+    mutable QHash<const QMetaObject*, QList<QtAbstractPropertyManager*> > m_typeToInternalManagers;
 };
 class QtVariantPropertyManager : public QtAbstractPropertyManager
 {
@@ -183,6 +218,11 @@ public:
     int valueType(const QtProperty *property) const;
     QtVariantProperty *variantProperty(const QtProperty *property) const;
 
+    QList<QtAbstractPropertyManager *> internalPropertyManagers() const;
+    QList<QtAbstractPropertyManager *> internalPropertyManagers(const QMetaObject *managerType) const;
+    template <class PropertyManager>
+    QList<PropertyManager *> internalPropertyManagers() const;
+
     virtual bool isPropertyTypeSupported(int propertyType) const;
     virtual int valueType(int propertyType) const;
     virtual QStringList attributes(int propertyType) const;
@@ -191,18 +231,31 @@ public:
     virtual QVariant value(const QtProperty *property) const;
     virtual QVariant attributeValue(const QtProperty *property, const QString &attribute) const;
 
+    bool hasTargetValues(const QtProperty *property) const;
+    QVariantList targetValues(const QtProperty *property) const;
+    bool isMixed(const QtProperty *property) const;
+    QVariant targetMinimum(const QtProperty *property) const;
+    QVariant targetMaximum(const QtProperty *property) const;
+
+    QtMemoryReport memoryReport() const override;
+
     static int enumTypeId();
     static int flagTypeId();
     static int groupTypeId();
     static int iconMapTypeId();
+    static int intRangeTypeId();
+    static int doubleRangeTypeId();
 public Q_SLOTS:
     virtual void setValue(QtProperty *property, const QVariant &val);
     virtual void setAttribute(QtProperty *property,
                 const QString &attribute, const QVariant &value);
+    void setTargetValues(QtProperty *property, const QVariantList &values);
+    void clearTargetValues(QtProperty *property);
 Q_SIGNALS:
     void valueChanged(QtProperty *property, const QVariant &val);
     void attributeChanged(QtProperty *property,
                 const QString &attribute, const QVariant &val);
+    void targetValuesChanged(QtProperty *property, const QVariantList &values);
 protected:
     bool hasValue(const QtProperty *property) const override;
     QString valueText(const QtProperty *property) const override;
@@ -210,12 +263,21 @@ protected:
     void initializeProperty(QtProperty *property) override;
     void uninitializeProperty(QtProperty *property) override;
     QtProperty *createProperty() override;
+    bool hasDeferredSubProperties(const QtProperty *property) const override;
+    void createDeferredSubProperties(QtProperty *property) override;
+    void destroyDeferredSubProperties(QtProperty *property) override;
+    QVariant journalValue(const QtProperty *property) const override;
+    void setJournalValue(QtProperty *property, const QVariant &value) override;
+    void setJournalValues(const QList<QtProperty *> &properties, const QVariantList &values) override;
+    void reportMemory(const QtProperty *property, QtMemoryReport *report) const override;
 private:
     QScopedPointer<class QtVariantPropertyManagerPrivate> d_ptr;
     Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, int))
+    Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, int, int))
     Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, int, int))
     Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, int))
     Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, double))
+    Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, double, double))
     Q_PRIVATE_SLOT(d_func(), void slotRangeChanged(QtProperty *, double, double))
     Q_PRIVATE_SLOT(d_func(), void slotSingleStepChanged(QtProperty *, double))
     Q_PRIVATE_SLOT(d_func(), void slotDecimalsChanged(QtProperty *, int))
@@ -236,6 +298,8 @@ private:
     Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, const QRotation3D &))
     //##########
     Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, const QPoint3DF &))
+    Q_PRIVATE_SLOT(d_func(), void slotPoint3DValuesChanged(const QList<QtProperty *> &))
+    Q_PRIVATE_SLOT(d_func(), void slotPoint3DFValuesChanged(const QList<QtProperty *> &))
     //#########
     Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, const QPointF &))
     Q_PRIVATE_SLOT(d_func(), void slotValueChanged(QtProperty *, const QSize &))
@@ -260,6 +324,17 @@ private:
     Q_DISABLE_COPY_MOVE(QtVariantPropertyManager)
 };
 
+template <class PropertyManager>
+QList<PropertyManager *> QtVariantPropertyManager::internalPropertyManagers() const
+{
+    const QList<QtAbstractPropertyManager *> managers = internalPropertyManagers(&PropertyManager::staticMetaObject);
+    QList<PropertyManager *> typedManagers;
+    typedManagers.reserve(managers.size());
+    for (QtAbstractPropertyManager *manager : managers)
+        typedManagers.append(static_cast<PropertyManager *>(manager));
+    return typedManagers;
+}
+
 class QtVariantEditorFactoryPrivate
 {
     QtVariantEditorFactory* q_ptr;
@@ -279,9 +354,25 @@ public:
     QtCursorEditorFactory* m_cursorEditorFactory;
     QtColorEditorFactory* m_colorEditorFactory;
     QtFontEditorFactory* m_fontEditorFactory;
+    QtIntRangeEditorFactory* m_intRangeEditorFactory;
+    QtDoubleRangeEditorFactory* m_doubleRangeEditorFactory;
+    QtPoint3DEditorFactory* m_point3DEditorFactory;
+    QtPoint3DFEditorFactory* m_point3DFEditorFactory;
+    QtRotation3DEditorFactory* m_rotation3DEditorFactory;
 
     QMap<QtAbstractEditorFactoryBase*, int> m_factoryToType;
-    QMap<int, QtAbstractEditorFactoryBase*> m_typeToFactory;
+    QVector<QtAbstractEditorFactoryBase*> m_typeToFactory;
+
+    static int factoryIndex(int propertyType);
+    void setFactoryForType(int propertyType, QtAbstractEditorFactoryBase* factory);
+    QtAbstractEditorFactoryBase* factoryForType(int propertyType) const;
+
+    void updateMixedState(QtProperty* property, QWidget* editor) const;
+    void slotPropertyChanged(QtProperty* property);
+    void slotEditorDestroyed(QObject* object);
+
+    QMap<QtProperty*, QList<QWidget*> > m_createdEditors;
+    QMap<QWidget*, QtProperty*> m_editorToProperty;
 };
 class QtVariantEditorFactory : public QtAbstractEditorFactory<QtVariantPropertyManager>
 {
@@ -293,11 +384,16 @@ protected:
     void connectPropertyManager(QtVariantPropertyManager *manager) override;
     QWidget *createEditor(QtVariantPropertyManager *manager, QtProperty *property,
                 QWidget *parent) override;
+    bool paintEditor(QtVariantPropertyManager *manager, QtProperty *property,
+                QPainter *painter, const QStyleOptionViewItem &option) override;
     void disconnectPropertyManager(QtVariantPropertyManager *manager) override;
+    void commitPolicyChanged(const QtProperty *property) override;
 private:
     QScopedPointer<class QtVariantEditorFactoryPrivate> d_ptr;
     Q_DECLARE_PRIVATE(QtVariantEditorFactory)
     Q_DISABLE_COPY_MOVE(QtVariantEditorFactory)
+    Q_PRIVATE_SLOT(d_func(), void slotPropertyChanged(QtProperty *))
+    Q_PRIVATE_SLOT(d_func(), void slotEditorDestroyed(QObject *))
 };
 
 QT_END_NAMESPACE
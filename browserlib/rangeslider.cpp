@@ -8,6 +8,18 @@
 #include <QStylePainter>
 #include <QStyle>
 #include <QToolTip>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QThreadPool>
+#include <QThread>
+#include <QSemaphore>
+#include <QMutex>
+#include <QHBoxLayout>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
 
 
 // --------------------------------------------------------------------------
@@ -24,6 +36,7 @@ RangeSlider::RangeSlider( Qt::Orientation o, QWidget* parentObject ):QSlider(o,
 // --------------------------------------------------------------------------
 RangeSlider::~RangeSlider()
 {
+  this->cancelHistogramJob();
 }
 
 // --------------------------------------------------------------------------
@@ -59,6 +72,8 @@ void RangeSlider::setValues(int l, int u)
     qBound(this->minimum(), qMax(l,u), this->maximum());
   bool emitMinValChanged = (minValue != m_MinimumValue);
   bool emitMaxValChanged = (maxValue != m_MaximumValue);
+  const int oldMinPosition = m_MinimumPosition;
+  const int oldMaxPosition = m_MaximumPosition;
 
   m_MinimumValue = minValue;
   m_MaximumValue = maxValue;
@@ -100,7 +115,7 @@ void RangeSlider::setValues(int l, int u)
   if (emitMinPosChanged || emitMaxPosChanged ||
       emitMinValChanged || emitMaxValChanged)
     {
-    this->update();
+    this->updateHandles(oldMinPosition, oldMaxPosition);
     }
 }
 
@@ -144,12 +159,14 @@ void RangeSlider::setPositions(int min, int max)
     return;
     }
 
+  const int oldMinPosition = m_MinimumPosition;
+  const int oldMaxPosition = m_MaximumPosition;
   m_MinimumPosition = minPosition;
   m_MaximumPosition = maxPosition;
 
   if (!this->hasTracking())
     {
-    this->update();
+    this->updateHandles(oldMinPosition, oldMaxPosition);
     }
   if (isSliderDown())
     {
@@ -191,40 +208,30 @@ void RangeSlider::onRangeChanged(int _minimum, int _maximum)
   Q_UNUSED(_minimum);
   Q_UNUSED(_maximum);
   this->setValues(m_MinimumValue, m_MaximumValue);
+  if (!m_SortedSamples.isEmpty())
+    {
+    this->rebinSamples();
+    }
 }
 
 // --------------------------------------------------------------------------
 // Render
-void RangeSlider::paintEvent( QPaintEvent* )
+void RangeSlider::paintEvent( QPaintEvent* _event )
 {
   QStyleOptionSlider option;
   this->initStyleOption(&option);
+  this->updateGeometryCache(option);
 
+  // The groove only changes with the geometry cache key, blit the cached
+  // rendering instead of asking the style for it on every repaint. The
+  // painter is clipped to the dirty region, so during drags only the part
+  // between the old and new handle positions is touched.
   QStylePainter painter(this);
-  option.subControls = QStyle::SC_SliderGroove;
-  // Move to minimum to not highlight the SliderGroove.
-  // On mac style, drawing just the slider groove also draws the handles,
-  // therefore we give a negative (outside of view) position.
-  option.sliderValue = this->minimum() - this->maximum();
-  option.sliderPosition = this->minimum() - this->maximum();
-  painter.drawComplexControl(QStyle::CC_Slider, option);
-
-  option.sliderPosition = m_MinimumPosition;
-  const QRect lr = style()->subControlRect( QStyle::CC_Slider,
-                                            &option,
-                                            QStyle::SC_SliderHandle,
-                                            this);
-  option.sliderPosition = m_MaximumPosition;
-
-  const QRect ur = style()->subControlRect( QStyle::CC_Slider,
-                                            &option,
-                                            QStyle::SC_SliderHandle,
-                                            this);
-
-  QRect sr = style()->subControlRect( QStyle::CC_Slider,
-                                      &option,
-                                      QStyle::SC_SliderGroove,
-                                      this);
+  painter.drawPixmap(0, 0, m_GroovePixmap);
+
+  const QRect lr = this->handleRect(m_MinimumPosition);
+  const QRect ur = this->handleRect(m_MaximumPosition);
+  const QRect sr = m_GrooveRect;
   QRect rangeBox;
   if (option.orientation == Qt::Horizontal)
     {
@@ -242,10 +249,7 @@ void RangeSlider::paintEvent( QPaintEvent* )
   // -----------------------------
   // Render the range
   //
-  QRect groove = this->style()->subControlRect( QStyle::CC_Slider,
-                                                &option,
-                                                QStyle::SC_SliderGroove,
-                                                this );
+  QRect groove = m_GrooveRect;
   groove.adjust(0, 0, -1, 0);
 
   // Create default colors based on the transfer function.
@@ -275,17 +279,33 @@ void RangeSlider::paintEvent( QPaintEvent* )
   painter.drawRect( rangeBox.intersected(groove) );
 
   //  -----------------------------------
-  // Render the sliders
+  // Render the sliders, skipping a handle that lies outside the dirty
+  // region (e.g. the one that stays put while the other is dragged).
   //
+  const QRegion& dirty = _event->region();
+  const bool paintMinimum = dirty.intersects(lr);
+  const bool paintMaximum = dirty.intersects(ur);
   if (this->isMinimumSliderDown())
     {
-    drawMaximumSlider( &painter );
-    drawMinimumSlider( &painter );
+    if (paintMaximum)
+      {
+      drawMaximumSlider( &painter );
+      }
+    if (paintMinimum)
+      {
+      drawMinimumSlider( &painter );
+      }
     }
   else
     {
-    drawMinimumSlider( &painter );
-    drawMaximumSlider( &painter );
+    if (paintMinimum)
+      {
+      drawMinimumSlider( &painter );
+      }
+    if (paintMaximum)
+      {
+      drawMaximumSlider( &painter );
+      }
     }
 }
 
@@ -518,6 +538,18 @@ void RangeSlider::init()
     m_SubclassWidth = 0;
     m_SelectedHandles = NoHandle;
     m_SymmetricMoves = false;
+    m_GeometryCacheValid = false;
+    m_CachedStyle = nullptr;
+    m_CachedPaletteKey = 0;
+    m_CachedState = QStyle::State_None;
+    m_CachedOrientation = Qt::Horizontal;
+    m_CachedUpsideDown = false;
+    m_CachedDevicePixelRatio = 1.0;
+    m_CachedMinimum = 0;
+    m_CachedMaximum = 0;
+    m_HistogramLower = 0.;
+    m_HistogramUpper = 0.;
+    m_HistogramBinCount = 64;
     QObject::connect(this, SIGNAL(rangeChanged(int, int)), this, SLOT(onRangeChanged(int, int)));
 }
 
@@ -579,15 +611,17 @@ RangeSlider::Handle RangeSlider::handleAtPos(const QPoint& pos, QRect& handleRec
 }
 
 // --------------------------------------------------------------------------
-// Copied verbatim from QSliderPrivate::pixelPosToRangeValue. See QSlider.cpp
+// Adapted from QSliderPrivate::pixelPosToRangeValue (see QSlider.cpp), with
+// the groove and handle rectangles taken from the geometry cache.
 //
 int RangeSlider::pixelPosToRangeValue(int pos) const
 {
     QStyleOptionSlider option;
     initStyleOption(&option);
+    updateGeometryCache(option);
 
-    QRect gr = style()->subControlRect(QStyle::CC_Slider, &option, QStyle::SC_SliderGroove, this);
-    QRect sr = style()->subControlRect(QStyle::CC_Slider, &option, QStyle::SC_SliderHandle, this);
+    const QRect& gr = m_GrooveRect;
+    const QRect& sr = m_MinimumHandleRect;
     int sliderMin, sliderMax, sliderLength;
     if (option.orientation == Qt::Horizontal)
     {
@@ -613,9 +647,10 @@ int RangeSlider::pixelPosFromRangeValue(int val) const
 {
     QStyleOptionSlider option;
     initStyleOption(&option);
+    updateGeometryCache(option);
 
-    QRect gr = style()->subControlRect(QStyle::CC_Slider, &option, QStyle::SC_SliderGroove, this);
-    QRect sr = style()->subControlRect(QStyle::CC_Slider, &option, QStyle::SC_SliderHandle, this);
+    const QRect& gr = m_GrooveRect;
+    const QRect& sr = m_MinimumHandleRect;
     int sliderMin, sliderMax, sliderLength;
     if (option.orientation == Qt::Horizontal)
     {
@@ -654,9 +689,7 @@ void RangeSlider::drawMinimumSlider(QStylePainter* painter) const
     }
 #ifdef Q_OS_MAC
     // On mac style, drawing just the handle actually draws also the groove.
-    QRect clip = style()->subControlRect(QStyle::CC_Slider, &option,
-        QStyle::SC_SliderHandle, q);
-    painter->setClipRect(clip);
+    painter->setClipRect(handleRect(option.sliderPosition));
 #endif
     painter->drawComplexControl(QStyle::CC_Slider, option);
 }
@@ -678,10 +711,869 @@ void RangeSlider::drawMaximumSlider(QStylePainter* painter) const
     }
 #ifdef Q_OS_MAC
     // On mac style, drawing just the handle actually draws also the groove.
-    QRect clip = style()->subControlRect(QStyle::CC_Slider, &option,
-        QStyle::SC_SliderHandle, q);
-    painter->setClipRect(clip);
+    painter->setClipRect(handleRect(option.sliderPosition));
 #endif
     painter->drawComplexControl(QStyle::CC_Slider, option);
 }
 
+//---------------------------------------------------------------------------
+// The groove rendering and the handle geometry only depend on the widget
+// size, style, palette, drawing state, orientation, range and histogram
+// (which resets m_GeometryCacheValid), so they are
+// computed once per change of any of those instead of on every paint event
+// and mouse move.
+void RangeSlider::updateGeometryCache(const QStyleOptionSlider& option) const
+{
+    const QStyle::State stateMask = QStyle::State_Enabled | QStyle::State_Active
+        | QStyle::State_HasFocus | QStyle::State_MouseOver;
+    const QStyle::State state = option.state & stateMask;
+    const qreal devicePixelRatio = devicePixelRatioF();
+    if (m_GeometryCacheValid
+        && m_CachedSize == size()
+        && m_CachedStyle == style()
+        && m_CachedPaletteKey == option.palette.cacheKey()
+        && m_CachedState == state
+        && m_CachedOrientation == option.orientation
+        && m_CachedUpsideDown == option.upsideDown
+        && qFuzzyCompare(m_CachedDevicePixelRatio, devicePixelRatio)
+        && m_CachedMinimum == minimum()
+        && m_CachedMaximum == maximum())
+        return;
+
+    QStyleOptionSlider geometryOption = option;
+    m_GrooveRect = style()->subControlRect(QStyle::CC_Slider, &geometryOption, QStyle::SC_SliderGroove, this);
+    geometryOption.sliderPosition = minimum();
+    m_MinimumHandleRect = style()->subControlRect(QStyle::CC_Slider, &geometryOption, QStyle::SC_SliderHandle, this);
+    geometryOption.sliderPosition = maximum();
+    m_MaximumHandleRect = style()->subControlRect(QStyle::CC_Slider, &geometryOption, QStyle::SC_SliderHandle, this);
+
+    m_GroovePixmap = QPixmap(size() * devicePixelRatio);
+    m_GroovePixmap.setDevicePixelRatio(devicePixelRatio);
+    m_GroovePixmap.fill(Qt::transparent);
+    {
+        QPainter painter(&m_GroovePixmap);
+        // The histogram sits behind the groove.
+        drawHistogram(&painter);
+        QStyleOptionSlider grooveOption = option;
+        grooveOption.subControls = QStyle::SC_SliderGroove;
+        // Move to minimum to not highlight the SliderGroove.
+        // On mac style, drawing just the slider groove also draws the handles,
+        // therefore we give a negative (outside of view) position.
+        grooveOption.sliderValue = minimum() - maximum();
+        grooveOption.sliderPosition = minimum() - maximum();
+        style()->drawComplexControl(QStyle::CC_Slider, &grooveOption, &painter, this);
+    }
+
+    m_CachedSize = size();
+    m_CachedStyle = style();
+    m_CachedPaletteKey = option.palette.cacheKey();
+    m_CachedState = state;
+    m_CachedOrientation = option.orientation;
+    m_CachedUpsideDown = option.upsideDown;
+    m_CachedDevicePixelRatio = devicePixelRatio;
+    m_CachedMinimum = minimum();
+    m_CachedMaximum = maximum();
+    m_GeometryCacheValid = true;
+}
+
+//---------------------------------------------------------------------------
+// Interpolate between the cached handle rectangles at minimum() and
+// maximum(); the styles only translate the handle along the groove.
+QRect RangeSlider::handleRect(int position) const
+{
+    const QPoint delta = m_MaximumHandleRect.topLeft() - m_MinimumHandleRect.topLeft();
+    const int span = m_CachedOrientation == Qt::Horizontal ? delta.x() : delta.y();
+    if (span == 0 || m_CachedMaximum <= m_CachedMinimum)
+        return m_MinimumHandleRect;
+    const int offset = QStyle::sliderPositionFromValue(m_CachedMinimum, m_CachedMaximum, position, qAbs(span));
+    const int signedOffset = span < 0 ? -offset : offset;
+    if (m_CachedOrientation == Qt::Horizontal)
+        return m_MinimumHandleRect.translated(signedOffset, 0);
+    return m_MinimumHandleRect.translated(0, signedOffset);
+}
+
+//---------------------------------------------------------------------------
+// Repaint only the strips swept by each handle: the range box between the
+// handles changes only there, the rest of the widget stays valid.
+void RangeSlider::updateHandles(int oldMinimumPosition, int oldMaximumPosition)
+{
+    if (!m_GeometryCacheValid || m_CachedSize != size()
+        || m_CachedMinimum != minimum() || m_CachedMaximum != maximum()
+        || m_CachedOrientation != orientation())
+    {
+        update();
+        return;
+    }
+
+    const auto sweptRect = [this](int from, int to) {
+        QRect rect = handleRect(from).united(handleRect(to));
+        // Cover the range box drawn on the groove as well as the handles,
+        // with a small margin for focus frames and shadows.
+        if (m_CachedOrientation == Qt::Horizontal)
+        {
+            rect.setTop(qMin(rect.top(), m_GrooveRect.top()));
+            rect.setBottom(qMax(rect.bottom(), m_GrooveRect.bottom()));
+        }
+        else
+        {
+            rect.setLeft(qMin(rect.left(), m_GrooveRect.left()));
+            rect.setRight(qMax(rect.right(), m_GrooveRect.right()));
+        }
+        return rect.adjusted(-2, -2, 2, 2);
+    };
+
+    QRegion dirty;
+    if (oldMinimumPosition != m_MinimumPosition)
+        dirty += sweptRect(oldMinimumPosition, m_MinimumPosition);
+    if (oldMaximumPosition != m_MaximumPosition)
+        dirty += sweptRect(oldMaximumPosition, m_MaximumPosition);
+    if (dirty.isEmpty())
+    {
+        // Only the values changed (e.g. on tracking off release), the
+        // handles may still be drawn differently.
+        dirty += sweptRect(m_MinimumPosition, m_MinimumPosition);
+        dirty += sweptRect(m_MaximumPosition, m_MaximumPosition);
+    }
+    update(dirty);
+}
+
+//---------------------------------------------------------------------------
+// Histogram background
+
+// A sample sort running in the thread pool. The worker only delivers its
+// result while slider is set; the slider clears it under the mutex when it
+// is destroyed or when newer samples replace the pending ones.
+struct RangeSliderHistogramJob
+{
+    QMutex mutex;
+    RangeSlider* slider;
+};
+
+// Run the tasks on the global thread pool and wait for them. Tasks that
+// find no free thread are run by the caller, so waiting from within a pool
+// thread cannot starve.
+static void runInParallel(const QVector<std::function<void()>>& tasks)
+{
+    QSemaphore done;
+    int started = 0;
+    QVector<const std::function<void()>*> inlineTasks;
+    for (const std::function<void()>& task : tasks)
+    {
+        const bool ok = QThreadPool::globalInstance()->tryStart([&task, &done]() {
+            task();
+            done.release();
+        });
+        if (ok)
+            ++started;
+        else
+            inlineTasks.append(&task);
+    }
+    for (const std::function<void()>* task : inlineTasks)
+        (*task)();
+    done.acquire(started);
+}
+
+// Parallel merge sort: the chunks are sorted concurrently, then merged
+// pairwise, each level of the reduction again running in parallel.
+static QVector<double> sortHistogramSamples(QVector<double> samples)
+{
+    samples.erase(std::remove_if(samples.begin(), samples.end(),
+        [](double sample) { return std::isnan(sample); }), samples.end());
+
+    const qsizetype count = samples.size();
+    const qsizetype minimumChunkSize = 65536;
+    const int chunkCount = int(qBound<qsizetype>(1,
+        count / minimumChunkSize, qMax(1, QThread::idealThreadCount())));
+    double* data = samples.data();
+
+    QVector<qsizetype> bounds;
+    for (int i = 0; i <= chunkCount; ++i)
+        bounds.append(count * i / chunkCount);
+
+    QVector<std::function<void()>> tasks;
+    for (int i = 0; i < chunkCount; ++i)
+    {
+        const qsizetype first = bounds.at(i);
+        const qsizetype last = bounds.at(i + 1);
+        tasks.append([data, first, last]() { std::sort(data + first, data + last); });
+    }
+    runInParallel(tasks);
+
+    for (int width = 1; width < chunkCount; width *= 2)
+    {
+        tasks.clear();
+        for (int i = 0; i + width < chunkCount; i += 2 * width)
+        {
+            const qsizetype first = bounds.at(i);
+            const qsizetype middle = bounds.at(i + width);
+            const qsizetype last = bounds.at(qMin(i + 2 * width, chunkCount));
+            tasks.append([data, first, middle, last]() {
+                std::inplace_merge(data + first, data + middle, data + last);
+            });
+        }
+        runInParallel(tasks);
+    }
+    return samples;
+}
+
+void RangeSlider::setHistogram(const QVector<double>& counts, double lower, double upper)
+{
+    cancelHistogramJob();
+    m_SortedSamples.clear();
+    m_HistogramCounts = counts;
+    m_HistogramLower = lower;
+    m_HistogramUpper = upper;
+    m_GeometryCacheValid = false;
+    update();
+    emit histogramChanged();
+}
+
+void RangeSlider::setHistogram(const QVector<double>& counts)
+{
+    setHistogram(counts, minimum(), maximum());
+}
+
+void RangeSlider::setSamples(const QVector<double>& samples)
+{
+    setHistogram(QVector<double>());
+    if (samples.isEmpty())
+        return;
+
+    QSharedPointer<RangeSliderHistogramJob> job(new RangeSliderHistogramJob);
+    job->slider = this;
+    m_HistogramJob = job;
+    QThreadPool::globalInstance()->start([job, samples]() {
+        {
+            QMutexLocker locker(&job->mutex);
+            if (!job->slider)
+                return;
+        }
+        const QVector<double> sorted = sortHistogramSamples(samples);
+        QMutexLocker locker(&job->mutex);
+        if (!job->slider)
+            return;
+        RangeSlider* slider = job->slider;
+        QMetaObject::invokeMethod(slider, [slider, job, sorted]() {
+            if (slider->m_HistogramJob != job)
+                return;
+            slider->m_HistogramJob.reset();
+            slider->m_SortedSamples = sorted;
+            slider->rebinSamples();
+        }, Qt::QueuedConnection);
+    });
+}
+
+void RangeSlider::clearHistogram()
+{
+    setHistogram(QVector<double>());
+}
+
+QVector<double> RangeSlider::histogram() const
+{
+    return m_HistogramCounts;
+}
+
+int RangeSlider::histogramBinCount() const
+{
+    return m_HistogramBinCount;
+}
+
+void RangeSlider::setHistogramBinCount(int count)
+{
+    count = qMax(1, count);
+    if (m_HistogramBinCount == count)
+        return;
+    m_HistogramBinCount = count;
+    if (!m_SortedSamples.isEmpty())
+        rebinSamples();
+}
+
+void RangeSlider::cancelHistogramJob()
+{
+    if (!m_HistogramJob)
+        return;
+    QMutexLocker locker(&m_HistogramJob->mutex);
+    m_HistogramJob->slider = nullptr;
+    locker.unlock();
+    m_HistogramJob.reset();
+}
+
+// The samples are sorted, so each bin is counted with two binary searches
+// instead of a scan over all samples.
+void RangeSlider::rebinSamples()
+{
+    const double lower = minimum();
+    const double upper = maximum();
+    QVector<double> counts(m_HistogramBinCount, 0.);
+    const double* first = m_SortedSamples.constData();
+    const double* last = first + m_SortedSamples.size();
+    const double* binBegin = std::lower_bound(first, last, lower);
+    for (int i = 0; i < m_HistogramBinCount; ++i)
+    {
+        const double* binEnd = i + 1 == m_HistogramBinCount
+            ? std::upper_bound(binBegin, last, upper)
+            : std::lower_bound(binBegin, last, lower + (upper - lower) * (i + 1) / m_HistogramBinCount);
+        counts[i] = double(binEnd - binBegin);
+        binBegin = binEnd;
+    }
+
+    m_HistogramCounts = counts;
+    m_HistogramLower = lower;
+    m_HistogramUpper = upper;
+    m_GeometryCacheValid = false;
+    update();
+    emit histogramChanged();
+}
+
+// Bars are drawn as a single step outline spanning the widget thickness,
+// placed along the groove with the same value-to-pixel mapping as the
+// handle centers.
+void RangeSlider::drawHistogram(QPainter* painter) const
+{
+    if (m_HistogramCounts.isEmpty() || maximum() <= minimum()
+        || !(m_HistogramUpper > m_HistogramLower))
+        return;
+    const double maxCount = *std::max_element(m_HistogramCounts.constBegin(), m_HistogramCounts.constEnd());
+    if (!(maxCount > 0.))
+        return;
+
+    const bool horizontal = orientation() == Qt::Horizontal;
+    const QPointF minimumCenter = QRectF(m_MinimumHandleRect).center();
+    const QPointF maximumCenter = QRectF(m_MaximumHandleRect).center();
+    const double axisStart = horizontal ? minimumCenter.x() : minimumCenter.y();
+    const double axisEnd = horizontal ? maximumCenter.x() : maximumCenter.y();
+    const double pixelsPerValue = (axisEnd - axisStart) / (maximum() - minimum());
+    const double binWidth = (m_HistogramUpper - m_HistogramLower) / m_HistogramCounts.size();
+    const QRectF area = rect();
+    const double thickness = horizontal ? area.height() : area.width();
+
+    const auto toPoint = [&](double value, double count) {
+        const double along = axisStart + (value - minimum()) * pixelsPerValue;
+        const double across = thickness * count / maxCount;
+        return horizontal ? QPointF(along, area.bottom() - across + 1)
+                          : QPointF(area.left() + across, along);
+    };
+
+    QPainterPath path;
+    path.moveTo(toPoint(m_HistogramLower, 0.));
+    for (int i = 0; i < m_HistogramCounts.size(); ++i)
+    {
+        const double count = m_HistogramCounts.at(i);
+        path.lineTo(toPoint(m_HistogramLower + binWidth * i, count));
+        path.lineTo(toPoint(m_HistogramLower + binWidth * (i + 1), count));
+    }
+    path.lineTo(toPoint(m_HistogramUpper, 0.));
+    path.closeSubpath();
+
+    QColor color = palette().color(QPalette::Highlight);
+    color.setAlpha(70);
+    painter->save();
+    painter->setClipRect(rect());
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(color);
+    painter->drawPath(path);
+    painter->restore();
+}
+
+//---------------------------------------------------------------------------
+// Int64RangeSlider
+
+// Offsets and widths are computed in quint64, so that ranges spanning the
+// whole qint64 domain do not overflow.
+static quint64 int64Distance(qint64 from, qint64 to)
+{
+    return quint64(to) - quint64(from);
+}
+
+static qint64 int64Offset(qint64 from, quint64 distance)
+{
+    return qint64(quint64(from) + distance);
+}
+
+// Arrow and page keys step the range, Home and End move it to the ends.
+// Returns 0 for keys that do not move the range.
+static int rangeSliderKeyDirection(const QKeyEvent* ev, bool& page)
+{
+    page = false;
+    switch (ev->key())
+    {
+    case Qt::Key_Left:
+    case Qt::Key_Down:
+        return -1;
+    case Qt::Key_Right:
+    case Qt::Key_Up:
+        return 1;
+    case Qt::Key_PageDown:
+        page = true;
+        return -1;
+    case Qt::Key_PageUp:
+        page = true;
+        return 1;
+    case Qt::Key_Home:
+        return -2;
+    case Qt::Key_End:
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+Int64RangeSlider::Int64RangeSlider(QWidget* _parent) : QWidget(_parent)
+{
+    init(Qt::Horizontal);
+}
+
+Int64RangeSlider::Int64RangeSlider(Qt::Orientation o, QWidget* _parent) : QWidget(_parent)
+{
+    init(o);
+}
+
+Int64RangeSlider::~Int64RangeSlider()
+{
+}
+
+void Int64RangeSlider::init(Qt::Orientation o)
+{
+    m_Minimum = 0;
+    m_Maximum = 100;
+    m_MinimumValue = 0;
+    m_MaximumValue = 100;
+    m_SingleStep = 1;
+    m_PageStep = 10;
+    m_UpdatingSlider = false;
+
+    m_Slider = new RangeSlider(o, this);
+    m_Slider->setFocusPolicy(Qt::NoFocus);
+    QHBoxLayout* layout = new QHBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(m_Slider);
+    setFocusPolicy(Qt::StrongFocus);
+    setSizePolicy(m_Slider->sizePolicy());
+
+    QObject::connect(m_Slider, SIGNAL(valuesChanged(int, int)), this, SLOT(onSliderValuesChanged(int, int)));
+    QObject::connect(m_Slider, SIGNAL(positionsChanged(int, int)), this, SLOT(onSliderPositionsChanged(int, int)));
+    updateSlider();
+}
+
+qint64 Int64RangeSlider::minimum() const
+{
+    return m_Minimum;
+}
+
+void Int64RangeSlider::setMinimum(qint64 min)
+{
+    setRange(min, qMax(m_Maximum, min));
+}
+
+qint64 Int64RangeSlider::maximum() const
+{
+    return m_Maximum;
+}
+
+void Int64RangeSlider::setMaximum(qint64 max)
+{
+    setRange(qMin(m_Minimum, max), max);
+}
+
+void Int64RangeSlider::setRange(qint64 min, qint64 max)
+{
+    max = qMax(min, max);
+    if (m_Minimum != min || m_Maximum != max)
+    {
+        m_Minimum = min;
+        m_Maximum = max;
+        emit rangeChanged(m_Minimum, m_Maximum);
+    }
+    setValues(m_MinimumValue, m_MaximumValue);
+}
+
+qint64 Int64RangeSlider::minimumValue() const
+{
+    return m_MinimumValue;
+}
+
+void Int64RangeSlider::setMinimumValue(qint64 min)
+{
+    setValues(min, qMax(m_MaximumValue, min));
+}
+
+qint64 Int64RangeSlider::maximumValue() const
+{
+    return m_MaximumValue;
+}
+
+void Int64RangeSlider::setMaximumValue(qint64 max)
+{
+    setValues(qMin(m_MinimumValue, max), max);
+}
+
+void Int64RangeSlider::setValues(qint64 l, qint64 u)
+{
+    const qint64 minValue = qBound(m_Minimum, qMin(l, u), m_Maximum);
+    const qint64 maxValue = qBound(m_Minimum, qMax(l, u), m_Maximum);
+    const bool emitMinValChanged = (minValue != m_MinimumValue);
+    const bool emitMaxValChanged = (maxValue != m_MaximumValue);
+    m_MinimumValue = minValue;
+    m_MaximumValue = maxValue;
+
+    // Also when nothing changed: a dragged handle may have to snap back.
+    updateSlider();
+
+    if (emitMinValChanged || emitMaxValChanged)
+        emit valuesChanged(m_MinimumValue, m_MaximumValue);
+    if (emitMinValChanged)
+        emit minimumValueChanged(m_MinimumValue);
+    if (emitMaxValChanged)
+        emit maximumValueChanged(m_MaximumValue);
+}
+
+qint64 Int64RangeSlider::singleStep() const
+{
+    return m_SingleStep;
+}
+
+void Int64RangeSlider::setSingleStep(qint64 step)
+{
+    m_SingleStep = qMax<qint64>(1, step);
+}
+
+qint64 Int64RangeSlider::pageStep() const
+{
+    return m_PageStep;
+}
+
+void Int64RangeSlider::setPageStep(qint64 step)
+{
+    m_PageStep = qMax<qint64>(1, step);
+}
+
+Qt::Orientation Int64RangeSlider::orientation() const
+{
+    return m_Slider->orientation();
+}
+
+void Int64RangeSlider::setOrientation(Qt::Orientation orientation)
+{
+    m_Slider->setOrientation(orientation);
+    setSizePolicy(m_Slider->sizePolicy());
+}
+
+RangeSlider* Int64RangeSlider::slider() const
+{
+    return m_Slider;
+}
+
+int Int64RangeSlider::tickCount() const
+{
+    const quint64 span = int64Distance(m_Minimum, m_Maximum);
+    return span <= quint64(RangeSliderTickCount) ? int(span) : int(RangeSliderTickCount);
+}
+
+int Int64RangeSlider::toTick(qint64 value) const
+{
+    const quint64 span = int64Distance(m_Minimum, m_Maximum);
+    const quint64 offset = int64Distance(m_Minimum, value);
+    if (span <= quint64(RangeSliderTickCount))
+        return int(offset);
+    return int(qRound64(double(offset) / double(span) * RangeSliderTickCount));
+}
+
+qint64 Int64RangeSlider::fromTick(int tick) const
+{
+    const quint64 span = int64Distance(m_Minimum, m_Maximum);
+    if (span <= quint64(RangeSliderTickCount))
+        return int64Offset(m_Minimum, quint64(qMax(0, tick)));
+    if (tick >= RangeSliderTickCount)
+        return m_Maximum;
+    const quint64 offset = quint64(double(span) * qMax(0, tick) / RangeSliderTickCount);
+    return int64Offset(m_Minimum, qMin(offset, span));
+}
+
+qint64 Int64RangeSlider::snapped(qint64 value) const
+{
+    if (m_SingleStep <= 1)
+        return value;
+    const quint64 step = quint64(m_SingleStep);
+    const quint64 offset = int64Distance(m_Minimum, value);
+    quint64 result = offset / step * step;
+    if (offset - result >= (step + 1) / 2 && int64Distance(m_Minimum, m_Maximum) - result >= step)
+        result += step;
+    return int64Offset(m_Minimum, result);
+}
+
+void Int64RangeSlider::updateSlider()
+{
+    m_UpdatingSlider = true;
+    m_Slider->setRange(0, tickCount());
+    m_Slider->setValues(toTick(m_MinimumValue), toTick(m_MaximumValue));
+    m_UpdatingSlider = false;
+}
+
+// Only the handles whose tick changed take a value from the position
+// domain; the other one keeps its exact value.
+void Int64RangeSlider::onSliderValuesChanged(int min, int max)
+{
+    if (m_UpdatingSlider)
+        return;
+    setValues(min == toTick(m_MinimumValue) ? m_MinimumValue : snapped(fromTick(min)),
+              max == toTick(m_MaximumValue) ? m_MaximumValue : snapped(fromTick(max)));
+}
+
+void Int64RangeSlider::onSliderPositionsChanged(int min, int max)
+{
+    if (m_UpdatingSlider)
+        return;
+    emit positionsChanged(min == toTick(m_MinimumValue) ? m_MinimumValue : snapped(fromTick(min)),
+                          max == toTick(m_MaximumValue) ? m_MaximumValue : snapped(fromTick(max)));
+}
+
+void Int64RangeSlider::keyPressEvent(QKeyEvent* ev)
+{
+    bool page = false;
+    const int direction = rangeSliderKeyDirection(ev, page);
+    if (direction == 0)
+    {
+        Superclass::keyPressEvent(ev);
+        return;
+    }
+
+    const quint64 width = int64Distance(m_MinimumValue, m_MaximumValue);
+    if (direction == -2)
+    {
+        setValues(m_Minimum, int64Offset(m_Minimum, width));
+    }
+    else if (direction == 2)
+    {
+        setValues(int64Offset(m_Maximum, 0 - width), m_Maximum);
+    }
+    else
+    {
+        const quint64 step = quint64(page ? m_PageStep : m_SingleStep);
+        const quint64 room = direction > 0 ? int64Distance(m_MaximumValue, m_Maximum)
+                                           : int64Distance(m_Minimum, m_MinimumValue);
+        const quint64 delta = qMin(step, room);
+        const quint64 signedDelta = direction > 0 ? delta : 0 - delta;
+        setValues(int64Offset(m_MinimumValue, signedDelta), int64Offset(m_MaximumValue, signedDelta));
+    }
+    ev->accept();
+}
+
+//---------------------------------------------------------------------------
+// DoubleRangeSlider
+
+DoubleRangeSlider::DoubleRangeSlider(QWidget* _parent) : QWidget(_parent)
+{
+    init(Qt::Horizontal);
+}
+
+DoubleRangeSlider::DoubleRangeSlider(Qt::Orientation o, QWidget* _parent) : QWidget(_parent)
+{
+    init(o);
+}
+
+DoubleRangeSlider::~DoubleRangeSlider()
+{
+}
+
+void DoubleRangeSlider::init(Qt::Orientation o)
+{
+    m_Minimum = 0.;
+    m_Maximum = 100.;
+    m_MinimumValue = 0.;
+    m_MaximumValue = 100.;
+    m_SingleStep = 1.;
+    m_PageStep = 10.;
+    m_UpdatingSlider = false;
+
+    m_Slider = new RangeSlider(o, this);
+    m_Slider->setFocusPolicy(Qt::NoFocus);
+    QHBoxLayout* layout = new QHBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(m_Slider);
+    setFocusPolicy(Qt::StrongFocus);
+    setSizePolicy(m_Slider->sizePolicy());
+
+    QObject::connect(m_Slider, SIGNAL(valuesChanged(int, int)), this, SLOT(onSliderValuesChanged(int, int)));
+    QObject::connect(m_Slider, SIGNAL(positionsChanged(int, int)), this, SLOT(onSliderPositionsChanged(int, int)));
+    updateSlider();
+}
+
+double DoubleRangeSlider::minimum() const
+{
+    return m_Minimum;
+}
+
+void DoubleRangeSlider::setMinimum(double min)
+{
+    setRange(min, qMax(m_Maximum, min));
+}
+
+double DoubleRangeSlider::maximum() const
+{
+    return m_Maximum;
+}
+
+void DoubleRangeSlider::setMaximum(double max)
+{
+    setRange(qMin(m_Minimum, max), max);
+}
+
+void DoubleRangeSlider::setRange(double min, double max)
+{
+    max = qMax(min, max);
+    if (m_Minimum != min || m_Maximum != max)
+    {
+        m_Minimum = min;
+        m_Maximum = max;
+        emit rangeChanged(m_Minimum, m_Maximum);
+    }
+    setValues(m_MinimumValue, m_MaximumValue);
+}
+
+double DoubleRangeSlider::minimumValue() const
+{
+    return m_MinimumValue;
+}
+
+void DoubleRangeSlider::setMinimumValue(double min)
+{
+    setValues(min, qMax(m_MaximumValue, min));
+}
+
+double DoubleRangeSlider::maximumValue() const
+{
+    return m_MaximumValue;
+}
+
+void DoubleRangeSlider::setMaximumValue(double max)
+{
+    setValues(qMin(m_MinimumValue, max), max);
+}
+
+void DoubleRangeSlider::setValues(double l, double u)
+{
+    const double minValue = qBound(m_Minimum, qMin(l, u), m_Maximum);
+    const double maxValue = qBound(m_Minimum, qMax(l, u), m_Maximum);
+    const bool emitMinValChanged = (minValue != m_MinimumValue);
+    const bool emitMaxValChanged = (maxValue != m_MaximumValue);
+    m_MinimumValue = minValue;
+    m_MaximumValue = maxValue;
+
+    updateSlider();
+
+    if (emitMinValChanged || emitMaxValChanged)
+        emit valuesChanged(m_MinimumValue, m_MaximumValue);
+    if (emitMinValChanged)
+        emit minimumValueChanged(m_MinimumValue);
+    if (emitMaxValChanged)
+        emit maximumValueChanged(m_MaximumValue);
+}
+
+double DoubleRangeSlider::singleStep() const
+{
+    return m_SingleStep;
+}
+
+void DoubleRangeSlider::setSingleStep(double step)
+{
+    m_SingleStep = qMax(0., step);
+}
+
+double DoubleRangeSlider::pageStep() const
+{
+    return m_PageStep;
+}
+
+void DoubleRangeSlider::setPageStep(double step)
+{
+    m_PageStep = qMax(0., step);
+}
+
+Qt::Orientation DoubleRangeSlider::orientation() const
+{
+    return m_Slider->orientation();
+}
+
+void DoubleRangeSlider::setOrientation(Qt::Orientation orientation)
+{
+    m_Slider->setOrientation(orientation);
+    setSizePolicy(m_Slider->sizePolicy());
+}
+
+RangeSlider* DoubleRangeSlider::slider() const
+{
+    return m_Slider;
+}
+
+int DoubleRangeSlider::toTick(double value) const
+{
+    const double span = m_Maximum - m_Minimum;
+    if (!(span > 0.))
+        return 0;
+    const qint64 tick = qRound64((value - m_Minimum) / span * RangeSliderTickCount);
+    return int(qBound<qint64>(0, tick, RangeSliderTickCount));
+}
+
+double DoubleRangeSlider::fromTick(int tick) const
+{
+    if (tick <= 0)
+        return m_Minimum;
+    if (tick >= RangeSliderTickCount)
+        return m_Maximum;
+    return m_Minimum + (m_Maximum - m_Minimum) * tick / RangeSliderTickCount;
+}
+
+void DoubleRangeSlider::updateSlider()
+{
+    m_UpdatingSlider = true;
+    m_Slider->setRange(0, RangeSliderTickCount);
+    m_Slider->setValues(toTick(m_MinimumValue), toTick(m_MaximumValue));
+    m_UpdatingSlider = false;
+}
+
+// Only the handles whose tick changed take a value from the position
+// domain; the other one keeps its exact value.
+void DoubleRangeSlider::onSliderValuesChanged(int min, int max)
+{
+    if (m_UpdatingSlider)
+        return;
+    setValues(min == toTick(m_MinimumValue) ? m_MinimumValue : fromTick(min),
+              max == toTick(m_MaximumValue) ? m_MaximumValue : fromTick(max));
+}
+
+void DoubleRangeSlider::onSliderPositionsChanged(int min, int max)
+{
+    if (m_UpdatingSlider)
+        return;
+    emit positionsChanged(min == toTick(m_MinimumValue) ? m_MinimumValue : fromTick(min),
+                          max == toTick(m_MaximumValue) ? m_MaximumValue : fromTick(max));
+}
+
+void DoubleRangeSlider::keyPressEvent(QKeyEvent* ev)
+{
+    bool page = false;
+    const int direction = rangeSliderKeyDirection(ev, page);
+    if (direction == 0)
+    {
+        Superclass::keyPressEvent(ev);
+        return;
+    }
+
+    const double width = m_MaximumValue - m_MinimumValue;
+    if (direction == -2)
+    {
+        setValues(m_Minimum, m_Minimum + width);
+    }
+    else if (direction == 2)
+    {
+        setValues(m_Maximum - width, m_Maximum);
+    }
+    else
+    {
+        const double step = page ? m_PageStep : m_SingleStep;
+        const double delta = direction > 0 ? qMin(step, m_Maximum - m_MaximumValue)
+                                           : -qMin(step, m_MinimumValue - m_Minimum);
+        setValues(m_MinimumValue + delta, m_MaximumValue + delta);
+    }
+    ev->accept();
+}
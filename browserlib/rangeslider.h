@@ -3,8 +3,20 @@
 
 #include <QStyle>
 #include <QSlider>
+#include <QPixmap>
+#include <QVector>
+#include <QSharedPointer>
 
 class QStylePainter;
+class QStyleOptionSlider;
+class QPainter;
+class QKeyEvent;
+struct RangeSliderHistogramJob;
+
+/// Number of positions of the embedded RangeSlider in Int64RangeSlider and
+/// DoubleRangeSlider when their range cannot be mapped one to one. Kept
+/// low enough for RangeSlider to add two positions without overflowing.
+enum { RangeSliderTickCount = 1 << 29 };
 
 class RangeSlider : public QSlider
 {
@@ -15,6 +27,7 @@ class RangeSlider : public QSlider
   Q_PROPERTY(int maximumPosition READ maximumPosition WRITE setMaximumPosition)
   Q_PROPERTY(bool symmetricMoves READ symmetricMoves WRITE setSymmetricMoves)
   Q_PROPERTY(QString handleToolTip READ handleToolTip WRITE setHandleToolTip)
+  Q_PROPERTY(int histogramBinCount READ histogramBinCount WRITE setHistogramBinCount)
 
 public:
 	///Boolean indicates the selected handle
@@ -87,6 +100,35 @@ public:
   /// \sa isMinimumSliderDown()
   bool isMaximumSliderDown()const;
 
+  ///
+  /// Display a pre-binned histogram behind the groove. The bins evenly
+  /// cover [lower, upper] in slider values and stay there when the range
+  /// changes. The overload without bounds covers the current range.
+  /// Replaces any samples given to setSamples().
+  void setHistogram(const QVector<double>& counts, double lower, double upper);
+  void setHistogram(const QVector<double>& counts);
+
+  ///
+  /// Display the distribution of raw samples (in slider values) behind the
+  /// groove. The samples are sorted off the GUI thread; once sorted, they
+  /// are binned over the current range with histogramBinCount() bins, and
+  /// rebinned by binary search whenever the range or bin count changes.
+  void setSamples(const QVector<double>& samples);
+
+  ///
+  /// Remove the histogram or samples, and cancel pending sample sorting.
+  void clearHistogram();
+
+  ///
+  /// Bin counts currently displayed, empty if there is no histogram or
+  /// the samples are still being sorted.
+  QVector<double> histogram()const;
+
+  ///
+  /// Number of bins used for samples given to setSamples(). 64 by default.
+  int histogramBinCount()const;
+  void setHistogramBinCount(int count);
+
 signals:
   ///
   /// This signal is emitted when the slider minimum value has changed,
@@ -119,6 +161,11 @@ signals:
   /// have changed.
   void positionsChanged(int min, int max);
 
+  ///
+  /// This signal is emitted when the displayed histogram has changed,
+  /// including when sorted samples have been (re)binned.
+  void histogramChanged();
+
 public slots:
   ///
   /// This property holds the slider's current minimum value.
@@ -182,6 +229,22 @@ private:
 	void drawMinimumSlider(QStylePainter* painter) const;
 	void drawMaximumSlider(QStylePainter* painter) const;
 
+	/// Refresh the cached geometry and groove pixmap if anything they
+	/// depend on changed since the last call.
+	void updateGeometryCache(const QStyleOptionSlider& option) const;
+	/// Handle rectangle at the given position, from the cached geometry.
+	QRect handleRect(int position) const;
+	/// Schedule a repaint of the area touched by moving the handles from
+	/// the given old positions to the current ones.
+	void updateHandles(int oldMinimumPosition, int oldMaximumPosition);
+
+	/// Draw the histogram bars into the groove pixmap.
+	void drawHistogram(QPainter* painter) const;
+	/// Bin the sorted samples over the current range.
+	void rebinSamples();
+	/// Stop delivering the result of the pending sample sort, if any.
+	void cancelHistogramJob();
+
 	/// End points of the range on the Model
 	int m_MaximumValue;
 	int m_MinimumValue;
@@ -212,6 +275,221 @@ private:
 	bool m_SymmetricMoves;
 
 	QString m_HandleToolTip;
+
+	/// Geometry and groove rendering cached between paint events, see
+	/// updateGeometryCache(). Handle rectangles at other positions are
+	/// derived from the ones at minimum() and maximum().
+	mutable bool m_GeometryCacheValid;
+	mutable QPixmap m_GroovePixmap;
+	mutable QRect m_GrooveRect;
+	mutable QRect m_MinimumHandleRect;
+	mutable QRect m_MaximumHandleRect;
+	mutable QSize m_CachedSize;
+	mutable const QStyle* m_CachedStyle;
+	mutable qint64 m_CachedPaletteKey;
+	mutable QStyle::State m_CachedState;
+	mutable Qt::Orientation m_CachedOrientation;
+	mutable bool m_CachedUpsideDown;
+	mutable qreal m_CachedDevicePixelRatio;
+	mutable int m_CachedMinimum;
+	mutable int m_CachedMaximum;
+
+	/// Displayed histogram, evenly covering
+	/// [m_HistogramLower, m_HistogramUpper] in slider values.
+	QVector<double> m_HistogramCounts;
+	double m_HistogramLower;
+	double m_HistogramUpper;
+	int m_HistogramBinCount;
+	/// Samples given to setSamples(), sorted, NaNs removed.
+	QVector<double> m_SortedSamples;
+	/// Sample sort running in the thread pool.
+	QSharedPointer<RangeSliderHistogramJob> m_HistogramJob;
+};
+
+///
+/// Range slider over a qint64 value domain, e.g. timestamp windows in
+/// microseconds since epoch. The values are stored and reported in 64 bits;
+/// the embedded RangeSlider only serves as a pixel-resolution position
+/// domain, so programmatic values are never rounded through it. When the
+/// range spans at most RangeSliderTickCount values the mapping is exact.
+class Int64RangeSlider : public QWidget
+{
+  Q_OBJECT
+  Q_PROPERTY(qint64 minimum READ minimum WRITE setMinimum)
+  Q_PROPERTY(qint64 maximum READ maximum WRITE setMaximum)
+  Q_PROPERTY(qint64 minimumValue READ minimumValue WRITE setMinimumValue)
+  Q_PROPERTY(qint64 maximumValue READ maximumValue WRITE setMaximumValue)
+  Q_PROPERTY(qint64 singleStep READ singleStep WRITE setSingleStep)
+  Q_PROPERTY(qint64 pageStep READ pageStep WRITE setPageStep)
+  Q_PROPERTY(Qt::Orientation orientation READ orientation WRITE setOrientation)
+
+public:
+  // Superclass typedef
+  typedef QWidget Superclass;
+  /// Constructor, builds a slider that ranges from 0 to 100 with lower and
+  /// upper values of 0 and 100, a single step of 1 and a page step of 10.
+  explicit Int64RangeSlider( Qt::Orientation o, QWidget* par= 0 );
+  explicit Int64RangeSlider( QWidget* par = 0 );
+  virtual ~Int64RangeSlider();
+
+  ///
+  /// Bounds of the value domain. Setting a bound clamps the values.
+  qint64 minimum()const;
+  void setMinimum(qint64 min);
+  qint64 maximum()const;
+  void setMaximum(qint64 max);
+  void setRange(qint64 min, qint64 max);
+
+  ///
+  /// Current values, minimum() <= minimumValue() <= maximumValue() <= maximum().
+  qint64 minimumValue()const;
+  qint64 maximumValue()const;
+
+  ///
+  /// Values dragged with the mouse snap to multiples of singleStep from
+  /// minimum(). The arrow keys move the whole range by singleStep and the
+  /// page keys by pageStep, keeping its width.
+  qint64 singleStep()const;
+  void setSingleStep(qint64 step);
+  qint64 pageStep()const;
+  void setPageStep(qint64 step);
+
+  Qt::Orientation orientation()const;
+  void setOrientation(Qt::Orientation orientation);
+
+  /// The embedded slider, e.g. for its histogram or handle tooltip.
+  RangeSlider* slider()const;
+
+signals:
+  void minimumValueChanged(qint64 min);
+  void maximumValueChanged(qint64 max);
+  void valuesChanged(qint64 min, qint64 max);
+  /// Emitted while a handle is dragged, with the positions the values
+  /// will take when the handles are released (if tracking is off).
+  void positionsChanged(qint64 min, qint64 max);
+  void rangeChanged(qint64 min, qint64 max);
+
+public slots:
+  void setMinimumValue(qint64 min);
+  void setMaximumValue(qint64 max);
+  void setValues(qint64 min, qint64 max);
+
+protected slots:
+  void onSliderValuesChanged(int min, int max);
+  void onSliderPositionsChanged(int min, int max);
+
+protected:
+  virtual void keyPressEvent(QKeyEvent* ev);
+
+private:
+  void init(Qt::Orientation o);
+  int tickCount()const;
+  int toTick(qint64 value)const;
+  qint64 fromTick(int tick)const;
+  qint64 snapped(qint64 value)const;
+  /// Push the range and values to the embedded slider.
+  void updateSlider();
+
+  RangeSlider* m_Slider;
+  qint64 m_Minimum;
+  qint64 m_Maximum;
+  qint64 m_MinimumValue;
+  qint64 m_MaximumValue;
+  qint64 m_SingleStep;
+  qint64 m_PageStep;
+  /// Set while updateSlider() runs, so the slider's echo is ignored.
+  bool m_UpdatingSlider;
+};
+
+///
+/// Range slider over a double value domain. As for Int64RangeSlider, the
+/// values are stored and reported as doubles and only the dragged handles
+/// go through the embedded slider's position domain. Dragged values are
+/// not snapped; singleStep and pageStep are the keyboard increments.
+class DoubleRangeSlider : public QWidget
+{
+  Q_OBJECT
+  Q_PROPERTY(double minimum READ minimum WRITE setMinimum)
+  Q_PROPERTY(double maximum READ maximum WRITE setMaximum)
+  Q_PROPERTY(double minimumValue READ minimumValue WRITE setMinimumValue)
+  Q_PROPERTY(double maximumValue READ maximumValue WRITE setMaximumValue)
+  Q_PROPERTY(double singleStep READ singleStep WRITE setSingleStep)
+  Q_PROPERTY(double pageStep READ pageStep WRITE setPageStep)
+  Q_PROPERTY(Qt::Orientation orientation READ orientation WRITE setOrientation)
+
+public:
+  // Superclass typedef
+  typedef QWidget Superclass;
+  /// Constructor, builds a slider that ranges from 0 to 100 with lower and
+  /// upper values of 0 and 100, a single step of 1 and a page step of 10.
+  explicit DoubleRangeSlider( Qt::Orientation o, QWidget* par= 0 );
+  explicit DoubleRangeSlider( QWidget* par = 0 );
+  virtual ~DoubleRangeSlider();
+
+  ///
+  /// Bounds of the value domain. Setting a bound clamps the values.
+  double minimum()const;
+  void setMinimum(double min);
+  double maximum()const;
+  void setMaximum(double max);
+  void setRange(double min, double max);
+
+  ///
+  /// Current values, minimum() <= minimumValue() <= maximumValue() <= maximum().
+  double minimumValue()const;
+  double maximumValue()const;
+
+  ///
+  /// The arrow keys move the whole range by singleStep and the page keys
+  /// by pageStep, keeping its width.
+  double singleStep()const;
+  void setSingleStep(double step);
+  double pageStep()const;
+  void setPageStep(double step);
+
+  Qt::Orientation orientation()const;
+  void setOrientation(Qt::Orientation orientation);
+
+  /// The embedded slider, e.g. for its histogram or handle tooltip.
+  RangeSlider* slider()const;
+
+signals:
+  void minimumValueChanged(double min);
+  void maximumValueChanged(double max);
+  void valuesChanged(double min, double max);
+  /// Emitted while a handle is dragged, with the positions the values
+  /// will take when the handles are released (if tracking is off).
+  void positionsChanged(double min, double max);
+  void rangeChanged(double min, double max);
+
+public slots:
+  void setMinimumValue(double min);
+  void setMaximumValue(double max);
+  void setValues(double min, double max);
+
+protected slots:
+  void onSliderValuesChanged(int min, int max);
+  void onSliderPositionsChanged(int min, int max);
+
+protected:
+  virtual void keyPressEvent(QKeyEvent* ev);
+
+private:
+  void init(Qt::Orientation o);
+  int toTick(double value)const;
+  double fromTick(int tick)const;
+  /// Push the range and values to the embedded slider.
+  void updateSlider();
+
+  RangeSlider* m_Slider;
+  double m_Minimum;
+  double m_Maximum;
+  double m_MinimumValue;
+  double m_MaximumValue;
+  double m_SingleStep;
+  double m_PageStep;
+  /// Set while updateSlider() runs, so the slider's echo is ignored.
+  bool m_UpdatingSlider;
 };
 
 #endif // RANGESLIDER_H